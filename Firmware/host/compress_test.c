@@ -0,0 +1,393 @@
+// -*- Mode: C; c-basic-offset: 8; -*-
+//
+// Copyright (c) 2014 SiK Multipoint Developers, All Rights Reserved
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+//  o Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  o Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in
+//    the documentation and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+// INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+// OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+///
+/// @file	compress_test.c
+///
+/// host round trip test for compress_packet() and decompress_packet()
+///
+/// Packets of raw bytes, NMEA-like text, MAVLink 1 frames and signed
+/// and unsigned MAVLink 2 frames, mixed and cut at random, must come
+/// out of decompress_packet() as they went into compress_packet(),
+/// with and without MAVLink framing. A packet truncated or corrupted
+/// on the air must still only write what fits in it, and a truncated
+/// one only the start of what was sent.
+///
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "radio.h"
+#include "compress.h"
+#include "mavlink.h"
+
+// the firmware globals that compress.c and mavlink.c use
+__pdata uint16_t nodeId;
+__pdata struct error_counts errors;
+__xdata uint8_t pbuf[MAX_PACKET_LENGTH];
+bool using_mavlink_10;
+bool feature_mavlink_framing;
+
+// what decompress_packet() wrote to the serial port. A copy record
+// of 2 bytes writes at most COPY_MAX bytes, so this is plenty
+#define OUT_MAX	(MAX_PACKET_LENGTH * 40)
+static uint8_t out[OUT_MAX];
+static unsigned out_len;
+
+// the packet being decompressed. Everything written must come from
+// it, apart from the MAVLink headers and CRCs mavlink.c rebuilds
+static uint8_t *packet_start, *packet_end;
+
+void
+serial_write_buf(__xdata uint8_t * __data buf, __pdata uint8_t count)
+{
+	if (out_len + count > OUT_MAX) {
+		printf("FAIL: decompress wrote %u bytes\n", out_len + count);
+		exit(1);
+	}
+	if (buf >= packet_start && buf <= packet_end) {
+		if (buf + count > packet_end) {
+			printf("FAIL: decompress read %u bytes past the packet\n",
+			       (unsigned)(buf + count - packet_end));
+			exit(1);
+		}
+	} else if (count > MAVLINK20_HEADER_LEN) {
+		printf("FAIL: decompress wrote %u bytes from outside the packet\n",
+		       (unsigned)count);
+		exit(1);
+	}
+	memcpy(&out[out_len], buf, count);
+	out_len += count;
+}
+
+uint16_t
+serial_write_space(void)
+{
+	return OUT_MAX;
+}
+
+uint8_t
+serial_read_space(void)
+{
+	return 0xFF;
+}
+
+void
+printfl(const char *fmt, ...)
+{
+	va_list ap;
+
+	va_start(ap, fmt);
+	vfprintf(stdout, fmt, ap);
+	va_end(ap);
+}
+
+#define X25_ACCUMULATE(_c, _sum) do { \
+	uint8_t _tmp = (_c) ^ (uint8_t)((_sum)&0xff); \
+	_tmp ^= (_tmp<<4); \
+	(_sum) = ((_sum)>>8) ^ ((uint16_t)_tmp<<8) ^ ((uint16_t)_tmp<<3) ^ (_tmp>>4); \
+} while (0)
+
+// the input being built, and the messages in it
+static uint8_t in[MAX_PACKET_LENGTH];
+static unsigned in_len;
+static uint8_t seq;
+
+// messages that compress.c knows the CRC_EXTRA of, and ones it doesn't
+static const struct {
+	uint8_t msgid, extra;
+} messages[] = {
+	{   0,  50 },	// HEARTBEAT
+	{  30,  39 },	// ATTITUDE
+	{  33, 104 },	// GLOBAL_POSITION_INT
+	{  74,  20 },	// VFR_HUD
+	{ 253,  83 },	// STATUSTEXT
+	{ 200,  17 },	// not in the table
+};
+
+static unsigned
+rnd(unsigned n)
+{
+	return random() % n;
+}
+
+// add a MAVLink frame, returning false if it doesn't fit
+static bool
+add_mavlink(uint8_t version, bool sign)
+{
+	uint8_t plen = rnd(5) == 0 ? rnd(256) : rnd(40);
+	uint8_t m = rnd(sizeof(messages)/sizeof(messages[0]));
+	uint8_t hlen = version == 1 ? MAVLINK10_HEADER_LEN : MAVLINK20_HEADER_LEN;
+	unsigned n = hlen + plen + 2 + (sign ? MAVLINK20_SIGNATURE_LEN : 0);
+	uint8_t *f = &in[in_len];
+	uint16_t sum = 0xFFFF;
+	unsigned i;
+
+	if (in_len + n > sizeof(in)) {
+		return false;
+	}
+	f[1] = plen;
+	if (version == 1) {
+		f[0] = MAVLINK10_STX;
+		f[2] = seq++;
+		f[3] = 1;
+		f[4] = 1;
+		f[5] = messages[m].msgid;
+	} else {
+		f[0] = MAVLINK20_STX;
+		f[2] = sign ? MAVLINK20_IFLAG_SIGNED : 0;
+		f[3] = rnd(8) == 0;
+		f[4] = seq++;
+		f[5] = 1;
+		f[6] = rnd(8) == 0 ? 190 : 1;
+		f[7] = messages[m].msgid;
+		f[8] = 0;
+		f[9] = rnd(8) == 0 ? 1 : 0;
+	}
+	// and sometimes a lost frame
+	if (rnd(8) == 0) {
+		seq += rnd(4);
+	}
+	for (i = hlen; i < hlen + plen; i++) {
+		f[i] = rnd(4) == 0 ? rnd(256) : 0;
+	}
+	for (i = 1; i < hlen + plen; i++) {
+		X25_ACCUMULATE(f[i], sum);
+	}
+	X25_ACCUMULATE(messages[m].extra, sum);
+	// and sometimes a frame with a bad CRC, which must still get
+	// through unchanged
+	if (rnd(16) == 0) {
+		sum ^= 1 << rnd(16);
+	}
+	f[hlen+plen] = sum & 0xFF;
+	f[hlen+plen+1] = sum >> 8;
+	for (i = hlen + plen + 2; i < n; i++) {
+		f[i] = rnd(256);
+	}
+	in_len += n;
+	return true;
+}
+
+// add some NMEA-like text, with the fields that repeat
+static void
+add_nmea(void)
+{
+	static const char *sentences[] = {
+		"$GPGGA,123519,4807.038,N,01131.000,E,1,08,0.9,545.4,M,46.9,M,,*47\r\n",
+		"$GPRMC,123519,A,4807.038,N,01131.000,E,022.4,084.4,230394,003.1,W*6A\r\n",
+		"$GPGSA,A,3,04,05,,09,12,,,24,,,,,2.5,1.3,2.1*39\r\n",
+	};
+	const char *s = sentences[rnd(3)];
+	unsigned n = strlen(s);
+
+	if (in_len + n > sizeof(in)) {
+		n = sizeof(in) - in_len;
+	}
+	memcpy(&in[in_len], s, n);
+	in_len += n;
+}
+
+// add random bytes, which may look like the start of a MAVLink frame
+static void
+add_raw(void)
+{
+	unsigned n = 1 + rnd(40);
+	static const uint8_t stx[] = { MAVLINK10_STX, MAVLINK20_STX, 0 };
+
+	while (n-- && in_len < sizeof(in)) {
+		in[in_len++] = rnd(4) == 0 ? stx[rnd(3)] : rnd(256);
+	}
+}
+
+static unsigned failures;
+
+static void
+fail(const char *msg, unsigned a, unsigned b)
+{
+	if (failures++ < 10) {
+		printf("FAIL: %s (%u %u)\n", msg, a, b);
+	}
+}
+
+// what compress_packet() gave, decompressed from a buffer of its own
+// so a read past the end of it also shows up under valgrind or
+// -fsanitize=address
+static uint8_t packet[MAX_PACKET_LENGTH+1];
+static uint8_t packet_len;
+
+static void
+decompress(uint8_t len)
+{
+	uint8_t *p = malloc(len ? len : 1);
+
+	memcpy(p, packet, len);
+	packet_start = p;
+	packet_end = p + len;
+	out_len = 0;
+	mavlink_frame_reset();
+	decompress_packet(p, len);
+	free(p);
+}
+
+// compress what is in in[], check it decompresses to the same, then
+// that every truncation of it writes only a prefix, and that
+// corrupting it doesn't write more than it could
+static void
+round_trip(const char *what, unsigned *saved)
+{
+	unsigned i;
+	uint8_t len;
+
+	memcpy(pbuf, in, in_len);
+	packet_len = compress_packet(pbuf, in_len, packet);
+	if (packet_len > in_len + 1) {
+		fail(what, in_len, packet_len);
+	}
+	if (memcmp(pbuf, in, in_len) != 0) {
+		fail("input changed", in_len, packet_len);
+	}
+	*saved += in_len + 1 - packet_len;
+
+	decompress(packet_len);
+	if (out_len != in_len || memcmp(out, in, in_len) != 0) {
+		fail(what, in_len, out_len);
+		return;
+	}
+
+	for (len = 0; len < packet_len; len++) {
+		decompress(len);
+		if (out_len > in_len || memcmp(out, in, out_len) != 0) {
+			fail("truncated packet", len, out_len);
+		}
+	}
+
+	for (i = 0; i < 8 && packet_len != 0; i++) {
+		uint8_t ofs = rnd(packet_len);
+		uint8_t save = packet[ofs];
+
+		packet[ofs] ^= 1 << rnd(8);
+		decompress(packet_len);
+		packet[ofs] = save;
+	}
+}
+
+static void
+test_packets(unsigned loops)
+{
+	unsigned i, raw = 0, nmea = 0, v1 = 0, v2 = 0, mixed = 0;
+
+	srandom(1);
+	for (i = 0; i < loops; i++) {
+		feature_mavlink_framing = (i & 1) == 0;
+		in_len = 0;
+		switch (i % 10) {
+		case 0:
+		case 1:
+			while (in_len < MAX_PACKET_LENGTH && rnd(16) != 0) {
+				add_raw();
+			}
+			round_trip("raw", &raw);
+			break;
+		case 2:
+		case 3:
+			while (in_len < MAX_PACKET_LENGTH && rnd(8) != 0) {
+				add_nmea();
+			}
+			round_trip("NMEA", &nmea);
+			break;
+		case 4:
+		case 5:
+			while (add_mavlink(1, false)) ;
+			round_trip("MAVLink 1", &v1);
+			break;
+		case 6:
+		case 7:
+			while (add_mavlink(2, rnd(2))) ;
+			round_trip("MAVLink 2", &v2);
+			break;
+		default:
+			while (in_len < MAX_PACKET_LENGTH && rnd(12) != 0) {
+				switch (rnd(4)) {
+				case 0:
+					add_raw();
+					break;
+				case 1:
+					add_nmea();
+					break;
+				default:
+					add_mavlink(1 + rnd(2), rnd(2));
+					break;
+				}
+			}
+			// sometimes cut the last frame short
+			if (in_len > 0 && rnd(2)) {
+				in_len -= rnd(in_len);
+			}
+			round_trip("mixed", &mixed);
+			break;
+		}
+	}
+	printf("compress: saved %u raw, %u NMEA, %u MAVLink 1, %u MAVLink 2, %u mixed bytes\n",
+	       raw, nmea, v1, v2, mixed);
+}
+
+static void
+usage(void)
+{
+	printf("Usage: compress_test [-n loops]\n");
+	printf("  -n loops  number of packets (default 20000)\n");
+	exit(1);
+}
+
+int
+main(int argc, char *argv[])
+{
+	unsigned loops = 20000;
+	int opt;
+
+	while ((opt = getopt(argc, argv, "n:")) != -1) {
+		switch (opt) {
+		case 'n':
+			loops = strtoul(optarg, NULL, 0);
+			break;
+		default:
+			usage();
+		}
+	}
+
+	test_packets(loops);
+	if (failures != 0) {
+		printf("compress: %u failures\n", failures);
+		return 1;
+	}
+	printf("compress: round trip OK for %u packets\n", loops);
+	return 0;
+}
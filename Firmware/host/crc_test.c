@@ -0,0 +1,205 @@
+// -*- Mode: C; c-basic-offset: 8; -*-
+//
+// Copyright (c) 2014 SiK Multipoint Developers, All Rights Reserved
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+//  o Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  o Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in
+//    the documentation and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+// INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+// OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+///
+/// @file	crc_test.c
+///
+/// host correctness test for crc16()
+///
+/// crc16() gives M(x) mod P(x) from the tables, or from the CRC0 engine,
+/// which gives the CRC-CCITT M(x).x^16 mod P(x), of all but the last two
+/// bytes with those two bytes XORed in. Both must match what the radios
+/// already send and keep in flash. The host has no CRC0 engine, so this
+/// checks the tables against a bitwise reference of each, and that the
+/// engine's CRC of all but the last two bytes, XOR the last two bytes, is
+/// the table CRC for random buffers of every length.
+///
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+// crc.c writes the CRC0 SFRs, which live here
+#define HOST_SFR_STORAGE
+#include <compiler_defs.h>
+#include <Si1000_defs.h>
+#include "crc.h"
+
+#define MAX_PACKET_LENGTH 252
+
+#define CRC_POLY 0x1021
+
+// what the tables give, M(x) mod P(x)
+static uint16_t
+ref_table(uint8_t n, const uint8_t *buf)
+{
+	uint16_t crc = 0;
+	uint8_t i;
+
+	while (n--) {
+		for (i = 0; i < 8; i++) {
+			bool top = (crc & 0x8000) != 0;
+			crc = (crc << 1) | ((*buf >> (7-i)) & 1);
+			if (top) {
+				crc ^= CRC_POLY;
+			}
+		}
+		buf++;
+	}
+	return crc;
+}
+
+// what the CRC0 engine gives, M(x).x^16 mod P(x) starting from 0
+static uint16_t
+ref_engine(uint8_t n, const uint8_t *buf)
+{
+	uint16_t crc = 0;
+	uint8_t i;
+
+	while (n--) {
+		crc ^= ((uint16_t)*buf++) << 8;
+		for (i = 0; i < 8; i++) {
+			crc = (crc & 0x8000) ? (crc << 1) ^ CRC_POLY : (crc << 1);
+		}
+	}
+	return crc;
+}
+
+static unsigned failures;
+
+static void
+fail(const char *msg, unsigned a, unsigned b)
+{
+	if (failures++ < 10) {
+		printf("FAIL: %s (%x %x)\n", msg, a, b);
+	}
+}
+
+// the values crc_init() and tdm_crc_test() check on the radio
+static void
+test_known(void)
+{
+	uint8_t c = 0x63;
+	uint8_t d[4] = { 0x01, 0x00, 0xbb, 0xcc };
+
+	if (ref_engine(1, &c) != 0x5CC5) {
+		fail("engine CRC of 0x63", ref_engine(1, &c), 0x5CC5);
+	}
+	if (crc16(4, d) != 0x88fd) {
+		fail("table CRC of 01 00 bb cc", crc16(4, d), 0x88fd);
+	}
+	if (ref_table(4, d) != 0x88fd) {
+		fail("reference CRC of 01 00 bb cc", ref_table(4, d), 0x88fd);
+	}
+}
+
+// every one and two byte buffer, where the tables are all there is
+static void
+test_short(void)
+{
+	uint8_t buf[2];
+	unsigned v;
+
+	for (v = 0; v < 0x10000; v++) {
+		buf[0] = v >> 8;
+		buf[1] = v & 0xFF;
+		if (v < 0x100 && crc16(1, &buf[1]) != ref_table(1, &buf[1])) {
+			fail("one byte CRC", v, crc16(1, &buf[1]));
+		}
+		if (crc16(2, buf) != ref_table(2, buf)) {
+			fail("two byte CRC", v, crc16(2, buf));
+		}
+		if (crc16(2, buf) != (ref_engine(0, buf) ^ v)) {
+			fail("two byte engine CRC", v, crc16(2, buf));
+		}
+	}
+}
+
+// random buffers of every length, with and without the engine
+static void
+test_random(unsigned loops)
+{
+	uint8_t buf[MAX_PACKET_LENGTH];
+	unsigned i, j;
+	uint8_t n;
+
+	srandom(1);
+	for (i = 0; i < loops; i++) {
+		n = 2 + (i % (MAX_PACKET_LENGTH - 1));
+		for (j = 0; j < n; j++) {
+			buf[j] = random();
+		}
+		if (crc16(n, buf) != ref_table(n, buf)) {
+			fail("table CRC", n, crc16(n, buf));
+		}
+		if ((ref_engine(n-2, buf) ^ ((((uint16_t)buf[n-2])<<8) | buf[n-1])) !=
+		    crc16(n, buf)) {
+			fail("engine CRC", n, ref_engine(n-2, buf));
+		}
+	}
+}
+
+static void
+usage(void)
+{
+	printf("Usage: crc_test [-n loops]\n");
+	printf("  -n loops  number of random buffers (default 100000)\n");
+	exit(1);
+}
+
+int
+main(int argc, char *argv[])
+{
+	unsigned loops = 100000;
+	int opt;
+
+	while ((opt = getopt(argc, argv, "n:")) != -1) {
+		switch (opt) {
+		case 'n':
+			loops = strtoul(optarg, NULL, 0);
+			break;
+		default:
+			usage();
+		}
+	}
+
+	// the host has no CRC0 engine, so crc16() uses the tables
+	crc_init();
+	crc_hardware = false;
+
+	test_known();
+	test_short();
+	test_random(loops);
+	if (failures != 0) {
+		printf("crc: %u failures\n", failures);
+		return 1;
+	}
+	printf("crc: tables and CRC0 engine agree for %u buffers\n", loops);
+	return 0;
+}
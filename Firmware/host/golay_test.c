@@ -0,0 +1,365 @@
+// -*- Mode: C; c-basic-offset: 8; -*-
+//
+// Copyright (c) 2014 SiK Multipoint Developers, All Rights Reserved
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+//  o Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  o Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in
+//    the documentation and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+// INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+// OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+///
+/// @file	golay_test.c
+///
+/// host correctness test and benchmark for the golay 23/12 code
+///
+/// Checks the golay23.h tables against a reference encoder based on
+/// polynomial division, then runs every data word through
+/// golay_encode()/golay_decode() with every correctable error pattern.
+/// Timings are reported in the same 16usec ticks as golay_test() in
+/// tdm.c. Run with -g to print the tables for golay23.h.
+///
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <compiler_defs.h>
+#include "golay.h"
+
+#define MAX_PACKET_LENGTH 252
+
+#define GOLAY_POLY 0xc75UL
+
+static const uint32_t shift_table[12] = {
+	GOLAY_POLY<<0,
+	GOLAY_POLY<<1,
+	GOLAY_POLY<<2,
+	GOLAY_POLY<<3,
+	GOLAY_POLY<<4,
+	GOLAY_POLY<<5,
+	GOLAY_POLY<<6,
+	GOLAY_POLY<<7,
+	GOLAY_POLY<<8,
+	GOLAY_POLY<<9,
+	GOLAY_POLY<<10,
+	GOLAY_POLY<<11,
+};
+
+// golay tables, as they should be
+static uint16_t ref_encode[4096];
+static uint16_t ref_decode[2048];
+
+// all error patterns of weight 0 to 3 in a 23 bit codeword
+static uint32_t error_patterns[2048];
+static unsigned num_error_patterns;
+
+// calculate the golay syndrome value by polynomial division
+static uint16_t
+golay_syndrome(uint32_t codeword)
+{
+	uint32_t shift = (1UL<<22);
+	uint8_t shiftcount = 11;
+
+	while (codeword >= (1UL<<11)) {
+		while ((shift & codeword) == 0) {
+			shift >>= 1;
+			shiftcount--;
+		}
+		codeword ^= shift_table[shiftcount];
+	}
+	return codeword;
+}
+
+static unsigned
+weight(uint32_t v)
+{
+	unsigned w = 0;
+	while (v) {
+		w += v & 1;
+		v >>= 1;
+	}
+	return w;
+}
+
+// build the reference tables. A codeword is the 12 data bits
+// above 11 parity bits, and the decode table maps a syndrome to
+// the correction to apply to the data bits
+static void
+build_tables(void)
+{
+	uint32_t e;
+	uint16_t i;
+	static bool seen[2048];
+
+	for (i = 0; i < 4096; i++) {
+		ref_encode[i] = golay_syndrome(((uint32_t)i)<<11);
+	}
+
+	num_error_patterns = 0;
+	for (e = 0; e < (1UL<<23); e++) {
+		uint16_t syn;
+		if (weight(e) > 3) {
+			continue;
+		}
+		syn = ref_encode[e>>11] ^ (e & 0x7FF);
+		if (seen[syn]) {
+			fprintf(stderr, "syndrome %x is not unique\n", (unsigned)syn);
+			exit(1);
+		}
+		seen[syn] = true;
+		ref_decode[syn] = e >> 11;
+		error_patterns[num_error_patterns++] = e;
+	}
+	if (num_error_patterns != 2048) {
+		fprintf(stderr, "expected 2048 error patterns, got %u\n", num_error_patterns);
+		exit(1);
+	}
+}
+
+static void
+print_table(const char *name, const uint16_t *table, unsigned n)
+{
+	unsigned i;
+
+	printf("static const __code uint16_t %s[%u] = {\n", name, n);
+	for (i = 0; i < n; i++) {
+		printf("0x%04x,%s", (unsigned)table[i], (i%8)==7?"\n":" ");
+	}
+	printf("};\n");
+}
+
+// emit the golay23.h tables on stdout
+static void
+generate_tables(void)
+{
+	print_table("golay23_encode", ref_encode, 4096);
+	printf("\n");
+	print_table("golay23_decode", ref_decode, 2048);
+}
+
+// store a 23 bit codeword in the 3 byte on-air layout
+static void
+put_codeword(uint8_t *p, uint32_t codeword)
+{
+	p[0] = codeword & 0xFF;
+	p[1] = (codeword >> 8) & 0xFF;
+	p[2] = (codeword >> 16) & 0x7F;
+}
+
+static uint32_t
+get_codeword(const uint8_t *p)
+{
+	return p[0] | (((uint32_t)p[1])<<8) | (((uint32_t)(p[2]&0x7F))<<16);
+}
+
+static unsigned failures;
+
+static void
+fail(const char *msg, unsigned a, unsigned b)
+{
+	if (failures++ < 10) {
+		printf("FAIL: %s (%x %x)\n", msg, a, b);
+	}
+}
+
+// check golay_encode() against the reference encoder
+static void
+test_encode(void)
+{
+	uint16_t d;
+	uint8_t in[3], out[6];
+
+	for (d = 0; d < 4096; d++) {
+		uint16_t d2 = (~d) & 0xFFF;
+		in[0] = d & 0xFF;
+		in[1] = (d >> 8) | ((d2 >> 4) & 0xF0);
+		in[2] = d2 & 0xFF;
+		golay_encode(3, in, out);
+		if (get_codeword(&out[0]) != ((((uint32_t)d)<<11) | ref_encode[d])) {
+			fail("encode word 1", d, get_codeword(&out[0]));
+		}
+		if (get_codeword(&out[3]) != ((((uint32_t)d2)<<11) | ref_encode[d2])) {
+			fail("encode word 2", d2, get_codeword(&out[3]));
+		}
+	}
+}
+
+// decode every data word with every correctable error pattern
+static void
+test_decode(void)
+{
+	uint16_t d;
+	unsigned i;
+	uint8_t coded[6], out[3];
+
+	for (d = 0; d < 4096; d++) {
+		uint16_t d2 = (d * 2741 + 1) & 0xFFF;
+		uint32_t c1 = (((uint32_t)d)<<11) | ref_encode[d];
+		uint32_t c2 = (((uint32_t)d2)<<11) | ref_encode[d2];
+		for (i = 0; i < num_error_patterns; i++) {
+			uint32_t e1 = error_patterns[i];
+			uint32_t e2 = error_patterns[(i * 13 + d) % num_error_patterns];
+			uint8_t expected = (e1 != 0) + (e2 != 0);
+			uint8_t errcount;
+
+			put_codeword(&coded[0], c1 ^ e1);
+			put_codeword(&coded[3], c2 ^ e2);
+			errcount = golay_decode(6, coded, out);
+			if ((out[0] | ((uint16_t)(out[1]&0xF))<<8) != d) {
+				fail("decode word 1", d, e1);
+			}
+			if ((out[2] | ((uint16_t)(out[1]&0xF0))<<4) != d2) {
+				fail("decode word 2", d2, e2);
+			}
+			if (errcount != expected) {
+				fail("decode error count", errcount, expected);
+			}
+		}
+	}
+}
+
+// round trip a full packet with the errors injected by golay_test()
+// in tdm.c, decoding in place the way radio_receive_packet() does
+static void
+test_packet(void)
+{
+	uint8_t pbuf[MAX_PACKET_LENGTH];
+	uint8_t buf[MAX_PACKET_LENGTH];
+	uint8_t i;
+
+	for (i = 0; i < MAX_PACKET_LENGTH/2; i++) {
+		pbuf[i] = i;
+	}
+	golay_encode(MAX_PACKET_LENGTH/2, pbuf, buf);
+	buf[MAX_PACKET_LENGTH/2] ^= 0x23;
+	buf[1] ^= 0x70;
+	if (golay_decode(MAX_PACKET_LENGTH, buf, pbuf) != 2) {
+		fail("packet error count", 0, 0);
+	}
+	for (i = 0; i < MAX_PACKET_LENGTH/2; i++) {
+		if (pbuf[i] != i) {
+			fail("packet decode", i, pbuf[i]);
+		}
+	}
+
+	golay_encode(MAX_PACKET_LENGTH/2 - 6, pbuf, &buf[12]);
+	buf[40] ^= 0x81;
+	golay_decode(MAX_PACKET_LENGTH-12, &buf[12], buf);
+	for (i = 0; i < MAX_PACKET_LENGTH/2 - 6; i++) {
+		if (buf[i] != i) {
+			fail("in-place decode", i, buf[i]);
+		}
+	}
+}
+
+static double
+now_usec(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1.0e6 + ts.tv_nsec * 1.0e-3;
+}
+
+// time encode and decode of a full packet, reported as 16usec ticks
+static void
+benchmark(unsigned loops)
+{
+	uint8_t pbuf[MAX_PACKET_LENGTH];
+	uint8_t buf[MAX_PACKET_LENGTH];
+	unsigned i;
+	double t1, ticks;
+
+	for (i = 0; i < MAX_PACKET_LENGTH/2; i++) {
+		pbuf[i] = i;
+	}
+
+	t1 = now_usec();
+	for (i = 0; i < loops; i++) {
+		golay_encode(MAX_PACKET_LENGTH/2, pbuf, buf);
+	}
+	ticks = (now_usec() - t1) / (16.0 * loops);
+	printf("encode %u bytes took %.4f 16usec ticks (%.6f per byte)\n",
+	       (unsigned)MAX_PACKET_LENGTH/2, ticks, ticks / (MAX_PACKET_LENGTH/2));
+
+	buf[MAX_PACKET_LENGTH/2] ^= 0x23;
+	buf[1] ^= 0x70;
+	t1 = now_usec();
+	for (i = 0; i < loops; i++) {
+		golay_decode(MAX_PACKET_LENGTH, buf, pbuf);
+	}
+	ticks = (now_usec() - t1) / (16.0 * loops);
+	printf("decode %u bytes took %.4f 16usec ticks (%.6f per byte)\n",
+	       (unsigned)MAX_PACKET_LENGTH, ticks, ticks / MAX_PACKET_LENGTH);
+}
+
+static void
+usage(void)
+{
+	printf("Usage: golay_test [-g] [-n loops]\n");
+	printf("  -g        print the golay23.h tables\n");
+	printf("  -n loops  number of benchmark iterations (default 10000)\n");
+	exit(1);
+}
+
+int
+main(int argc, char *argv[])
+{
+	unsigned loops = 10000;
+	int opt;
+	bool generate = false;
+
+	while ((opt = getopt(argc, argv, "gn:")) != -1) {
+		switch (opt) {
+		case 'g':
+			generate = true;
+			break;
+		case 'n':
+			loops = strtoul(optarg, NULL, 0);
+			break;
+		default:
+			usage();
+		}
+	}
+
+	build_tables();
+
+	if (generate) {
+		generate_tables();
+		return 0;
+	}
+
+	test_encode();
+	test_decode();
+	test_packet();
+	if (failures != 0) {
+		printf("golay: %u failures\n", failures);
+		return 1;
+	}
+	printf("golay: encode/decode OK for %u error patterns\n", num_error_patterns);
+
+	if (loops != 0) {
+		benchmark(loops);
+	}
+	return 0;
+}
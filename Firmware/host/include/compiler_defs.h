@@ -0,0 +1,94 @@
+// -*- Mode: C; c-basic-offset: 8; -*-
+//
+// Copyright (c) 2014 SiK Multipoint Developers, All Rights Reserved
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+//  o Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  o Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in
+//    the documentation and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+// INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+// OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+///
+/// @file	compiler_defs.h
+///
+/// Host replacement for the SiLabs compiler definitions, allowing the
+/// radio sources to be built with a native compiler for testing.
+///
+/// This header shadows include/compiler_defs.h by sharing its include
+/// guard, so it must be found first on the include path.  Memory space
+/// qualifiers are dropped and SFRs become ordinary variables, which
+/// host code may define by setting HOST_SFR_STORAGE before including
+/// the board header.
+///
+
+#ifndef COMPILER_DEFS_H
+#define COMPILER_DEFS_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define __data
+#define __xdata
+#define __pdata
+#define __idata
+#define __bdata
+#define __code
+#define __bit		bool
+#define __at(_x)
+#define __interrupt(_x)
+#define __using(_x)
+#define __reentrant
+#define __critical
+
+#define SEG_GENERIC
+#define SEG_FAR
+#define SEG_DATA
+#define SEG_NEAR
+#define SEG_IDATA
+#define SEG_XDATA
+#define SEG_PDATA
+#define SEG_CODE
+#define SEG_BDATA
+
+#ifndef HOST_SFR_STORAGE
+# define HOST_SFR_STORAGE extern
+#endif
+
+#define SBIT(name, addr, bit)	HOST_SFR_STORAGE volatile bool name
+#define SFR(name, addr)		HOST_SFR_STORAGE volatile uint8_t name
+#define SFRX(name, addr)	HOST_SFR_STORAGE volatile uint8_t name
+#define SFR16(name, addr)	HOST_SFR_STORAGE volatile uint16_t name
+#define SFR16E(name, fulladdr)	HOST_SFR_STORAGE volatile uint16_t name
+#define SFR32(name, addr)	HOST_SFR_STORAGE volatile uint32_t name
+#define SFR32E(name, fulladdr)	HOST_SFR_STORAGE volatile uint32_t name
+
+#define INTERRUPT(name, vector) void name (void)
+#define INTERRUPT_USING(name, vector, regnum) void name (void)
+#define INTERRUPT_PROTO(name, vector) void name (void)
+#define INTERRUPT_PROTO_USING(name, vector, regnum) void name (void)
+
+// the firmware provides its own putchar() with the SDCC signature
+#define putchar	host_putchar
+extern void host_putchar(char c);
+
+#define NOP()
+
+#endif // COMPILER_DEFS_H
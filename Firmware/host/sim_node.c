@@ -0,0 +1,561 @@
+// -*- Mode: C; c-basic-offset: 8; -*-
+//
+// Copyright (c) 2014 SiK Multipoint Developers, All Rights Reserved
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+//  o Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  o Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in
+//    the documentation and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+// INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+// OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+///
+/// @file	sim_node.c
+///
+/// One virtual node of the TDM simulator: the virtual clock and
+/// scheduling, the serial port and the host on the other end of it,
+/// which generates MAVLink test traffic and measures what comes back.
+///
+
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "radio.h"
+#include "tdm.h"
+#include "serial.h"
+#include "freq_hopping.h"
+#include "packet.h"
+#include "tdm_sim.h"
+
+struct sim_world *sim_world;
+uint8_t sim_id;
+
+static uint64_t rng_state;
+
+/// host side serial input queue, in the order the bytes go down the wire
+#define PENDING_MAX	8192
+static uint8_t pending_byte[PENDING_MAX];
+static int32_t pending_msg[PENDING_MAX];	///< message number if this is the last byte
+static uint16_t pending_insert, pending_remove;
+static uint64_t pending_next_usec;		///< when the next byte arrives at the radio
+
+/// next message from the traffic generator
+static uint64_t gen_next_usec, gen_interval_usec;
+static uint32_t gen_msgno;
+static uint8_t gen_seq;
+
+/// radio to host UART state
+static uint64_t uart_tx_done_usec;
+static uint8_t uart_tx_byte;
+static uint32_t byte_usec;
+
+/// host side MAVLink parser for what comes out of the radio
+static uint8_t parse_buf[256+12+13];
+static uint16_t parse_len;
+static bool parse_escape;
+static uint32_t rx_seen[SIM_MAX_NODES][SIM_MSG_WINDOW];
+
+/// latency samples for the messages we received, telemetry and commands
+struct sim_latency {
+	uint32_t	*samples;
+	uint32_t	count, size;
+};
+static struct sim_latency latency, cmd_latency;
+
+static bool was_synced;
+
+uint32_t
+sim_random(void)
+{
+	// xorshift64*, kept separate from the rand() the firmware uses
+	rng_state ^= rng_state >> 12;
+	rng_state ^= rng_state << 25;
+	rng_state ^= rng_state >> 27;
+	return (rng_state * 2685821657736338717ULL) >> 32;
+}
+
+double
+sim_random_double(void)
+{
+	return sim_random() / 4294967296.0;
+}
+
+/// the x25 CRC used by MAVLink, seeded with the message CRC_EXTRA
+static uint16_t
+sim_crc_x25(const uint8_t *buf, uint16_t len, uint8_t extra)
+{
+	uint16_t crc = 0xFFFF;
+	uint8_t tmp;
+
+	while (len--) {
+		tmp = *buf++ ^ (crc & 0xFF);
+		tmp ^= (tmp << 4);
+		crc = (crc >> 8) ^ (tmp << 8) ^ (tmp << 3) ^ (tmp >> 4);
+	}
+	tmp = extra ^ (crc & 0xFF);
+	tmp ^= (tmp << 4);
+	return (crc >> 8) ^ (tmp << 8) ^ (tmp << 3) ^ (tmp >> 4);
+}
+
+/// the slowest node other than us that is still running
+static int
+sim_slowest(void)
+{
+	int i, slowest = -1;
+	for (i = 0; i < sim_cfg->nodes; i++) {
+		if (i == sim_id || sim_world->node[i].finished) {
+			continue;
+		}
+		if (slowest == -1 || sim_world->node[i].now_usec < sim_world->node[slowest].now_usec) {
+			slowest = i;
+		}
+	}
+	return slowest;
+}
+
+/// hand over to the slowest node if we are too far ahead of it
+static void
+sim_schedule(void)
+{
+	int slowest;
+	for (;;) {
+		slowest = sim_slowest();
+		if (slowest == -1 ||
+		    sim_self->now_usec <= sim_world->node[slowest].now_usec + SIM_LOOKAHEAD_USEC) {
+			return;
+		}
+		sem_post(&sim_world->node[slowest].run);
+		sem_wait(&sim_self->run);
+	}
+}
+
+static int
+sim_compare_u32(const void *a, const void *b)
+{
+	uint32_t x = *(const uint32_t *)a, y = *(const uint32_t *)b;
+	return x < y ? -1 : x > y;
+}
+
+/// fill in p50, p90, p99, max and mean, and return the sample count
+static uint32_t
+sim_latency_stats(struct sim_latency *l, uint32_t *usec)
+{
+	uint64_t sum = 0;
+	uint32_t i;
+
+	if (l->count == 0) {
+		return 0;
+	}
+	qsort(l->samples, l->count, sizeof(l->samples[0]), sim_compare_u32);
+	for (i = 0; i < l->count; i++) {
+		sum += l->samples[i];
+	}
+	usec[0] = l->samples[(l->count * 50) / 100];
+	usec[1] = l->samples[(l->count * 90) / 100];
+	usec[2] = l->samples[(l->count * 99) / 100];
+	usec[3] = l->samples[l->count - 1];
+	usec[4] = sum / l->count;
+	return l->count;
+}
+
+static void
+sim_latency_add(struct sim_latency *l, uint32_t usec)
+{
+	if (l->count == l->size) {
+		l->size = l->size ? l->size * 2 : 1024;
+		l->samples = realloc(l->samples, l->size * sizeof(l->samples[0]));
+		if (l->samples == NULL) {
+			panic("out of memory");
+		}
+	}
+	l->samples[l->count++] = usec;
+}
+
+/// fill in our results and let the rest of the network carry on
+void
+sim_node_exit(int status)
+{
+	struct sim_result *r = &sim_self->result;
+	int slowest;
+
+	r->latency_count = sim_latency_stats(&latency, r->latency_usec);
+	r->cmd_latency_count = sim_latency_stats(&cmd_latency, r->cmd_latency_usec);
+	r->rx_errors = errors.rx_errors;
+	r->corrected_errors = errors.corrected_errors;
+	r->corrected_packets = errors.corrected_packets;
+	r->serial_tx_overflow = errors.serial_tx_overflow;
+	r->serial_rx_overflow = errors.serial_rx_overflow;
+	r->air_rate = radio_air_rate();
+	r->clock_drift = sim_tdm_clock_drift();
+
+	sim_self->finished = true;
+	slowest = sim_slowest();
+	if (slowest != -1) {
+		sem_post(&sim_world->node[slowest].run);
+	}
+	_exit(status);
+}
+
+/// SLIP framing, RFC 1055
+#define SLIP_END	0xC0
+#define SLIP_ESC	0xDB
+#define SLIP_ESC_END	0xDC
+#define SLIP_ESC_ESC	0xDD
+
+/// SLIP encode n bytes of msg in place, returning the new length
+static uint16_t
+sim_slip_encode(uint8_t *msg, uint16_t n)
+{
+	uint8_t raw[256+12+13];
+	uint16_t i, o = 0;
+
+	memcpy(raw, msg, n);
+	msg[o++] = SLIP_END;
+	for (i = 0; i < n; i++) {
+		if (raw[i] == SLIP_END) {
+			msg[o++] = SLIP_ESC;
+			msg[o++] = SLIP_ESC_END;
+		} else if (raw[i] == SLIP_ESC) {
+			msg[o++] = SLIP_ESC;
+			msg[o++] = SLIP_ESC_ESC;
+		} else {
+			msg[o++] = raw[i];
+		}
+	}
+	msg[o++] = SLIP_END;
+	return o;
+}
+
+/// queue the next MAVLink message from the traffic generator
+static void
+sim_generate(void)
+{
+	uint8_t msg[2*(256+12+13)+2];
+	uint8_t len = sim_cfg->msg_len, hdr, msgid;
+	uint16_t crc, i, n = len + SIM_MSG_OVERHEAD;
+
+	sim_self->result.msgs_offered++;
+	if (((pending_remove - pending_insert - 1) & (PENDING_MAX-1)) < (sim_cfg->slip ? 2*n+2 : n)) {
+		// the application can't get it into the radio
+		sim_self->result.msgs_dropped++;
+		gen_msgno++;
+		return;
+	}
+
+	// message id, not a heartbeat
+	if (sim_cfg->cmd_every != 0 && gen_msgno % sim_cfg->cmd_every == 0) {
+		msgid = SIM_MSG_COMMAND;
+	} else {
+		msgid = SIM_MSG_TELEMETRY;
+	}
+	msg[1] = len;
+	if (sim_cfg->msg_version == 1) {
+		hdr = 6;
+		msg[0] = 254;
+		msg[2] = gen_seq++;
+		msg[3] = sim_id;	// system id
+		msg[4] = 0;		// component id
+		msg[5] = msgid;
+	} else {
+		hdr = 10;
+		msg[0] = 253;
+		msg[2] = sim_cfg->msg_signed ? 0x01 : 0;	// incompat flags
+		msg[3] = 0;		// compat flags
+		msg[4] = gen_seq++;
+		msg[5] = sim_id;
+		msg[6] = 0;
+		msg[7] = msgid;
+		msg[8] = 0;
+		msg[9] = 0;
+	}
+	// the message number goes at the start of the payload
+	msg[hdr] = gen_msgno & 0xFF;
+	msg[hdr+1] = (gen_msgno >> 8) & 0xFF;
+	msg[hdr+2] = (gen_msgno >> 16) & 0xFF;
+	msg[hdr+3] = gen_msgno >> 24;
+	for (i = hdr + 4; i < hdr + len; i++) {
+		msg[i] = i;
+	}
+	crc = sim_crc_x25(&msg[1], hdr + len - 1, SIM_MSG_CRC_EXTRA(msgid));
+	msg[hdr + len] = crc & 0xFF;
+	msg[hdr + len + 1] = crc >> 8;
+	for (i = hdr + len + 2; i < n; i++) {
+		// the signature, which nothing checks
+		msg[i] = 0xA5;
+	}
+	if (sim_cfg->slip) {
+		n = sim_slip_encode(msg, n);
+	}
+
+	if (pending_insert == pending_remove && pending_next_usec < sim_self->now_usec) {
+		pending_next_usec = sim_self->now_usec;
+	}
+	for (i = 0; i < n; i++) {
+		pending_byte[pending_insert] = msg[i];
+		pending_msg[pending_insert] = (i == n - 1) ? (int32_t)gen_msgno : -1;
+		pending_insert = (pending_insert + 1) & (PENDING_MAX-1);
+	}
+	gen_msgno++;
+}
+
+/// feed a byte to the host's MAVLink parser
+static void
+sim_host_parse(uint8_t c)
+{
+	struct sim_result *r = &sim_self->result;
+	uint32_t msgno, slot;
+	uint16_t hdr, end;
+	uint8_t src, msgid;
+	const uint8_t *p;
+
+	if (parse_len == 0 && c != 254 && c != 253) {
+		r->rx_garbage++;
+		return;
+	}
+	parse_buf[parse_len++] = c;
+	if (parse_len < 3) {
+		return;
+	}
+	// header, payload, then the CRC and any signature
+	if (parse_buf[0] == 254) {
+		hdr = 6;
+		end = hdr + parse_buf[1];
+		src = parse_buf[3];
+		msgid = parse_buf[5];
+	} else {
+		hdr = 10;
+		end = hdr + parse_buf[1];
+		src = parse_buf[5];
+		msgid = parse_buf[7];
+	}
+	if (parse_len < end + 2 + (hdr == 10 && (parse_buf[2] & 0x01) ? 13 : 0)) {
+		return;
+	}
+
+	// a whole frame
+	if ((msgid != SIM_MSG_TELEMETRY && msgid != SIM_MSG_COMMAND) ||
+	    sim_crc_x25(&parse_buf[1], end - 1, SIM_MSG_CRC_EXTRA(msgid)) !=
+	    (parse_buf[end] | (parse_buf[end+1] << 8)) ||
+	    (hdr == 10 && (parse_buf[8] != 0 || parse_buf[9] != 0)) ||
+	    src >= sim_cfg->nodes || parse_buf[1] < 4) {
+		r->rx_garbage += parse_len;
+		parse_len = 0;
+		return;
+	}
+	p = &parse_buf[hdr];
+	msgno = p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+	slot = msgno % SIM_MSG_WINDOW;
+
+	if (rx_seen[src][slot] == msgno + 1) {
+		r->rx_duplicates++;
+	} else {
+		rx_seen[src][slot] = msgno + 1;
+		r->rx_msgs[src]++;
+		r->rx_bytes[src] += parse_len;
+		if (sim_world->input_usec[src][slot] != 0) {
+			sim_latency_add(msgid == SIM_MSG_COMMAND ? &cmd_latency : &latency,
+					sim_self->now_usec - sim_world->input_usec[src][slot]);
+		}
+	}
+	parse_len = 0;
+}
+
+/// a byte has come out of the radio's serial port
+static void
+sim_host_receive(uint8_t c)
+{
+	if (!sim_cfg->slip) {
+		sim_host_parse(c);
+		return;
+	}
+	if (c == SLIP_END) {
+		// anything left over is the part of a frame that was lost
+		sim_self->result.rx_garbage += parse_len;
+		parse_len = 0;
+		parse_escape = false;
+		return;
+	}
+	if (c == SLIP_ESC) {
+		parse_escape = true;
+		return;
+	}
+	if (parse_escape) {
+		c = c == SLIP_ESC_END ? SLIP_END : c == SLIP_ESC_ESC ? SLIP_ESC : c;
+		parse_escape = false;
+	}
+	sim_host_parse(c);
+}
+
+/// run the UART interrupt, and start shifting out any byte it gave us
+static void
+sim_uart_isr(void)
+{
+	if (sim_serial_isr()) {
+		uart_tx_byte = SBUF0;
+		uart_tx_done_usec = sim_self->now_usec + byte_usec;
+	}
+}
+
+/// run the serial port and traffic generator up to target
+static void
+sim_serial_events(uint64_t target)
+{
+	uint64_t t;
+
+	for (;;) {
+		// serial_restart() kicks the transmitter by setting TI0
+		if (TI0 && ES0 && uart_tx_done_usec == SIM_NEVER) {
+			sim_uart_isr();
+		}
+
+		t = target + 1;
+		if (gen_next_usec < t) {
+			t = gen_next_usec;
+		}
+		if (uart_tx_done_usec < t) {
+			t = uart_tx_done_usec;
+		}
+		if (pending_insert != pending_remove && pending_next_usec < t) {
+			t = pending_next_usec;
+		}
+		if (t > target) {
+			return;
+		}
+		if (t > sim_self->now_usec) {
+			sim_self->now_usec = t;
+		}
+
+		if (t == gen_next_usec) {
+			sim_generate();
+			gen_next_usec += gen_interval_usec;
+		} else if (t == uart_tx_done_usec) {
+			// the byte has reached the host
+			uart_tx_done_usec = SIM_NEVER;
+			sim_host_receive(uart_tx_byte);
+			TI0 = 1;
+			if (ES0) {
+				sim_uart_isr();
+			}
+		} else if (!ES0 || (feature_rtscts && SERIAL_CTS)) {
+			// interrupts off, or the radio asked us to stop sending
+			pending_next_usec += byte_usec;
+		} else {
+			int32_t msgno = pending_msg[pending_remove];
+			SBUF0 = pending_byte[pending_remove];
+			pending_remove = (pending_remove + 1) & (PENDING_MAX-1);
+			pending_next_usec += byte_usec;
+			RI0 = 1;
+			sim_uart_isr();
+			if (msgno != -1) {
+				sim_world->input_usec[sim_id][msgno % SIM_MSG_WINDOW] = t;
+			}
+		}
+	}
+}
+
+/// move our virtual clock forward, running anything that happens
+/// in the meantime
+void
+sim_advance(uint32_t usec)
+{
+	uint64_t target = sim_self->now_usec + usec;
+	bool synced;
+
+	sim_serial_events(target);
+	sim_self->now_usec = target;
+
+	synced = sim_tdm_synced();
+	if (synced && !was_synced && sim_self->result.sync_usec == SIM_NEVER) {
+		sim_self->result.sync_usec = target - sim_self->result.start_usec;
+	} else if (!synced && was_synced) {
+		sim_self->result.sync_lost++;
+	}
+	was_synced = synced;
+
+	if (target >= sim_world->end_usec) {
+		sim_node_exit(0);
+	}
+	sim_schedule();
+}
+
+/// power up a node and run the firmware
+void
+sim_node_run(uint8_t id)
+{
+	uint32_t frame_bytes;
+	uint8_t speed;
+
+	sim_id = id;
+	rng_state = ((uint64_t)sim_cfg->seed << 8) ^ (id + 1) ^ 0x9E3779B97F4A7C15ULL;
+	sim_self->result.start_usec = sim_self->now_usec;
+	sim_self->result.sync_usec = SIM_NEVER;
+	uart_tx_done_usec = SIM_NEVER;
+
+	// serial bytes are 10 bits on the wire
+	speed = sim_cfg->serial_speed;
+	byte_usec = 10000000UL / (speed == 57 ? 57600UL : speed == 115 ? 115200UL :
+				  speed == 230 ? 230400UL : speed * 1000UL);
+
+	frame_bytes = sim_cfg->msg_len + SIM_MSG_OVERHEAD;
+	gen_next_usec = SIM_NEVER;
+	if (sim_cfg->rate[id] != 0) {
+		gen_interval_usec = (frame_bytes * 1000000ULL) / sim_cfg->rate[id];
+		gen_next_usec = sim_self->now_usec + sim_random() % gen_interval_usec;
+	}
+
+	// wait for our turn to power up
+	sem_wait(&sim_self->run);
+	sim_self->started = true;
+
+	// the same setup main.c does from the parameters
+	nodeId = id;
+	feature_golay = sim_cfg->ecc;
+	feature_adaptive_fec = sim_cfg->adaptive_fec;
+	feature_mavlink_framing = sim_cfg->mavlink;
+	feature_mavlink_priority = sim_cfg->mavlink_priority;
+	feature_slip_framing = sim_cfg->slip;
+	feature_opportunistic_resend = sim_cfg->oppresend;
+	feature_rtscts = sim_cfg->rtscts;
+	feature_demand_slots = sim_cfg->demand_slots;
+	feature_arq = sim_cfg->arq;
+	feature_compress = sim_cfg->compress;
+	packet_set_serial_gap(sim_cfg->serial_gap);
+	memcpy(node_weights, sim_cfg->weights, MAX_SLOT_NODES);
+	duty_cycle = sim_cfg->duty_cycle;
+	lbt_rssi = sim_cfg->lbt_rssi;
+
+	serial_init(sim_cfg->serial_speed);
+	sim_radio_init();
+	num_fh_channels = sim_cfg->num_channels;
+	radio_set_channel(sim_cfg->netid % num_fh_channels);
+	tdm_set_node_count(sim_cfg->nodes);
+	tdm_set_node_destination(id == BASE_NODEID ? 0xFFFF : BASE_NODEID);
+	tdm_set_sync_any(0);
+	tdm_set_adaptive_rate(sim_cfg->adaptive_rate);
+	tdm_set_sync_rounds(sim_cfg->sync_rounds);
+	fhop_init(sim_cfg->netid);
+	fhop_set_max_excluded(sim_cfg->adaptive_hop);
+	tdm_init();
+
+	radio_receiver_on();
+	tdm_serial_loop();
+	panic("tdm_serial_loop returned");
+}
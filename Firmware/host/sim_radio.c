@@ -0,0 +1,765 @@
+// -*- Mode: C; c-basic-offset: 8; -*-
+//
+// Copyright (c) 2014 SiK Multipoint Developers, All Rights Reserved
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+//  o Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  o Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in
+//    the documentation and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+// INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+// OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+
+///
+/// @file	sim_radio.c
+///
+/// Simulated radio, timer and the rest of the firmware the TDM code
+/// depends on.
+///
+/// Transmitted frames go into the shared frame ring. Each node decides
+/// what happened to a frame once every node has run past its end: it
+/// is lost if the receiver was off channel, transmitting, re-armed or
+/// still holding the previous packet at any point during the frame, if
+/// another frame overlapped it on the same channel, or at random. The
+/// golay framing is the same as radio.c, so bit errors go through the
+/// real decoder. Other frames with bit errors fail the radio's CRC.
+/// Channels with interference have extra bit errors and noise.
+///
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define HOST_SFR_STORAGE
+#include "radio.h"
+#include "tdm.h"
+#include "timer.h"
+#include "golay.h"
+#include "crc.h"
+#include "tdm_sim.h"
+
+// the firmware globals that live in files the simulator doesn't build
+__pdata uint8_t pdata_canary = 0x41;
+__pdata uint16_t nodeId;
+__pdata struct radio_settings settings;
+__pdata struct error_counts errors;
+bool feature_golay;
+bool feature_adaptive_fec;
+bool feature_opportunistic_resend;
+bool feature_mavlink_framing;
+bool feature_mavlink_priority;
+bool feature_slip_framing;
+bool feature_rtscts;
+bool feature_demand_slots;
+bool feature_arq;
+bool feature_compress;
+__xdata uint8_t node_weights[MAX_SLOT_NODES];
+bool at_mode_active;
+bool at_cmd_ready;
+__pdata uint8_t at_testmode;
+__pdata char at_cmd[AT_CMD_MAXLEN + 1];
+__pdata uint8_t at_cmd_len;
+
+/// bytes of preamble, sync word, header, length and CRC the radio adds
+#define FRAME_OVERHEAD(_pre)	((_pre)/2 + 2 + (feature_golay ? 2 : feature_adaptive_fec ? 3 : 4) + 1 + 2)
+
+/// time to switch between receive and transmit
+#define TURNAROUND_USEC		100
+
+/// how long the decoder takes per encoded byte
+#define DECODE_USEC_PER_BYTE	4
+
+/// the extra bit error rate and noise on a channel with interference
+#define SIM_BAD_CHANNEL_BER	0.005
+#define SIM_BAD_CHANNEL_NOISE	30
+
+/// things the receiver did, kept so that frames can be resolved after
+/// they have ended
+enum rx_event_type {
+	RX_ARM,			///< receiver (re)started
+	RX_TRANSMIT,		///< transmitter started
+	RX_STOPPED,		///< receive ring full, receiver parked
+};
+
+#define RX_EVENTS	256
+
+static struct rx_event {
+	uint64_t	usec;
+	uint8_t		type;
+	uint8_t		channel;
+	uint8_t		air_rate;
+} rx_events[RX_EVENTS];
+static uint16_t rx_event_count;
+
+static uint8_t channel;
+static uint32_t next_resolve;
+static uint64_t preamble_cleared_usec;
+
+/// the packets waiting for radio_receive_packet(), as the receive
+/// ring in radio.c
+#define RX_SLOTS	2
+
+static struct rx_slot {
+	uint8_t		len;
+	uint8_t		rssi;
+	bool		golay;
+	uint8_t		data[SIM_MAX_FRAME_LENGTH];
+} rx_ring[RX_SLOTS];
+static bool tx_golay;
+static uint8_t rx_insert, rx_remove, rx_count;
+static uint8_t rx_rssi;
+
+/// when the ring last filled up and the receiver stopped
+static uint64_t full_usec;
+
+static void
+rx_event(uint8_t type)
+{
+	struct rx_event *e = &rx_events[rx_event_count % RX_EVENTS];
+
+	if (type == RX_ARM && rx_count == RX_SLOTS) {
+		// radio_receiver_on() parks the receiver until a slot frees
+		type = RX_STOPPED;
+	}
+	e->usec = sim_self->now_usec;
+	e->type = type;
+	e->channel = channel;
+	e->air_rate = settings.air_data_rate;
+	rx_event_count++;
+}
+
+static struct sim_frame *
+frame(uint32_t i)
+{
+	return &sim_world->frames[i % SIM_MAX_FRAMES];
+}
+
+/// on air time of an encoded frame
+static uint32_t
+frame_usec(uint8_t elen)
+{
+	return ((FRAME_OVERHEAD(settings.preamble_length) + elen) * 8000UL) / settings.air_data_rate;
+}
+
+/// decide what happened to a frame at this node
+static void
+resolve(uint32_t index)
+{
+	struct sim_frame *f = frame(index);
+	struct sim_result *r = &sim_self->result;
+	struct rx_event *armed = NULL;
+	struct rx_slot *slot;
+	uint64_t start = f->start_usec + sim_cfg->latency_usec;
+	uint64_t end = f->end_usec + sim_cfg->latency_usec;
+	uint16_t i;
+	uint32_t j;
+	double ber = sim_cfg->ber;
+	bool corrupted = false;
+
+	f->resolved |= 1UL << sim_id;
+	if (f->src == sim_id) {
+		return;
+	}
+
+	// the header check only passes our node ID and broadcasts
+	if (f->dest != nodeId && f->dest != 0xFFFF) {
+		return;
+	}
+
+	// find what the receiver was doing while the frame was on air
+	for (i = 0; i < RX_EVENTS && i < rx_event_count; i++) {
+		struct rx_event *e = &rx_events[(rx_event_count - 1 - i) % RX_EVENTS];
+		if (e->usec <= start) {
+			armed = e;
+			break;
+		}
+		if (e->usec < end) {
+			// retuned, restarted or transmitted part way
+			r->rx_missed++;
+			return;
+		}
+	}
+	if (armed != NULL && (armed->channel != f->channel || armed->air_rate != f->air_rate)) {
+		// never heard it
+		return;
+	}
+	if (armed == NULL || armed->type == RX_TRANSMIT) {
+		r->rx_missed++;
+		return;
+	}
+	if (armed->type == RX_STOPPED || full_usec > armed->usec) {
+		// the receiver stops while every receive slot is in use
+		r->rx_overrun++;
+		return;
+	}
+
+	// anyone else on the same channel at the same time?
+	for (j = (sim_world->frame_count > SIM_MAX_FRAMES ? sim_world->frame_count - SIM_MAX_FRAMES : 0);
+	     j < sim_world->frame_count; j++) {
+		struct sim_frame *g = frame(j);
+		if (j != index && g->channel == f->channel &&
+		    g->start_usec < f->end_usec && g->end_usec > f->start_usec) {
+			r->rx_collisions++;
+			return;
+		}
+	}
+
+	if (sim_cfg->loss > 0 && sim_random_double() < sim_cfg->loss) {
+		r->rx_lost++;
+		return;
+	}
+
+	slot = &rx_ring[rx_insert];
+	memcpy(slot->data, f->data, f->len);
+	slot->len = f->len;
+	slot->golay = f->golay;
+	if (f->channel < 64 && (sim_cfg->bad_channels & (1ULL << f->channel))) {
+		ber += SIM_BAD_CHANNEL_BER;
+	}
+	if (ber > 0) {
+		for (i = 0; i < slot->len * 8; i++) {
+			if (sim_random_double() < ber) {
+				slot->data[i / 8] ^= 1 << (i % 8);
+				corrupted = true;
+			}
+		}
+	}
+	if (corrupted && !slot->golay && !feature_adaptive_fec) {
+		// the radio checks the CRC of these itself
+		if (errors.rx_errors != 0xFFFF) {
+			errors.rx_errors++;
+		}
+		return;
+	}
+	slot->rssi = sim_cfg->rssi;
+	rx_insert = (rx_insert + 1) % RX_SLOTS;
+	if (++rx_count == RX_SLOTS) {
+		full_usec = end;
+	}
+	r->rx_packets++;
+}
+
+/// resolve every frame that all nodes have run past
+void
+sim_radio_poll(void)
+{
+	uint64_t now = sim_self->now_usec;
+	uint32_t i;
+
+	for (i = next_resolve; i < sim_world->frame_count; i++) {
+		struct sim_frame *f = frame(i);
+		if (f->resolved & (1UL << sim_id)) {
+			if (i == next_resolve) {
+				next_resolve++;
+			}
+			continue;
+		}
+		if (f->end_usec + sim_cfg->latency_usec + SIM_LOOKAHEAD_USEC > now) {
+			continue;
+		}
+		resolve(i);
+		if (i == next_resolve) {
+			next_resolve++;
+		}
+	}
+}
+
+/// a frame on our channel that is on the air now, if any
+static struct sim_frame *
+frame_in_flight(void)
+{
+	uint64_t now = sim_self->now_usec - sim_cfg->latency_usec;
+	uint32_t i;
+
+	for (i = sim_world->frame_count; i > next_resolve; i--) {
+		struct sim_frame *f = frame(i - 1);
+		if (f->src != sim_id && f->channel == channel &&
+		    f->start_usec <= now && f->end_usec > now) {
+			return f;
+		}
+	}
+	return NULL;
+}
+
+/// the air rates of radio.c
+static const uint8_t rates[] = { 2, 4, 8, 16, 19, 24, 32, 48, 64, 96, 128, 192, 250 };
+
+/// the index of the first rate at least rate, as radio_configure() picks
+static uint8_t
+rate_index(uint8_t rate)
+{
+	uint8_t i;
+
+	for (i = 0; i < ARRAY_LENGTH(rates) - 1; i++) {
+		if (rates[i] >= rate) {
+			break;
+		}
+	}
+	return i;
+}
+
+void
+sim_radio_init(void)
+{
+	settings.air_data_rate = rates[rate_index(sim_cfg->air_speed)];
+	settings.preamble_length = 16;
+	settings.transmit_power = 20;
+
+	// frames already on the air when we power up are not ours to receive
+	for (next_resolve = 0; next_resolve < sim_world->frame_count; next_resolve++) {
+		frame(next_resolve)->resolved |= 1UL << sim_id;
+	}
+}
+
+/// the transmit in progress
+static bool tx_busy, tx_ok;
+static uint64_t tx_done_usec;
+
+/// nothing but the transmit interrupt may touch the radio while
+/// a packet is going out
+static void
+check_idle(const char *what)
+{
+	if (tx_busy) {
+		panic("%s while transmitting", what);
+	}
+}
+
+bool
+radio_receive_packet(uint8_t *length, __xdata uint8_t * __pdata buf)
+{
+	__xdata uint8_t gout[3];
+	uint16_t crc1, crc2;
+	uint8_t errcount = 0;
+	uint8_t elen;
+	bool golay;
+	struct rx_slot *slot;
+
+	check_idle("radio_receive_packet");
+	sim_radio_poll();
+	if (rx_count == 0) {
+		return false;
+	}
+	slot = &rx_ring[rx_remove];
+	memcpy(buf, slot->data, slot->len);
+	elen = slot->len;
+	golay = slot->golay;
+	rx_rssi = slot->rssi;
+	rx_remove = (rx_remove + 1) % RX_SLOTS;
+	if (rx_count-- == RX_SLOTS) {
+		// a slot is free again, restart the stopped receiver
+		radio_receiver_on();
+	}
+
+	if (!golay) {
+		if (feature_adaptive_fec) {
+			if (elen < 2) {
+				goto failed;
+			}
+			elen -= 2;
+			crc1 = buf[elen] | (((uint16_t)buf[elen+1])<<8);
+			if (crc1 != (crc16(elen, buf) ^ sim_cfg->netid)) {
+				goto failed;
+			}
+		}
+		*length = elen;
+		return true;
+	}
+
+	sim_advance(elen * DECODE_USEC_PER_BYTE);
+	if (elen < 12 || (elen%6) != 0) {
+		goto failed;
+	}
+	errcount = golay_decode(6, buf, gout);
+	if (gout[0] != (sim_cfg->netid & 0xFF) || gout[1] != (sim_cfg->netid >> 8)) {
+		goto failed;
+	}
+	if (6*((gout[2]+2)/3+2) != elen) {
+		goto failed;
+	}
+	errcount += golay_decode(6, &buf[6], gout);
+	crc1 = gout[0] | (((uint16_t)gout[1])<<8);
+	if (elen != 12) {
+		errcount += golay_decode(elen-12, &buf[12], buf);
+	}
+	*length = gout[2];
+	crc2 = crc16(*length, buf);
+	if (crc1 != crc2) {
+		goto failed;
+	}
+	if (errcount != 0) {
+		if ((uint16_t)(0xFFFF - errcount) > errors.corrected_errors) {
+			errors.corrected_errors += errcount;
+		} else {
+			errors.corrected_errors = 0xFFFF;
+		}
+		if (errors.corrected_packets != 0xFFFF) {
+			errors.corrected_packets++;
+		}
+	}
+	return true;
+
+failed:
+	if (errors.rx_errors != 0xFFFF) {
+		errors.rx_errors++;
+	}
+	return false;
+}
+
+bool
+radio_transmit_start(uint8_t length, __xdata uint8_t * __pdata buf, uint16_t destination, __pdata uint16_t timeout_ticks)
+{
+	struct sim_result *r = &sim_self->result;
+	struct sim_frame *f;
+	__xdata uint8_t gin[3];
+	uint16_t crc;
+	uint8_t elen, rlen;
+	uint32_t airtime, i;
+
+	// the firmware sends from the free receive slot
+	if (tx_busy || rx_count == RX_SLOTS) {
+		return false;
+	}
+
+	f = frame(sim_world->frame_count);
+	if (sim_world->frame_count >= SIM_MAX_FRAMES) {
+		for (i = 0; i < sim_cfg->nodes; i++) {
+			if (sim_world->node[i].started && !sim_world->node[i].finished &&
+			    !(f->resolved & (1UL << i))) {
+				panic("frame ring overflow");
+			}
+		}
+	}
+
+	f->golay = feature_golay || (feature_adaptive_fec && tx_golay);
+	if (!f->golay) {
+		if (length + (feature_adaptive_fec ? 2 : 0) > SIM_MAX_FRAME_LENGTH) {
+			panic("oversized packet");
+		}
+		memcpy(f->data, buf, length);
+		elen = length;
+		if (feature_adaptive_fec) {
+			crc = crc16(length, buf) ^ sim_cfg->netid;
+			f->data[elen++] = crc & 0xFF;
+			f->data[elen++] = crc >> 8;
+		}
+	} else {
+		if (length > (SIM_MAX_FRAME_LENGTH/2)-6) {
+			panic("oversized golay packet");
+		}
+		rlen = ((length+2)/3)*3;
+		elen = (rlen+6)*2;
+		gin[0] = sim_cfg->netid & 0xFF;
+		gin[1] = sim_cfg->netid >> 8;
+		gin[2] = length;
+		golay_encode(3, gin, f->data);
+		crc = crc16(length, buf);
+		gin[0] = crc&0xFF;
+		gin[1] = crc>>8;
+		gin[2] = length;
+		golay_encode(3, gin, &f->data[6]);
+		golay_encode(rlen, buf, &f->data[12]);
+	}
+
+	sim_tdm_classify(length);
+	rx_event(RX_TRANSMIT);
+	tx_busy = true;
+
+	airtime = frame_usec(elen);
+	if (TURNAROUND_USEC + airtime > timeout_ticks * 16UL) {
+		// the real radio gives up after timeout_ticks
+		r->tx_timeout++;
+		tx_ok = false;
+		tx_done_usec = sim_self->now_usec + timeout_ticks * 16UL;
+		return true;
+	}
+
+	f->start_usec = sim_self->now_usec + TURNAROUND_USEC;
+	f->end_usec = f->start_usec + airtime;
+	f->resolved = 0;
+	f->src = sim_id;
+	f->channel = channel;
+	f->air_rate = settings.air_data_rate;
+	f->dest = destination;
+	f->len = elen;
+	sim_world->frame_count++;
+
+	r->tx_airtime_usec += airtime;
+	tx_ok = true;
+	tx_done_usec = f->end_usec;
+	return true;
+}
+
+bool
+radio_transmit_busy(void)
+{
+	if (tx_busy) {
+		timer2_tick();
+		if (sim_self->now_usec >= tx_done_usec) {
+			tx_busy = false;
+			preamble_cleared_usec = sim_self->now_usec;
+			if (!tx_ok && errors.tx_errors != 0xFFFF) {
+				errors.tx_errors++;
+			}
+		}
+	}
+	return tx_busy;
+}
+
+bool
+radio_transmit_result(void)
+{
+	return tx_ok;
+}
+
+bool
+radio_transmit(uint8_t length, __xdata uint8_t * __pdata buf, uint16_t destination, __pdata uint16_t timeout_ticks)
+{
+	if (!radio_transmit_start(length, buf, destination, timeout_ticks)) {
+		return false;
+	}
+	while (radio_transmit_busy())
+		;
+	return radio_transmit_result();
+}
+
+bool
+radio_receiver_on(void)
+{
+	check_idle("radio_receiver_on");
+	rx_event(RX_ARM);
+	return true;
+}
+
+bool
+radio_preamble_detected(void)
+{
+	uint64_t now = sim_self->now_usec;
+	uint32_t pre = (settings.preamble_length * 4000UL) / settings.air_data_rate + sim_cfg->latency_usec;
+	uint32_t i;
+
+	for (i = sim_world->frame_count; i > next_resolve; i--) {
+		struct sim_frame *f = frame(i - 1);
+		if (f->src != sim_id && f->channel == channel &&
+		    f->start_usec + pre > preamble_cleared_usec &&
+		    f->start_usec + pre <= now) {
+			preamble_cleared_usec = now;
+			return true;
+		}
+	}
+	return false;
+}
+
+bool
+radio_receive_in_progress(void)
+{
+	sim_radio_poll();
+	return rx_count != 0 || frame_in_flight() != NULL;
+}
+
+void
+radio_set_channel(uint8_t c)
+{
+	check_idle("radio_set_channel");
+	if (c != channel) {
+		channel = c;
+		rx_event(RX_ARM);
+	}
+	settings.current_channel = c;
+	preamble_cleared_usec = sim_self->now_usec;
+}
+
+uint8_t
+radio_get_channel(void)
+{
+	return channel;
+}
+
+bool
+radio_configure(__pdata uint8_t air_rate)
+{
+	check_idle("radio_configure");
+	settings.air_data_rate = rates[rate_index(air_rate)];
+	rx_event(RX_ARM);
+	return true;
+}
+
+uint8_t
+radio_next_air_rate(__pdata uint8_t rate, bool faster)
+{
+	uint8_t i = rate_index(rate);
+
+	if (faster) {
+		if (i < ARRAY_LENGTH(rates) - 1) {
+			i++;
+		}
+	} else if (i > 0) {
+		i--;
+	}
+	return rates[i];
+}
+
+uint8_t
+radio_last_rssi(void)
+{
+	return rx_rssi;
+}
+
+uint8_t
+radio_current_rssi(void)
+{
+	if (frame_in_flight() != NULL) {
+		return sim_cfg->rssi;
+	}
+	if (channel < 64 && (sim_cfg->bad_channels & (1ULL << channel))) {
+		return sim_cfg->noise + SIM_BAD_CHANNEL_NOISE;
+	}
+	return sim_cfg->noise;
+}
+
+uint8_t
+radio_air_rate(void)
+{
+	return settings.air_data_rate;
+}
+
+void
+radio_set_transmit_power(uint8_t power)
+{
+	settings.transmit_power = power;
+}
+
+void
+radio_set_transmit_fec(bool golay)
+{
+	tx_golay = golay;
+}
+
+uint8_t
+radio_get_transmit_power(void)
+{
+	return settings.transmit_power;
+}
+
+int16_t
+radio_temperature(void)
+{
+	return 40;
+}
+
+/// every trip through the main loop costs some time, which varies
+/// with what the loop found to do. The node's clock runs fast or
+/// slow by its clock_ppm
+uint16_t
+timer2_tick(void)
+{
+	int64_t now;
+
+	sim_advance(sim_cfg->loop_cost_usec / 2 + sim_random() % (sim_cfg->loop_cost_usec + 1));
+	sim_radio_poll();
+	now = sim_self->now_usec;
+	return (uint16_t)((now + now * sim_self->clock_ppm / 1000000) / 16);
+}
+
+void
+delay_msec(register uint16_t msec)
+{
+	sim_advance(msec * 1000UL);
+}
+
+uint32_t
+constrain(__pdata uint32_t v, __pdata uint32_t min, __pdata uint32_t max)
+{
+	if (v < min) v = min;
+	if (v > max) v = max;
+	return v;
+}
+
+void
+panic(char *fmt, ...)
+{
+	va_list ap;
+
+	fprintf(stderr, "node %u: PANIC: ", (unsigned)sim_id);
+	va_start(ap, fmt);
+	vfprintf(stderr, fmt, ap);
+	va_end(ap);
+	fprintf(stderr, "\n");
+	sim_node_exit(1);
+}
+
+void
+printfl(const char *fmt, ...)
+{
+	va_list ap;
+
+	if (sim_cfg->verbose) {
+		fprintf(stderr, "node %u: ", (unsigned)sim_id);
+		va_start(ap, fmt);
+		vfprintf(stderr, fmt, ap);
+		va_end(ap);
+	}
+}
+
+void
+printf_start_capture(__xdata uint8_t *buf, uint8_t size)
+{
+}
+
+uint8_t
+printf_end_capture(void)
+{
+	return 0;
+}
+
+void
+param_print(__data uint8_t id)
+{
+}
+
+/// the simulated radio has no measured timing, so the formula is used
+__xdata struct param_timing *
+param_timing_find(__pdata uint8_t air_rate)
+{
+	return NULL;
+}
+
+void
+param_timing_set(__pdata uint8_t air_rate, __pdata uint8_t ecc,
+		 __pdata uint16_t packet_latency, __pdata uint16_t ticks_per_byte)
+{
+}
+
+void
+at_command(void)
+{
+	at_cmd_ready = false;
+}
+
+void
+at_input(register uint8_t c)
+{
+}
+
+void
+at_plus_detector(register uint8_t c)
+{
+}
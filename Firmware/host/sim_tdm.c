@@ -0,0 +1,73 @@
+// -*- Mode: C; c-basic-offset: 8; -*-
+//
+// Copyright (c) 2014 SiK Multipoint Developers, All Rights Reserved
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+//  o Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  o Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in
+//    the documentation and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+// INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+// OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+
+///
+/// @file	sim_tdm.c
+///
+/// tdm.c built for the simulator, with accessors for the state the
+/// simulator reports on.
+///
+
+#include "tdm_sim.h"
+#include "tdm.c"
+
+bool
+sim_tdm_synced(void)
+{
+	return nodeId == BASE_NODEID || (sync_count >= SYNC_CONFIRM && base_synced);
+}
+
+int16_t
+sim_tdm_clock_drift(void)
+{
+	return clock_drift;
+}
+
+/// count a packet tdm_serial_loop() is about to send
+void
+sim_tdm_classify(uint8_t length)
+{
+	struct sim_result *r = &sim_self->result;
+	uint8_t len = length - trailer_len;
+
+	r->tx_packets++;
+	if (tdm_state == TDM_SYNC && nodeId == BASE_NODEID) {
+		r->tx_sync++;
+	} else if (trailer.window == 0) {
+		r->tx_stats++;
+	} else if (len == 0) {
+		r->tx_yield++;
+	} else if (!trailer.command) {
+		r->tx_data_bytes += len;
+		if (trailer.bonus) {
+			r->tx_bonus++;
+			r->tx_bonus_bytes += len;
+		}
+	}
+}
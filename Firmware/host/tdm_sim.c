@@ -0,0 +1,472 @@
+// -*- Mode: C; c-basic-offset: 8; -*-
+//
+// Copyright (c) 2014 SiK Multipoint Developers, All Rights Reserved
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+//  o Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  o Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in
+//    the documentation and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+// INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+// OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+
+///
+/// @file	tdm_sim.c
+///
+/// Discrete event simulator for a network of SiK Multipoint nodes.
+///
+/// Runs the real TDM, packet, frequency hopping and serial code for up
+/// to SIM_MAX_NODES nodes against a simulated radio channel and serial
+/// hosts, and reports sync time, throughput, latency and loss for each
+/// node. See tdm_sim.h for how the nodes are scheduled.
+///
+
+#include <getopt.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "tdm_sim.h"
+
+static void
+usage(void)
+{
+	fprintf(stderr,
+		"usage: tdm_sim [options]\n"
+		"  -n nodes       number of nodes, node 0 is the base (3)\n"
+		"  -t seconds     how long to run each node for (20)\n"
+		"  -a kbps        air speed (64)\n"
+		"  -x kbps        adaptive air rate, down to kbps (0, fixed)\n"
+		"  -u speed       serial speed, as SERIAL_SPEED (57)\n"
+		"  -c channels    number of hopping channels (10)\n"
+		"  -H channels    most channels adaptive hopping may leave out (0, off)\n"
+		"  -K rounds      rounds between syncs (1)\n"
+		"  -B c1,c2,...   channels with interference, more bit errors and noise\n"
+		"  -e             golay error correction\n"
+		"  -E             golay error correction chosen per packet (ECC=2)\n"
+		"  -M             transparent mode, no MAVLink framing\n"
+		"  -P             MAVLink priority scheduling (MAVLINK=2)\n"
+		"  -F             SLIP framed traffic and SLIP framing (MAVLINK=3)\n"
+		"  -o             opportunistic resend\n"
+		"  -D             demand assigned slots\n"
+		"  -A             ARQ\n"
+		"  -Z             compress MAVLink headers over the air\n"
+		"  -g bytes       serial gap that ends a transparent mode packet (0)\n"
+		"  -f             RTS/CTS flow control on the serial port\n"
+		"  -w w0,w1,...   per node window weights\n"
+		"  -d percent     duty cycle (100)\n"
+		"  -L rssi        listen before talk threshold (0)\n"
+		"  -r bytes/s     offered serial load per node (500)\n"
+		"  -R node=bytes/s  offered load for one node\n"
+		"  -m bytes       MAVLink payload length (40)\n"
+		"  -C n           every nth message is a COMMAND_LONG (0, none)\n"
+		"  -2             send MAVLink 2 frames\n"
+		"  -S             send signed MAVLink 2 frames\n"
+		"  -l fraction    random frame loss (0)\n"
+		"  -b rate        bit error rate (0)\n"
+		"  -T usec        extra delivery latency on the channel (0)\n"
+		"  -N rssi        background noise level, for LBT (30)\n"
+		"  -j usec        time taken by each trip through the main loop (20)\n"
+		"  -p ppm         node clocks are out by up to this (0)\n"
+		"  -s seed        random seed (1)\n"
+		"  -k             check mode: fail unless every node syncs and delivers\n"
+		"  -v             show firmware debug output\n");
+	exit(2);
+}
+
+static void
+parse_weights(const char *s)
+{
+	uint8_t i = 0;
+	char *end;
+
+	while (*s && i < SIM_MAX_NODES) {
+		sim_cfg->weights[i++] = strtoul(s, &end, 0);
+		if (*end != ',' && *end != 0) {
+			usage();
+		}
+		s = *end ? end + 1 : end;
+	}
+}
+
+static void
+parse_channels(const char *s)
+{
+	unsigned long c;
+	char *end;
+
+	while (*s) {
+		c = strtoul(s, &end, 0);
+		if ((*end != ',' && *end != 0) || c >= 64) {
+			usage();
+		}
+		sim_cfg->bad_channels |= 1ULL << c;
+		s = *end ? end + 1 : end;
+	}
+}
+
+static void
+report(bool check)
+{
+	uint8_t i, j, nodes = sim_cfg->nodes;
+	double secs = sim_cfg->duration_usec / 1e6;
+	int failed = 0;
+
+	printf("%u nodes, %u kbps air, %u channels, %s%s%s%s%s%s, MAVLink %u%s traffic, %.0f s\n",
+	       nodes, sim_cfg->air_speed, sim_cfg->num_channels,
+	       sim_cfg->slip ? "SLIP" :
+	       sim_cfg->mavlink ? (sim_cfg->mavlink_priority ? "MAVLink priority" : "MAVLink") : "transparent",
+	       sim_cfg->ecc ? " golay" : sim_cfg->adaptive_fec ? " adaptive golay" : "",
+	       sim_cfg->oppresend ? " oppresend" : "",
+	       sim_cfg->demand_slots ? " demand" : "",
+	       sim_cfg->arq ? " ARQ" : "",
+	       sim_cfg->compress ? " compress" : "",
+	       sim_cfg->msg_version, sim_cfg->msg_signed ? " signed" : "",
+	       secs);
+	printf("node  sync(s) lost  offered  tx B/s  sent B/s  recv B/s  p50/p90/p99/max ms       "
+	       "pkts bonus yield stats  coll miss over lost err\n");
+
+	for (i = 0; i < nodes; i++) {
+		struct sim_result *r = &sim_world->node[i].result;
+		uint32_t rx_bytes = 0, delivered = 0, wanted = 0;
+
+		for (j = 0; j < nodes; j++) {
+			rx_bytes += r->rx_bytes[j];
+			if (j != i) {
+				// what the others got of ours. Nodes send to the base,
+				// the base broadcasts
+				if (i == 0 || j == 0) {
+					delivered += sim_world->node[j].result.rx_msgs[i];
+					wanted++;
+				}
+			}
+		}
+
+		if (r->sync_usec == SIM_NEVER) {
+			printf("%4u    never", i);
+		} else {
+			printf("%4u %8.2f", i, r->sync_usec / 1e6);
+		}
+		printf(" %4u %8u %7.0f %9.0f %9.0f ",
+		       r->sync_lost, r->msgs_offered, r->tx_data_bytes / secs,
+		       (wanted ? (double)delivered / wanted : 0) * (sim_cfg->msg_len + SIM_MSG_OVERHEAD) / secs,
+		       rx_bytes / secs);
+		if (r->latency_count) {
+			printf("%6.1f/%6.1f/%6.1f/%6.1f",
+			       r->latency_usec[0] / 1e3, r->latency_usec[1] / 1e3,
+			       r->latency_usec[2] / 1e3, r->latency_usec[3] / 1e3);
+		} else {
+			printf("%27s", "-");
+		}
+		printf(" %6u %5u %5u %5u %5u %4u %4u %4u %3u\n",
+		       r->tx_packets, r->tx_bonus, r->tx_yield, r->tx_stats,
+		       r->rx_collisions, r->rx_missed, r->rx_overrun, r->rx_lost,
+		       r->rx_errors);
+
+		if (sim_cfg->adaptive_rate != 0) {
+			printf("      air rate %u kbps at the end\n", r->air_rate);
+		}
+		if (sim_cfg->clock_ppm != 0) {
+			printf("      clock %+d ppm, drift found %+.0f ppm\n",
+			       sim_world->node[i].clock_ppm, r->clock_drift * 1e6 / 1048576);
+		}
+		if (r->cmd_latency_count) {
+			printf("      %u commands p50/p90/p99/max ms %.1f/%.1f/%.1f/%.1f\n",
+			       r->cmd_latency_count,
+			       r->cmd_latency_usec[0] / 1e3, r->cmd_latency_usec[1] / 1e3,
+			       r->cmd_latency_usec[2] / 1e3, r->cmd_latency_usec[3] / 1e3);
+		}
+
+		if (!sim_world->node[i].finished) {
+			printf("      node %u did not finish\n", i);
+			failed++;
+		} else if (check && (r->sync_usec == SIM_NEVER ||
+				     (sim_cfg->rate[i] != 0 && delivered == 0))) {
+			printf("      node %u %s\n", i,
+			       r->sync_usec == SIM_NEVER ? "never synced" : "delivered nothing");
+			failed++;
+		}
+		if (r->rx_duplicates || r->rx_garbage || r->msgs_dropped ||
+		    r->tx_timeout || r->serial_rx_overflow || r->serial_tx_overflow) {
+			printf("      duplicates %u garbage %u dropped %u tx timeout %u "
+			       "serial overflow rx %u tx %u\n",
+			       r->rx_duplicates, r->rx_garbage, r->msgs_dropped, r->tx_timeout,
+			       r->serial_rx_overflow, r->serial_tx_overflow);
+		}
+	}
+	if (failed) {
+		exit(1);
+	}
+}
+
+int
+main(int argc, char *argv[])
+{
+	pid_t pid[SIM_MAX_NODES], done;
+	uint32_t rate = 500, seed = 1;
+	bool check = false, rate_set[SIM_MAX_NODES];
+	uint8_t i, first;
+	int c, status, crashed = 0;
+	char *eq;
+
+	sim_world = mmap(NULL, sizeof(*sim_world), PROT_READ | PROT_WRITE,
+			 MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+	if (sim_world == MAP_FAILED) {
+		perror("mmap");
+		return 1;
+	}
+	memset(sim_world, 0, sizeof(*sim_world));
+
+	sim_cfg->nodes = 3;
+	sim_cfg->sync_rounds = 1;
+	sim_cfg->air_speed = 64;
+	sim_cfg->serial_speed = 57;
+	sim_cfg->num_channels = 10;
+	sim_cfg->netid = 25;
+	sim_cfg->mavlink = true;
+	memset(sim_cfg->weights, 1, sizeof(sim_cfg->weights));
+	sim_cfg->duty_cycle = 100;
+	sim_cfg->duration_usec = 20000000ULL;
+	sim_cfg->start_spread_usec = 2000000ULL;
+	sim_cfg->loop_cost_usec = 20;
+	sim_cfg->rssi = 120;
+	sim_cfg->noise = 30;
+	sim_cfg->msg_len = 40;
+	sim_cfg->msg_version = 1;
+	memset(rate_set, 0, sizeof(rate_set));
+
+	while ((c = getopt(argc, argv, "n:t:a:x:u:c:H:K:B:eEMPFoDAZg:fw:d:L:r:R:m:C:2Sl:b:T:N:j:p:s:kv")) != -1) {
+		switch (c) {
+		case 'n':
+			sim_cfg->nodes = atoi(optarg);
+			if (sim_cfg->nodes < 2 || sim_cfg->nodes > SIM_MAX_NODES) {
+				usage();
+			}
+			break;
+		case 't':
+			sim_cfg->duration_usec = atof(optarg) * 1e6;
+			break;
+		case 'a':
+			sim_cfg->air_speed = atoi(optarg);
+			break;
+		case 'x':
+			sim_cfg->adaptive_rate = atoi(optarg);
+			break;
+		case 'u':
+			sim_cfg->serial_speed = atoi(optarg);
+			break;
+		case 'c':
+			sim_cfg->num_channels = atoi(optarg);
+			if (sim_cfg->num_channels == 0) {
+				usage();
+			}
+			break;
+		case 'H':
+			sim_cfg->adaptive_hop = atoi(optarg);
+			break;
+		case 'K':
+			sim_cfg->sync_rounds = atoi(optarg);
+			if (sim_cfg->sync_rounds < 1 || sim_cfg->sync_rounds > 16) {
+				usage();
+			}
+			break;
+		case 'B':
+			parse_channels(optarg);
+			break;
+		case 'e':
+			sim_cfg->ecc = true;
+			break;
+		case 'E':
+			sim_cfg->adaptive_fec = true;
+			break;
+		case 'M':
+			sim_cfg->mavlink = false;
+			break;
+		case 'P':
+			sim_cfg->mavlink_priority = true;
+			break;
+		case 'F':
+			sim_cfg->slip = true;
+			sim_cfg->mavlink = false;
+			break;
+		case 'o':
+			sim_cfg->oppresend = true;
+			break;
+		case 'D':
+			sim_cfg->demand_slots = true;
+			break;
+		case 'A':
+			sim_cfg->arq = true;
+			break;
+		case 'Z':
+			sim_cfg->compress = true;
+			break;
+		case 'g':
+			sim_cfg->serial_gap = atoi(optarg);
+			break;
+		case 'f':
+			sim_cfg->rtscts = true;
+			break;
+		case 'w':
+			parse_weights(optarg);
+			break;
+		case 'd':
+			sim_cfg->duty_cycle = atoi(optarg);
+			break;
+		case 'L':
+			sim_cfg->lbt_rssi = atoi(optarg);
+			break;
+		case 'r':
+			rate = atoi(optarg);
+			break;
+		case 'R':
+			eq = strchr(optarg, '=');
+			if (eq == NULL || atoi(optarg) >= SIM_MAX_NODES) {
+				usage();
+			}
+			sim_cfg->rate[atoi(optarg)] = atoi(eq + 1);
+			rate_set[atoi(optarg)] = true;
+			break;
+		case 'm':
+			sim_cfg->msg_len = atoi(optarg);
+			if (sim_cfg->msg_len < 4) {
+				usage();
+			}
+			break;
+		case '2':
+			sim_cfg->msg_version = 2;
+			break;
+		case 'S':
+			sim_cfg->msg_version = 2;
+			sim_cfg->msg_signed = true;
+			break;
+		case 'C':
+			sim_cfg->cmd_every = atoi(optarg);
+			break;
+		case 'l':
+			sim_cfg->loss = atof(optarg);
+			break;
+		case 'b':
+			sim_cfg->ber = atof(optarg);
+			break;
+		case 'T':
+			sim_cfg->latency_usec = atoi(optarg);
+			break;
+		case 'N':
+			sim_cfg->noise = atoi(optarg);
+			break;
+		case 'j':
+			sim_cfg->loop_cost_usec = atoi(optarg);
+			break;
+		case 'p':
+			sim_cfg->clock_ppm = atoi(optarg);
+			break;
+		case 's':
+			seed = strtoul(optarg, NULL, 0);
+			break;
+		case 'k':
+			check = true;
+			break;
+		case 'v':
+			sim_cfg->verbose = true;
+			break;
+		default:
+			usage();
+		}
+	}
+	if (optind != argc) {
+		usage();
+	}
+	if (sim_cfg->lbt_rssi != 0 && sim_cfg->lbt_rssi <= sim_cfg->noise) {
+		// the channel never sounds clear, so no node would transmit
+		fprintf(stderr, "LBT threshold %u is not above the noise level %u\n",
+			(unsigned)sim_cfg->lbt_rssi, (unsigned)sim_cfg->noise);
+		return 1;
+	}
+	sim_cfg->seed = seed;
+	for (i = 0; i < SIM_MAX_NODES; i++) {
+		if (!rate_set[i]) {
+			sim_cfg->rate[i] = rate;
+		}
+	}
+
+	// power the nodes up at random times
+	srand(seed);
+	first = 0;
+	for (i = 0; i < sim_cfg->nodes; i++) {
+		sem_init(&sim_world->node[i].run, 1, 0);
+		sim_world->node[i].now_usec = rand() % sim_cfg->start_spread_usec;
+		if (sim_world->node[i].now_usec < sim_world->node[first].now_usec) {
+			first = i;
+		}
+	}
+	// and give their clocks an error
+	if (sim_cfg->clock_ppm != 0) {
+		for (i = 0; i < sim_cfg->nodes; i++) {
+			sim_world->node[i].clock_ppm = (int32_t)(rand() % (2*sim_cfg->clock_ppm + 1)) - sim_cfg->clock_ppm;
+		}
+	}
+	sim_world->end_usec = sim_cfg->start_spread_usec + sim_cfg->duration_usec;
+
+	fflush(stdout);
+	for (i = 0; i < sim_cfg->nodes; i++) {
+		pid[i] = fork();
+		if (pid[i] == -1) {
+			perror("fork");
+			return 1;
+		}
+		if (pid[i] == 0) {
+			sim_node_run(i);
+		}
+	}
+	sem_post(&sim_world->node[first].run);
+
+	for (i = 0; i < sim_cfg->nodes; i++) {
+		done = wait(&status);
+		if (done == -1) {
+			perror("wait");
+			return 1;
+		}
+		if (WIFEXITED(status) && WEXITSTATUS(status) == 0) {
+			continue;
+		}
+		for (c = 0; c < sim_cfg->nodes; c++) {
+			if (pid[c] == done) {
+				fprintf(stderr, "node %u failed\n", c);
+			}
+		}
+		crashed++;
+		if (!WIFEXITED(status)) {
+			// it died holding the clock, the rest would wait forever
+			for (c = 0; c < sim_cfg->nodes; c++) {
+				if (pid[c] != done) {
+					kill(pid[c], SIGKILL);
+				}
+			}
+		}
+	}
+
+	report(check);
+	return crashed ? 1 : 0;
+}
@@ -0,0 +1,224 @@
+// -*- Mode: C; c-basic-offset: 8; -*-
+//
+// Copyright (c) 2014 SiK Multipoint Developers, All Rights Reserved
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+//  o Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  o Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in
+//    the documentation and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+// INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+// OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+///
+/// @file	tdm_sim.h
+///
+/// Shared state of the host TDM network simulator
+///
+/// Every virtual node is a forked process running the real tdm.c,
+/// packet.c, freq_hopping.c and serial.c against the stub radio and
+/// timer in sim_radio.c. The firmware keeps all of its state in
+/// globals, so a process per node is the simplest way to get N copies.
+///
+/// Only one node process runs at a time. A node runs until its virtual
+/// clock gets more than SIM_LOOKAHEAD_USEC ahead of the slowest node,
+/// then hands over to the slowest node. Radio frames are shared through
+/// the frame ring in struct sim_world, which lives in shared memory.
+///
+
+#ifndef _TDM_SIM_H_
+#define _TDM_SIM_H_
+
+#include <semaphore.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#define SIM_MAX_NODES		32
+#define SIM_MAX_FRAMES		256
+#define SIM_MAX_FRAME_LENGTH	252
+
+/// how many recent messages per node are tracked for latency and duplicates
+#define SIM_MSG_WINDOW		1024
+
+/// how far a node may run ahead of the slowest node. Frames are only
+/// resolved this long after they end, so every node has seen them
+#define SIM_LOOKAHEAD_USEC	64
+
+#define SIM_NEVER		UINT64_MAX
+
+/// MAVLink message ids the traffic generator sends
+#define SIM_MSG_TELEMETRY	250
+#define SIM_MSG_COMMAND		76	///< COMMAND_LONG
+
+/// their CRC_EXTRA seeds
+#define SIM_MSG_CRC_EXTRA(_msgid) ((_msgid) == SIM_MSG_COMMAND ? 152 : 49)
+
+/// bytes of each generated message besides the payload
+#define SIM_MSG_OVERHEAD	(sim_cfg->msg_version == 1 ? 8 : sim_cfg->msg_signed ? 12+13 : 12)
+
+/// simulation settings, the same for every node unless noted
+struct sim_config {
+	uint8_t		nodes;
+	uint8_t		air_speed;		///< kbps, as PARAM_AIR_SPEED
+	uint8_t		adaptive_rate;		///< as PARAM_ADAPTIVE_RATE
+	uint8_t		adaptive_hop;		///< as PARAM_ADAPTIVE_HOP
+	uint8_t		sync_rounds;		///< as PARAM_SYNC_ROUNDS
+	uint8_t		serial_speed;		///< as PARAM_SERIAL_SPEED
+	uint8_t		num_channels;
+	uint16_t	netid;
+	bool		ecc;
+	bool		adaptive_fec;		///< ECC=2
+	bool		mavlink;
+	bool		mavlink_priority;	///< MAVLINK=2
+	bool		slip;			///< SLIP framed traffic, MAVLINK=3
+	bool		oppresend;
+	bool		rtscts;
+	bool		demand_slots;
+	bool		arq;
+	bool		compress;
+	uint8_t		serial_gap;		///< as PARAM_SERIAL_GAP
+	uint8_t		weights[SIM_MAX_NODES];
+	uint8_t		duty_cycle;
+	uint8_t		lbt_rssi;
+
+	uint64_t	duration_usec;		///< how long each node runs
+	uint64_t	start_spread_usec;	///< nodes power up randomly within this
+	uint32_t	loop_cost_usec;		///< cost of each timer2_tick() call
+	uint32_t	seed;
+	uint16_t	clock_ppm;		///< nodes' clocks are out by up to this
+
+	// channel model
+	double		loss;			///< random frame loss probability
+	double		ber;			///< bit error rate of on air bytes
+	uint64_t	bad_channels;		///< bit per channel with interference
+	uint32_t	latency_usec;		///< extra delivery delay
+	uint8_t		rssi;			///< received signal strength
+	uint8_t		noise;			///< background noise level
+
+	// traffic model
+	uint32_t	rate[SIM_MAX_NODES];	///< offered serial load, bytes/s
+	uint8_t		msg_len;		///< MAVLink payload length
+	uint16_t	cmd_every;		///< every nth message is a COMMAND_LONG
+	uint8_t		msg_version;		///< MAVLink 1 or 2 framing
+	bool		msg_signed;		///< MAVLink 2 frames carry a signature
+	bool		verbose;
+};
+
+/// per node results, filled in by the node when it finishes
+struct sim_result {
+	uint64_t	start_usec;
+	uint64_t	sync_usec;		///< from power up to first sync, or SIM_NEVER
+	uint32_t	sync_lost;
+
+	// serial side
+	uint32_t	msgs_offered;
+	uint32_t	msgs_dropped;		///< could not be written to the UART
+	uint32_t	rx_msgs[SIM_MAX_NODES];	///< messages received from each node
+	uint32_t	rx_bytes[SIM_MAX_NODES];
+	uint32_t	rx_duplicates;
+	uint32_t	rx_garbage;		///< bytes out of the serial port not in a valid message
+	uint32_t	latency_count;
+	uint32_t	latency_usec[5];	///< p50, p90, p99, max, mean
+	uint32_t	cmd_latency_count;
+	uint32_t	cmd_latency_usec[5];	///< the same for COMMAND_LONG messages
+
+	// radio side
+	uint32_t	tx_packets;
+	uint32_t	tx_data_bytes;
+	uint32_t	tx_bonus;		///< packets sent in someone else's window
+	uint32_t	tx_bonus_bytes;
+	uint32_t	tx_yield;		///< zero length packets giving our window away
+	uint32_t	tx_stats;
+	uint32_t	tx_sync;
+	uint32_t	tx_timeout;
+	uint64_t	tx_airtime_usec;
+	uint32_t	rx_packets;
+	uint32_t	rx_collisions;
+	uint32_t	rx_missed;		///< receiver reset, busy or off channel part way
+	uint32_t	rx_overrun;		///< previous packet not collected yet
+	uint32_t	rx_lost;		///< random channel loss
+	uint32_t	rx_errors;
+	uint32_t	corrected_errors;
+	uint32_t	corrected_packets;
+	uint32_t	serial_tx_overflow;
+	uint32_t	serial_rx_overflow;
+	uint8_t		air_rate;		///< at the end, it can change with -x
+	int16_t		clock_drift;		///< what the node found, 1/2^20
+};
+
+/// a frame on the air
+struct sim_frame {
+	uint64_t	start_usec, end_usec;
+	uint32_t	resolved;		///< bit per node that has dealt with it
+	uint8_t		src;
+	uint8_t		channel;
+	uint8_t		air_rate;		///< only receivers at the same rate hear it
+	bool		golay;			///< as the FEC header byte says
+	uint16_t	dest;
+	uint8_t		len;
+	uint8_t		data[SIM_MAX_FRAME_LENGTH];
+};
+
+struct sim_node {
+	sem_t		run;
+	uint64_t	now_usec;
+	int32_t		clock_ppm;		///< how fast its timer2 runs
+	bool		started;
+	bool		finished;
+	struct sim_result result;
+};
+
+struct sim_world {
+	struct sim_config config;
+	uint64_t	end_usec;
+	uint32_t	frame_count;
+	struct sim_frame frames[SIM_MAX_FRAMES];
+	struct sim_node	node[SIM_MAX_NODES];
+
+	/// when the last byte of each message went into the sending radio
+	uint64_t	input_usec[SIM_MAX_NODES][SIM_MSG_WINDOW];
+};
+
+/// the shared world, and the node this process is running
+extern struct sim_world *sim_world;
+extern uint8_t sim_id;
+
+#define sim_self	(&sim_world->node[sim_id])
+#define sim_cfg		(&sim_world->config)
+
+// sim_node.c
+extern void sim_node_run(uint8_t id);
+extern void sim_advance(uint32_t usec);
+extern void sim_node_exit(int status);
+extern uint32_t sim_random(void);
+extern double sim_random_double(void);
+
+// sim_radio.c
+extern void sim_radio_init(void);
+extern void sim_radio_poll(void);
+
+// sim_tdm.c
+extern bool sim_tdm_synced(void);
+extern void sim_tdm_classify(uint8_t length);
+extern int16_t sim_tdm_clock_drift(void);
+
+// sim_serial.c
+extern bool sim_serial_isr(void);
+
+#endif // _TDM_SIM_H_
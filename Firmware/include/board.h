@@ -90,6 +90,12 @@
 ///	to indicate to the serial device at the other end that
 ///	the local serial buffer is nearly full.
 ///
+/// TX_FIFO_THRESHOLD_LOW	[optional]
+///	Radio TX FIFO almost empty threshold. Each time the FIFO drains
+///	to this level the radio interrupt tops it up with 64 minus this
+///	many bytes, so a lower value means fewer, larger refills but
+///	less time to service the interrupt before the FIFO underruns.
+///
 
 #ifndef _BOARD_H_
 #define _BOARD_H_
@@ -61,6 +61,7 @@ static void	at_error(void);
 static void	at_i(void);
 static void	at_s(void);
 static void	at_p(void);
+static void	at_w(void);
 static void	at_ampersand(void);
 static void	at_plus(void);
 
@@ -295,6 +296,9 @@ at_command(void)
 			case 'S':
 				at_s();
 				break;
+			case 'W':
+				at_w();
+				break;
 
 			case 'Z':
 				// generate a software reset
@@ -409,6 +413,45 @@ at_s(void)
 	at_error();
 }
 
+static void
+at_w(void)
+{
+	__pdata uint8_t		node;
+	__pdata uint32_t	val;
+
+	// ATW? lists the weights of all the nodes
+	if (at_cmd[3] == '?') {
+		for (node = 0; node < MAX_SLOT_NODES && node < param_get(PARAM_NODECOUNT); node++) {
+			printf("[%u] W%u=%u\n", nodeId, (unsigned)node, (unsigned)param_get_weight(node));
+		}
+		return;
+	}
+
+	// get the node id first
+	idx = 3;
+	node = at_parse_number();
+	if (node >= MAX_SLOT_NODES) {
+		at_error();
+		return;
+	}
+
+	switch (at_cmd[idx]) {
+	case '?':
+		printf("[%u] %u\n", nodeId, (unsigned)param_get_weight(node));
+		return;
+
+	case '=':
+		idx++;
+		val = at_parse_number();
+		if (param_set_weight(node, val)) {
+			at_ok();
+			return;
+		}
+		break;
+	}
+	at_error();
+}
+
 static void
 at_ampersand(void)
 {
@@ -443,6 +486,15 @@ at_ampersand(void)
 		} else if (!strcmp(at_cmd + 4, "=TDM")) {
 			// display TDM debug
 			at_testmode ^= AT_TEST_TDM;
+		} else if (!strcmp(at_cmd + 4, "=TIMING")) {
+			// measure packet timing for tdm_init(), kept by AT&W
+			tdm_calibrate_timing();
+		} else if (!strcmp(at_cmd + 4, "=FIFO")) {
+			// count TX FIFO errors at each air rate
+			tdm_fifo_test();
+		} else if (!strcmp(at_cmd + 4, "=CRC")) {
+			// time the table and CRC0 engine CRC
+			tdm_crc_test();
 		} else {
 			at_error();
 		}
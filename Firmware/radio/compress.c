@@ -0,0 +1,188 @@
+// -*- Mode: C; c-basic-offset: 8; -*-
+//
+// Copyright (c) 2014 SiK Multipoint Developers, All Rights Reserved
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+//  o Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  o Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in
+//    the documentation and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+// INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+// OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+///
+/// @file	compress.c
+///
+/// Compression of packets over the air
+///
+
+#include "radio.h"
+#include "compress.h"
+#include "mavlink.h"
+
+// A compressed packet is a series of records, each starting with a
+// tag byte:
+//
+//   0x00		the rest of the packet is raw bytes
+//   0x01-0x7F		that many literal bytes follow
+//   1xxxxxx0		a MAVLink frame, see mavlink_frame_encode()
+//   1nnnnnn1 ofs	a copy of n+3 bytes from offset ofs of this packet
+//
+// Copies come from earlier in the compressed packet rather than from
+// what has been decompressed so far, so neither end needs a history
+// window and a lost packet doesn't stop the next one being
+// decompressed. Repeated NMEA fields and sensor words within a packet
+// still find each other, as they are sent as literals first
+#define TAG_RAW		0x00
+#define TAG_LITERAL_MAX	0x7F
+#define TAG_COPY	0x81
+#define COPY_MIN	3
+#define COPY_MAX	(0x3F + COPY_MIN)
+
+// the offset of the last literal bytes seen with each hash of
+// COPY_MIN bytes
+#define HASH_SIZE	64
+#define HASH_EMPTY	0xFF
+#define HASH(_p)	((uint8_t)((_p)[0] ^ ((_p)[1]<<2) ^ ((_p)[2]<<4) ^ ((_p)[2]>>3)) & (HASH_SIZE-1))
+
+static __xdata uint8_t copy_hash[HASH_SIZE];
+
+uint8_t
+compress_packet(__xdata uint8_t * __pdata in, __pdata uint8_t len, __xdata uint8_t * __pdata out)
+{
+	__xdata uint8_t * __pdata p;
+	__pdata uint16_t n;
+	__pdata uint8_t i, o, run, lit, src;
+	register uint8_t m;
+
+	mavlink_frame_reset();
+	memset(copy_hash, HASH_EMPTY, sizeof(copy_hash));
+	i = o = run = lit = 0;
+
+	// nothing is written past len, so anything that doesn't fit
+	// wasn't worth compressing
+	while (i < len) {
+		p = &in[i];
+
+		// is there a whole MAVLink 1.0 or 2 frame here?
+		n = 0;
+		if (feature_mavlink_framing &&
+		    (p[0] == MAVLINK10_STX || p[0] == MAVLINK20_STX) &&
+		    i + MAVLINK_LENGTH_BYTES(p[0]) <= len) {
+			n = mavlink_frame_length(p[0], p[1], p[0] == MAVLINK20_STX ? p[2] : 0);
+			if (i + n > len) {
+				n = 0;
+			}
+		}
+		if (n != 0) {
+			m = mavlink_frame_encode(p, n, &out[o], len - o);
+			if (m == 0) {
+				goto uncompressed;
+			}
+			o += m;
+			i += n;
+			lit = 0;
+			continue;
+		}
+
+		// can we copy it from earlier in the packet?
+		if (i + COPY_MIN <= len) {
+			src = copy_hash[HASH(p)];
+			if (src != HASH_EMPTY &&
+			    out[src] == p[0] && out[src+1] == p[1] && out[src+2] == p[2]) {
+				m = COPY_MIN;
+				while (m < COPY_MAX && i + m < len && src + m < o &&
+				       out[src+m] == p[m]) {
+					m++;
+				}
+				if (o + 2 > len) {
+					goto uncompressed;
+				}
+				out[o++] = TAG_COPY | ((m - COPY_MIN) << 1);
+				out[o++] = src;
+				i += m;
+				lit = 0;
+				continue;
+			}
+		}
+
+		// a literal byte, in a new run if need be
+		if (lit == 0 || lit == TAG_LITERAL_MAX) {
+			if (o + 2 > len) {
+				goto uncompressed;
+			}
+			run = o++;
+			lit = 0;
+		} else if (o + 1 > len) {
+			goto uncompressed;
+		}
+		out[o++] = in[i++];
+		out[run] = ++lit;
+		if (lit >= COPY_MIN) {
+			copy_hash[HASH(&out[o-COPY_MIN])] = o - COPY_MIN;
+		}
+	}
+	return o;
+
+uncompressed:
+	out[0] = TAG_RAW;
+	memcpy(&out[1], in, len);
+	return len + 1;
+}
+
+void
+decompress_packet(__xdata uint8_t * __pdata buf, __pdata uint8_t len)
+{
+	__pdata uint8_t i, n;
+	register uint8_t tag;
+
+	mavlink_frame_reset();
+	i = 0;
+	while (i < len) {
+		tag = buf[i];
+		if (tag == TAG_RAW) {
+			serial_write_buf(&buf[i+1], len - (i+1));
+			return;
+		}
+		if (tag <= TAG_LITERAL_MAX) {
+			if (i + 1 + tag > len) {
+				return;
+			}
+			serial_write_buf(&buf[i+1], tag);
+			i += 1 + tag;
+		} else if (MAVLINK_IS_TAG(tag)) {
+			n = mavlink_frame_decode(&buf[i], len - i);
+			if (n == 0) {
+				return;
+			}
+			i += n;
+		} else {
+			// a copy can only come from before its own tag
+			if (i + 2 > len) {
+				return;
+			}
+			n = ((tag >> 1) & 0x3F) + COPY_MIN;
+			if (buf[i+1] + n > i) {
+				return;
+			}
+			serial_write_buf(&buf[buf[i+1]], n);
+			i += 2;
+		}
+	}
+}
@@ -0,0 +1,57 @@
+// -*- Mode: C; c-basic-offset: 8; -*-
+//
+// Copyright (c) 2014 SiK Multipoint Developers, All Rights Reserved
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+//  o Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  o Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in
+//    the documentation and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+// INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+// OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+///
+/// @file	compress.h
+///
+/// Compression of packets over the air
+///
+
+#ifndef _COMPRESS_H_
+#define _COMPRESS_H_
+
+/// compress a packet for sending over the air. The output is at most
+/// one byte longer than the input
+///
+/// @param in			the packet as read from the serial port
+/// @param len			its length
+/// @param out			buffer for the compressed packet
+///
+/// @return			the length of the compressed packet
+///
+extern uint8_t compress_packet(__xdata uint8_t * __pdata in, __pdata uint8_t len, __xdata uint8_t * __pdata out);
+
+/// decompress a packet from compress_packet(), and write it to the
+/// serial port
+///
+/// @param buf			the compressed packet
+/// @param len			its length
+///
+extern void decompress_packet(__xdata uint8_t * __pdata buf, __pdata uint8_t len);
+
+#endif // _COMPRESS_H_
@@ -79,10 +79,12 @@ static __code uint8_t crc_tab2[256] =
 };
 
 
-// calculate the CRC16 of a buffer
+bool crc_hardware;
+
+// calculate the CRC16 of a buffer from the tables
 // this costs about 2.2 microseconds per byte
-uint16_t 
-crc16(__data uint8_t n, __xdata uint8_t * __data buf)
+static uint16_t
+crc16_table(__data uint8_t n, __xdata uint8_t * __data buf)
 {
 	register uint8_t k;
 	register uint8_t high, low;
@@ -102,3 +104,72 @@ crc16(__data uint8_t n, __xdata uint8_t * __data buf)
 	}
 	return (((uint16_t)high)<<8) | low;
 }
+
+#ifdef SFR_CRC0CN
+// The CRC0 engine gives the usual CRC-CCITT, M(x).x^16 mod P(x), where
+// the tables give M(x) mod P(x). They only differ by the last two
+// bytes, so the engine's CRC of the rest with those two bytes XORed
+// in is the same as the tables give, and nothing already sent or
+// saved in flash changes
+
+// calculate the CRC-CCITT of a buffer with the CRC0 engine. The
+// interrupt handlers expect the legacy SFR page (0x91 is TMR3CN there
+// and CRC0DAT on the CRC0 page), so the page is only switched with
+// interrupts off, a few bytes at a time to keep serial and radio
+// interrupts waiting no more than a few microseconds
+#define CRC0_CHUNK	32
+
+static uint16_t
+crc16_crc0(__data uint8_t n, __xdata uint8_t * __data buf)
+{
+	register uint8_t high, low, chunk;
+
+	__critical {
+		SFRPAGE = CRC0_PAGE;
+		CRC0CN = 0x18;	// 16 bit CRC, start from 0, result pointer at the low byte
+		SFRPAGE = LEGACY_PAGE;
+	}
+	while (n != 0) {
+		chunk = (n > CRC0_CHUNK) ? CRC0_CHUNK : n;
+		n -= chunk;
+		__critical {
+			SFRPAGE = CRC0_PAGE;
+			while (chunk--) {
+				CRC0IN = *buf++;
+			}
+			SFRPAGE = LEGACY_PAGE;
+		}
+	}
+	__critical {
+		SFRPAGE = CRC0_PAGE;
+		low = CRC0DAT;	// the pointer moves on to the high byte
+		high = CRC0DAT;
+		SFRPAGE = LEGACY_PAGE;
+	}
+
+	return (((uint16_t)high)<<8) | low;
+}
+#endif // SFR_CRC0CN
+
+// calculate the CRC16 of a buffer
+uint16_t 
+crc16(__data uint8_t n, __xdata uint8_t * __data buf)
+{
+#ifdef SFR_CRC0CN
+	if (crc_hardware && n >= 2) {
+		return crc16_crc0(n-2, buf) ^ ((((uint16_t)buf[n-2])<<8) | buf[n-1]);
+	}
+#endif
+	return crc16_table(n, buf);
+}
+
+void
+crc_init(void)
+{
+#ifdef SFR_CRC0CN
+	__xdata uint8_t c = 0x63;
+
+	// the CRC-CCITT of 0x63 is 0x5CC5
+	crc_hardware = (crc16_crc0(1, &c) == 0x5CC5);
+#endif
+}
@@ -33,3 +33,10 @@
 /// @return		CRC16 value
 ///
 extern uint16_t crc16(__data uint8_t n, __xdata uint8_t * __data buf);
+
+/// true if crc16() is using the CRC0 engine rather than the tables
+extern bool crc_hardware;
+
+/// check the CRC0 engine gives the right answer, and use it for
+/// crc16() if it does
+extern void crc_init(void);
@@ -48,6 +48,30 @@ __pdata static volatile uint8_t fhop_channel;
 /// map between hopping channel numbers and physical channel numbers
 __xdata static uint8_t channel_map[MAX_FREQ_CHANNELS];
 
+/// adaptive hopping. Every physical channel has a score that goes up
+/// with the receive errors on it, and while it is noisier than the
+/// rest, and decays over time. The nodes report their worst channel
+/// to the base, which leaves up to max_excluded channels that are
+/// doing far worse than the others out of the hopping. It announces
+/// the change in the sync SWITCH_ROUNDS rounds ahead, so every node
+/// starts hopping over the new set at the same round
+#define SCORE_ERROR		16	// per receive error
+#define SCORE_NOISE		4	// per update while noisy
+#define NOISE_MARGIN		10	// RSSI units above the mean noise
+#define SCORE_EXCLUDE		64	// least score to leave a channel out
+#define SCORE_READMIT		16	// score to take it back below
+#define SCORE_DECAY_PERIOD	8	// updates between decays, 4 seconds
+#define SWITCH_ROUNDS		4
+#define CHANNEL_BIT(_mask, _c)	((_mask)[(_c)>>3] & (1<<((_c)&7)))
+__pdata static uint8_t max_excluded;
+__pdata static uint8_t decay_count;
+__pdata static uint8_t switch_rounds;
+__xdata static uint8_t channel_score[MAX_FREQ_CHANNELS];
+__xdata static uint8_t channel_noise[MAX_FREQ_CHANNELS];
+/// the channels left out now, and once switch_rounds runs out
+__xdata static uint8_t excluded[(MAX_FREQ_CHANNELS+7)/8];
+__xdata static uint8_t next_excluded[(MAX_FREQ_CHANNELS+7)/8];
+
 // a vary simple array shuffle
 // based on shuffle from
 // http://benpfaff.org/writings/clc/shuffle.html
@@ -91,21 +115,49 @@ fhop_sync_channel(void)
 	return channel_map[SYNC_CHANNEL % num_fh_channels];
 }
 
-// get the current transmit channel (NOT the map frequency)
-uint8_t
-get_transmit_channel(void)
+// the hop index of a slot. The windows step through the channels in
+// turn, round after round, and a channel that is left out gives way
+// to the next one. The sync channel never is, so there is always one
+// to stop at
+static uint8_t
+hop_index(__pdata uint16_t round, __pdata uint16_t slot, __pdata uint16_t windows)
 {
-	return fhop_channel;
+	__pdata uint8_t hop;
+
+	hop = ((round % num_fh_channels) * (windows % num_fh_channels) + slot % num_fh_channels) % num_fh_channels;
+	while (CHANNEL_BIT(excluded, channel_map[hop])) {
+		hop = (hop + 1) % num_fh_channels;
+	}
+	return hop;
 }
 
-// set the current transmit channel (NOT the map frequency)
+// called when the transmit window changes owner
 void
-set_transmit_channel(uint8_t channel)
+fhop_set_window(__pdata uint16_t round, __pdata uint16_t slot, __pdata uint16_t windows)
+{
+	fhop_channel = hop_index(round, slot, windows);
+	if (!have_radio_lock) {
+		// when we don't have lock, listen on the sync channel
+		fhop_channel = SYNC_CHANNEL % num_fh_channels;
+	}
+}
+
+// find a round that has a slot on a channel
+uint16_t
+fhop_find_round(__pdata uint8_t channel, __pdata uint16_t slot, __pdata uint16_t windows)
 {
-	fhop_channel = channel;
+	__pdata uint8_t round;
+
+	// the hopping only depends on the round modulo the channels
+	for (round = 0; round < num_fh_channels; round++) {
+		if (channel_map[hop_index(round, slot, windows)] == channel) {
+			return round;
+		}
+	}
+	return 0xFFFF;
 }
 
-// called when the transmit windows changes owner
+// step through the channels looking for a network
 void 
 fhop_window_change(void)
 {
@@ -129,3 +181,204 @@ fhop_set_locked(bool locked)
 	have_radio_lock = locked;
 }
 
+
+// set how many channels adaptive hopping may leave out
+void
+fhop_set_max_excluded(__pdata uint8_t max)
+{
+	if (max > num_fh_channels/2) {
+		max = num_fh_channels/2;
+	}
+	max_excluded = max;
+	switch_rounds = 0;
+	memset(excluded, 0, sizeof(excluded));
+	memset(next_excluded, 0, sizeof(next_excluded));
+}
+
+// whether adaptive hopping is on
+bool
+fhop_adaptive(void)
+{
+	return max_excluded != 0;
+}
+
+// count receive errors against a channel
+void
+fhop_channel_errors(__pdata uint8_t channel, __pdata uint16_t count)
+{
+	if (channel >= MAX_FREQ_CHANNELS) {
+		return;
+	}
+	if (count > (0xFF - channel_score[channel]) / SCORE_ERROR) {
+		channel_score[channel] = 0xFF;
+	} else {
+		channel_score[channel] += count * SCORE_ERROR;
+	}
+}
+
+// record a noise sample on a channel
+void
+fhop_channel_noise(__pdata uint8_t channel, __pdata uint8_t rssi)
+{
+	if (channel >= MAX_FREQ_CHANNELS) {
+		return;
+	}
+	channel_noise[channel] = (rssi + 3*(uint16_t)channel_noise[channel])/4;
+}
+
+// find our worst channel of those we hop over
+void
+fhop_worst_channel(__xdata uint8_t * __pdata report)
+{
+	__pdata uint8_t i, sync = fhop_sync_channel();
+
+	// the sync channel can't be left out, so isn't worth a report
+	report[0] = 0;
+	report[1] = 0;
+	for (i = 0; i < num_fh_channels; i++) {
+		if (i != sync && !CHANNEL_BIT(excluded, i) && channel_score[i] > report[1]) {
+			report[0] = i;
+			report[1] = channel_score[i];
+		}
+	}
+}
+
+// the base takes the worst a node has seen on a channel
+void
+fhop_channel_report(__xdata uint8_t * __pdata report)
+{
+	if (report[0] < num_fh_channels && report[1] > channel_score[report[0]]) {
+		channel_score[report[0]] = report[1];
+	}
+}
+
+// age the scores, and choose the channels to leave out
+void
+fhop_quality_update(bool base)
+{
+	__pdata uint8_t i, n = 0, worst = 0xFF, sync = fhop_sync_channel();
+	__pdata uint16_t noise = 0, score = 0;
+	bool decay;
+
+	// the mean noise and score of the channels in use, which
+	// always include the sync channel
+	for (i = 0; i < num_fh_channels; i++) {
+		if (!CHANNEL_BIT(excluded, i)) {
+			noise += channel_noise[i];
+			score += channel_score[i];
+			n++;
+		}
+	}
+	noise /= n;
+	score /= n;
+
+	decay = (++decay_count == SCORE_DECAY_PERIOD);
+	if (decay) {
+		decay_count = 0;
+	}
+	for (i = 0; i < num_fh_channels; i++) {
+		// a channel left out is not sampled, so its noise is old
+		if (!CHANNEL_BIT(excluded, i) && channel_noise[i] > noise + NOISE_MARGIN) {
+			if (channel_score[i] > 0xFF - SCORE_NOISE) {
+				channel_score[i] = 0xFF;
+			} else {
+				channel_score[i] += SCORE_NOISE;
+			}
+		}
+		if (decay) {
+			channel_score[i] -= (channel_score[i]+3)/4;
+		}
+	}
+
+	if (!base || max_excluded == 0 || switch_rounds != 0) {
+		return;
+	}
+
+	// take back the channels that have recovered. Nobody hears
+	// errors on a channel that is left out, so in time they all do
+	n = 0;
+	for (i = 0; i < num_fh_channels; i++) {
+		if (CHANNEL_BIT(next_excluded, i)) {
+			if (channel_score[i] < SCORE_READMIT) {
+				next_excluded[i>>3] &= ~(1<<(i&7));
+				switch_rounds = SWITCH_ROUNDS;
+			} else {
+				n++;
+			}
+		}
+	}
+	if (n >= max_excluded) {
+		return;
+	}
+
+	// and leave out the worst channel, when it is doing far worse
+	// than the rest. One at a time, so a bad patch of spectrum is
+	// left out a channel at a time
+	score *= 4;
+	if (score < SCORE_EXCLUDE) {
+		score = SCORE_EXCLUDE;
+	}
+	for (i = 0; i < num_fh_channels; i++) {
+		if (i != sync && !CHANNEL_BIT(next_excluded, i) && channel_score[i] >= score &&
+		    (worst == 0xFF || channel_score[i] > channel_score[worst])) {
+			worst = i;
+		}
+	}
+	if (worst != 0xFF) {
+		debug("leave out channel %u\n", (unsigned)worst);
+		next_excluded[worst>>3] |= 1<<(worst&7);
+		switch_rounds = SWITCH_ROUNDS;
+	}
+}
+
+// a round starts, and with it any change to the channels left out
+void
+fhop_round_start(void)
+{
+	if (switch_rounds != 0 && --switch_rounds == 0) {
+		memcpy(excluded, next_excluded, sizeof(excluded));
+	}
+}
+
+// the channels left out and any change to come, for the sync
+uint8_t
+fhop_get_exclusions(__xdata uint8_t * __pdata buf)
+{
+	buf[0] = switch_rounds;
+	memcpy(buf+1, excluded, FHOP_MASK_BYTES);
+	if (switch_rounds == 0) {
+		return 1+FHOP_MASK_BYTES;
+	}
+	memcpy(buf+1+FHOP_MASK_BYTES, next_excluded, FHOP_MASK_BYTES);
+	return 1+2*FHOP_MASK_BYTES;
+}
+
+// keep a bitmap from the base to the channels we have, and never
+// leave out the sync channel
+static void
+mask_copy(__xdata uint8_t * __pdata to, __xdata uint8_t * __pdata from)
+{
+	__pdata uint8_t i, sync = fhop_sync_channel();
+
+	memcpy(to, from, FHOP_MASK_BYTES);
+	for (i = num_fh_channels; i < FHOP_MASK_BYTES*8; i++) {
+		to[i>>3] &= ~(1<<(i&7));
+	}
+	to[sync>>3] &= ~(1<<(sync&7));
+}
+
+// a node takes the channels left out from the sync
+uint8_t
+fhop_set_exclusions(__xdata uint8_t * __pdata buf, __pdata uint8_t len)
+{
+	if (len < 1+FHOP_MASK_BYTES || (buf[0] != 0 && len < 1+2*FHOP_MASK_BYTES)) {
+		return 0;
+	}
+	mask_copy(excluded, buf+1);
+	switch_rounds = buf[0];
+	if (switch_rounds == 0) {
+		return 1+FHOP_MASK_BYTES;
+	}
+	mask_copy(next_excluded, buf+1+FHOP_MASK_BYTES);
+	return 1+2*FHOP_MASK_BYTES;
+}
@@ -37,6 +37,12 @@
 #define MAX_FREQ_CHANNELS 50
 #define SYNC_CHANNEL      0
 
+/// bytes in a bitmap of num_fh_channels channels
+#define FHOP_MASK_BYTES   ((num_fh_channels+7)/8)
+
+/// the most bytes fhop_get_exclusions() uses
+#define FHOP_EXCLUSIONS_MAX (1+2*FHOP_MASK_BYTES)
+
 /// initialise frequency hopping logic
 ///
 /// @param netid	Our assigned network ID.
@@ -55,11 +61,29 @@ extern uint8_t fhop_receive_channel(void);
 extern uint8_t fhop_sync_channel(void);
 
 
-// Get and Set the transmit channel, needed to get nodes in sync
-extern uint8_t get_transmit_channel(void);
-extern void set_transmit_channel(uint8_t channel);
+/// move to the channel of a transmit window. The channel is worked out
+/// from the round and slot alone, so a node that knows them is on the
+/// same channel as the rest of the network
+///
+/// @param round	The round number the base sends in the sync
+/// @param slot		The slot of the window in the round
+/// @param windows	The number of slots in a round
+///
+extern void fhop_set_window(__pdata uint16_t round, __pdata uint16_t slot, __pdata uint16_t windows);
 
-/// called when the transmit window flips
+/// work out a round that puts a slot on a channel, so a node can join
+/// the hopping from any packet it hears
+///
+/// @param channel	The physical channel the packet was heard on
+/// @param slot		The slot of the node that sent it
+/// @param windows	The number of slots in a round
+/// @return		A round that gives the same hopping as the
+///			base's from then on, or 0xFFFF if there is none
+///
+extern uint16_t fhop_find_round(__pdata uint8_t channel, __pdata uint16_t slot, __pdata uint16_t windows);
+
+/// move to the next channel, to look for a network while we have
+/// no lock
 ///
 extern void fhop_window_change(void);
 
@@ -72,4 +96,72 @@ extern void fhop_set_locked(bool locked);
 /// how many channels are we hopping over
 extern __pdata uint8_t num_fh_channels;
 
+/// set how many channels the base may leave out of the hopping for
+/// poor quality, 0 to hop over all of them
+///
+/// @param max		The most channels to leave out. At least half
+///			the channels are always kept
+///
+extern void fhop_set_max_excluded(__pdata uint8_t max);
+
+/// whether channels can be left out of the hopping
+///
+extern bool fhop_adaptive(void);
+
+/// count receive errors against a channel
+///
+/// @param channel	The physical channel the errors happened on
+/// @param count	How many there were
+///
+extern void fhop_channel_errors(__pdata uint8_t channel, __pdata uint16_t count);
+
+/// record the background noise on a channel
+///
+/// @param channel	The physical channel
+/// @param rssi		The noise level there
+///
+extern void fhop_channel_noise(__pdata uint8_t channel, __pdata uint8_t rssi);
+
+/// the channel in the hopping that is doing worst here, to report it
+/// to the base
+///
+/// @param report	Where to put the channel and its score
+///
+extern void fhop_worst_channel(__xdata uint8_t * __pdata report);
+
+/// take in a channel a node reported as its worst
+///
+/// @param report	The channel and its score
+///
+extern void fhop_channel_report(__xdata uint8_t * __pdata report);
+
+/// age the channel scores, and at the base choose the channels to
+/// leave out. Called on each link update
+///
+/// @param base		True at the base
+///
+extern void fhop_quality_update(bool base);
+
+/// start hopping over the new set of channels, when a change the base
+/// announced is due. Called as each round starts
+///
+extern void fhop_round_start(void);
+
+/// the channels left out of the hopping, for the base to send with
+/// the sync: the rounds to a change, a bitmap of the channels left out
+/// now, and when a change is coming a bitmap of those left out after it
+///
+/// @param buf		Where to put the up to FHOP_EXCLUSIONS_MAX bytes
+/// @return		The number of bytes used
+///
+extern uint8_t fhop_get_exclusions(__xdata uint8_t * __pdata buf);
+
+/// take the channels left out of the hopping from a sync
+///
+/// @param buf		What fhop_get_exclusions() put in the sync
+/// @param len		The bytes left in the sync
+/// @return		The number of bytes used, 0 if they were cut short
+///
+extern uint8_t fhop_set_exclusions(__xdata uint8_t * __pdata buf, __pdata uint8_t len);
+
 #endif // _FREQ_HOPPING_H_
@@ -41,60 +41,31 @@
 // for pointers
 static __pdata uint8_t g3[3], g6[6];
 
-#define GOLAY_POLY 0xc75UL
-
-static const __code uint32_t shift_table[12] = {
-	GOLAY_POLY<<0,
-	GOLAY_POLY<<1,
-	GOLAY_POLY<<2,
-	GOLAY_POLY<<3,
-	GOLAY_POLY<<4,
-	GOLAY_POLY<<5,
-	GOLAY_POLY<<6,
-	GOLAY_POLY<<7,
-	GOLAY_POLY<<8,
-	GOLAY_POLY<<9,
-	GOLAY_POLY<<10,
-	GOLAY_POLY<<11,
-};
-
-// calculate the golay syndrome value
-static uint16_t 
-golay_syndrome(__data uint32_t codeword)
-{
-//	__data uint32_t shift = (1UL<<22);
-//	__data uint8_t shiftcount = 11;
-//
-//	while (codeword >= (1UL<<11)) {
-//		while ((shift & codeword) == 0) {
-//			shift >>= 1;
-//			shiftcount--;
-//		}
-//		codeword ^= shift_table[shiftcount];
-//	}
-	return codeword;
-}
-
+// Each 12 bit data word is sent as a 23 bit codeword in 3 bytes,
+// with the 11 parity bits from golay23_encode[] in the low bits and
+// the data word in the high bits. The syndrome of a received word is
+// the received parity xor the parity of the received data, and
+// golay23_decode[] maps it to the correction for the data bits.
 
 // encode 3 bytes data into 6 bytes of coded data
 // input is in g3[], output in g6[]
 static void 
 golay_encode24(void)
 {
-//	__pdata uint16_t v;
-//	__pdata uint32_t codeword;
-//
-//	v = g3[0] | ((uint16_t)g3[1]&0xF)<<8;
-//	codeword = golay23_encode[v];
-//	g6[0] = codeword & 0xFF;
-//	g6[1] = (codeword >> 8) & 0xFF;
-//	g6[2] = (codeword >> 16) & 0xFF;
-//
-//	v = g3[2] | ((uint16_t)g3[1]&0xF0)<<4;
-//	codeword = golay23_encode[v];
-//	g6[3] = codeword & 0xFF;
-//	g6[4] = (codeword >> 8) & 0xFF;
-//	g6[5] = (codeword >> 16) & 0xFF;
+	__pdata uint16_t v;
+	__pdata uint16_t syn;
+
+	v = g3[0] | ((uint16_t)g3[1]&0xF)<<8;
+	syn = golay23_encode[v];
+	g6[0] = syn & 0xFF;
+	g6[1] = (g3[0]&0x1F)<<3 | syn>>8;
+	g6[2] = v>>5;
+
+	v = g3[2] | ((uint16_t)g3[1]&0xF0)<<4;
+	syn = golay23_encode[v];
+	g6[3] = syn & 0xFF;
+	g6[4] = (g3[2]&0x1F)<<3 | syn>>8;
+	g6[5] = v>>5;
 }
 
 // encode n bytes of data into 2n coded bytes. n must be a multiple 3
@@ -119,35 +90,30 @@ golay_encode(__pdata uint8_t n, __xdata uint8_t * __pdata in, __xdata uint8_t *
 static uint8_t 
 golay_decode24(void)
 {
-//	__data uint16_t v, v0;
-//	__data uint32_t codeword;
-//	__pdata uint8_t errcount = 0;
-//
-//	codeword = g6[0] | (((uint16_t)g6[1])<<8) | (((uint32_t)(g6[2]&0x7F))<<16);
-//	v0 = codeword >> 11;
-//	v = golay_syndrome(codeword);
-//	codeword ^= golay23_decode[v];
-//	v = codeword >> 11;
-//	if (v != v0) {
-//		errcount++;
-//	}
-//
-//	g3[0] = v & 0xFF;
-//	g3[1] = (v >> 8);
-//
-//	codeword = g6[3] | (((uint16_t)g6[4])<<8) | (((uint32_t)(g6[5]&0x7F))<<16);
-//	v0 = codeword >> 11;
-//	v = golay_syndrome(codeword);
-//	codeword ^= golay23_decode[v];
-//	v = codeword >> 11;
-//	if (v != v0) {
-//		errcount++;
-//	}
-//
-//	g3[1] |= ((v >> 4)&0xF0);
-//	g3[2] = v & 0xFF;
-//	return errcount;
-    return 100;
+	__data uint16_t v;
+	__data uint16_t syn;
+	__pdata uint8_t errcount = 0;
+
+	v = ((uint16_t)(g6[2]&0x7F))<<5 | g6[1]>>3;
+	syn = golay23_encode[v] ^ (g6[0] | ((uint16_t)(g6[1]&0x7))<<8);
+	if (syn != 0) {
+		v ^= golay23_decode[syn];
+		errcount++;
+	}
+
+	g3[0] = v & 0xFF;
+	g3[1] = v >> 8;
+
+	v = ((uint16_t)(g6[5]&0x7F))<<5 | g6[4]>>3;
+	syn = golay23_encode[v] ^ (g6[3] | ((uint16_t)(g6[4]&0x7))<<8);
+	if (syn != 0) {
+		v ^= golay23_decode[syn];
+		errcount++;
+	}
+
+	g3[1] |= (v >> 4) & 0xF0;
+	g3[2] = v & 0xFF;
+	return errcount;
 }
 
 // decode n bytes of coded data into n/2 bytes of original data
@@ -31,779 +31,781 @@
 ///
 /// golay 23/12 encoding and decoding tables
 ///
+/// golay23_encode[] gives the 11 parity bits for each 12 bit data
+/// word, and golay23_decode[] maps each 11 bit syndrome to the
+/// correction for the data bits. Generated with host/golay_test -g
+///
 
-
-static const __code uint32_t golay23_encode[4096] = {
-0x00000000UL, 0x00000c75UL, 0x0000149fUL, 0x000018eaUL, 0x0000254bUL, 0x0000293eUL, 0x000031d4UL, 0x00003da1UL, 
-0x000046e3UL, 0x00004a96UL, 0x0000527cUL, 0x00005e09UL, 0x000063a8UL, 0x00006fddUL, 0x00007737UL, 0x00007b42UL, 
-0x000081b3UL, 0x00008dc6UL, 0x0000952cUL, 0x00009959UL, 0x0000a4f8UL, 0x0000a88dUL, 0x0000b067UL, 0x0000bc12UL, 
-0x0000c750UL, 0x0000cb25UL, 0x0000d3cfUL, 0x0000dfbaUL, 0x0000e21bUL, 0x0000ee6eUL, 0x0000f684UL, 0x0000faf1UL, 
-0x00010366UL, 0x00010f13UL, 0x000117f9UL, 0x00011b8cUL, 0x0001262dUL, 0x00012a58UL, 0x000132b2UL, 0x00013ec7UL, 
-0x00014585UL, 0x000149f0UL, 0x0001511aUL, 0x00015d6fUL, 0x000160ceUL, 0x00016cbbUL, 0x00017451UL, 0x00017824UL, 
-0x000182d5UL, 0x00018ea0UL, 0x0001964aUL, 0x00019a3fUL, 0x0001a79eUL, 0x0001abebUL, 0x0001b301UL, 0x0001bf74UL, 
-0x0001c436UL, 0x0001c843UL, 0x0001d0a9UL, 0x0001dcdcUL, 0x0001e17dUL, 0x0001ed08UL, 0x0001f5e2UL, 0x0001f997UL, 
-0x000206ccUL, 0x00020ab9UL, 0x00021253UL, 0x00021e26UL, 0x00022387UL, 0x00022ff2UL, 0x00023718UL, 0x00023b6dUL, 
-0x0002402fUL, 0x00024c5aUL, 0x000254b0UL, 0x000258c5UL, 0x00026564UL, 0x00026911UL, 0x000271fbUL, 0x00027d8eUL, 
-0x0002877fUL, 0x00028b0aUL, 0x000293e0UL, 0x00029f95UL, 0x0002a234UL, 0x0002ae41UL, 0x0002b6abUL, 0x0002badeUL, 
-0x0002c19cUL, 0x0002cde9UL, 0x0002d503UL, 0x0002d976UL, 0x0002e4d7UL, 0x0002e8a2UL, 0x0002f048UL, 0x0002fc3dUL, 
-0x000305aaUL, 0x000309dfUL, 0x00031135UL, 0x00031d40UL, 0x000320e1UL, 0x00032c94UL, 0x0003347eUL, 0x0003380bUL, 
-0x00034349UL, 0x00034f3cUL, 0x000357d6UL, 0x00035ba3UL, 0x00036602UL, 0x00036a77UL, 0x0003729dUL, 0x00037ee8UL, 
-0x00038419UL, 0x0003886cUL, 0x00039086UL, 0x00039cf3UL, 0x0003a152UL, 0x0003ad27UL, 0x0003b5cdUL, 0x0003b9b8UL, 
-0x0003c2faUL, 0x0003ce8fUL, 0x0003d665UL, 0x0003da10UL, 0x0003e7b1UL, 0x0003ebc4UL, 0x0003f32eUL, 0x0003ff5bUL, 
-0x000401edUL, 0x00040d98UL, 0x00041572UL, 0x00041907UL, 0x000424a6UL, 0x000428d3UL, 0x00043039UL, 0x00043c4cUL, 
-0x0004470eUL, 0x00044b7bUL, 0x00045391UL, 0x00045fe4UL, 0x00046245UL, 0x00046e30UL, 0x000476daUL, 0x00047aafUL, 
-0x0004805eUL, 0x00048c2bUL, 0x000494c1UL, 0x000498b4UL, 0x0004a515UL, 0x0004a960UL, 0x0004b18aUL, 0x0004bdffUL, 
-0x0004c6bdUL, 0x0004cac8UL, 0x0004d222UL, 0x0004de57UL, 0x0004e3f6UL, 0x0004ef83UL, 0x0004f769UL, 0x0004fb1cUL, 
-0x0005028bUL, 0x00050efeUL, 0x00051614UL, 0x00051a61UL, 0x000527c0UL, 0x00052bb5UL, 0x0005335fUL, 0x00053f2aUL, 
-0x00054468UL, 0x0005481dUL, 0x000550f7UL, 0x00055c82UL, 0x00056123UL, 0x00056d56UL, 0x000575bcUL, 0x000579c9UL, 
-0x00058338UL, 0x00058f4dUL, 0x000597a7UL, 0x00059bd2UL, 0x0005a673UL, 0x0005aa06UL, 0x0005b2ecUL, 0x0005be99UL, 
-0x0005c5dbUL, 0x0005c9aeUL, 0x0005d144UL, 0x0005dd31UL, 0x0005e090UL, 0x0005ece5UL, 0x0005f40fUL, 0x0005f87aUL, 
-0x00060721UL, 0x00060b54UL, 0x000613beUL, 0x00061fcbUL, 0x0006226aUL, 0x00062e1fUL, 0x000636f5UL, 0x00063a80UL, 
-0x000641c2UL, 0x00064db7UL, 0x0006555dUL, 0x00065928UL, 0x00066489UL, 0x000668fcUL, 0x00067016UL, 0x00067c63UL, 
-0x00068692UL, 0x00068ae7UL, 0x0006920dUL, 0x00069e78UL, 0x0006a3d9UL, 0x0006afacUL, 0x0006b746UL, 0x0006bb33UL, 
-0x0006c071UL, 0x0006cc04UL, 0x0006d4eeUL, 0x0006d89bUL, 0x0006e53aUL, 0x0006e94fUL, 0x0006f1a5UL, 0x0006fdd0UL, 
-0x00070447UL, 0x00070832UL, 0x000710d8UL, 0x00071cadUL, 0x0007210cUL, 0x00072d79UL, 0x00073593UL, 0x000739e6UL, 
-0x000742a4UL, 0x00074ed1UL, 0x0007563bUL, 0x00075a4eUL, 0x000767efUL, 0x00076b9aUL, 0x00077370UL, 0x00077f05UL, 
-0x000785f4UL, 0x00078981UL, 0x0007916bUL, 0x00079d1eUL, 0x0007a0bfUL, 0x0007accaUL, 0x0007b420UL, 0x0007b855UL, 
-0x0007c317UL, 0x0007cf62UL, 0x0007d788UL, 0x0007dbfdUL, 0x0007e65cUL, 0x0007ea29UL, 0x0007f2c3UL, 0x0007feb6UL, 
-0x000803daUL, 0x00080fafUL, 0x00081745UL, 0x00081b30UL, 0x00082691UL, 0x00082ae4UL, 0x0008320eUL, 0x00083e7bUL, 
-0x00084539UL, 0x0008494cUL, 0x000851a6UL, 0x00085dd3UL, 0x00086072UL, 0x00086c07UL, 0x000874edUL, 0x00087898UL, 
-0x00088269UL, 0x00088e1cUL, 0x000896f6UL, 0x00089a83UL, 0x0008a722UL, 0x0008ab57UL, 0x0008b3bdUL, 0x0008bfc8UL, 
-0x0008c48aUL, 0x0008c8ffUL, 0x0008d015UL, 0x0008dc60UL, 0x0008e1c1UL, 0x0008edb4UL, 0x0008f55eUL, 0x0008f92bUL, 
-0x000900bcUL, 0x00090cc9UL, 0x00091423UL, 0x00091856UL, 0x000925f7UL, 0x00092982UL, 0x00093168UL, 0x00093d1dUL, 
-0x0009465fUL, 0x00094a2aUL, 0x000952c0UL, 0x00095eb5UL, 0x00096314UL, 0x00096f61UL, 0x0009778bUL, 0x00097bfeUL, 
-0x0009810fUL, 0x00098d7aUL, 0x00099590UL, 0x000999e5UL, 0x0009a444UL, 0x0009a831UL, 0x0009b0dbUL, 0x0009bcaeUL, 
-0x0009c7ecUL, 0x0009cb99UL, 0x0009d373UL, 0x0009df06UL, 0x0009e2a7UL, 0x0009eed2UL, 0x0009f638UL, 0x0009fa4dUL, 
-0x000a0516UL, 0x000a0963UL, 0x000a1189UL, 0x000a1dfcUL, 0x000a205dUL, 0x000a2c28UL, 0x000a34c2UL, 0x000a38b7UL, 
-0x000a43f5UL, 0x000a4f80UL, 0x000a576aUL, 0x000a5b1fUL, 0x000a66beUL, 0x000a6acbUL, 0x000a7221UL, 0x000a7e54UL, 
-0x000a84a5UL, 0x000a88d0UL, 0x000a903aUL, 0x000a9c4fUL, 0x000aa1eeUL, 0x000aad9bUL, 0x000ab571UL, 0x000ab904UL, 
-0x000ac246UL, 0x000ace33UL, 0x000ad6d9UL, 0x000adaacUL, 0x000ae70dUL, 0x000aeb78UL, 0x000af392UL, 0x000affe7UL, 
-0x000b0670UL, 0x000b0a05UL, 0x000b12efUL, 0x000b1e9aUL, 0x000b233bUL, 0x000b2f4eUL, 0x000b37a4UL, 0x000b3bd1UL, 
-0x000b4093UL, 0x000b4ce6UL, 0x000b540cUL, 0x000b5879UL, 0x000b65d8UL, 0x000b69adUL, 0x000b7147UL, 0x000b7d32UL, 
-0x000b87c3UL, 0x000b8bb6UL, 0x000b935cUL, 0x000b9f29UL, 0x000ba288UL, 0x000baefdUL, 0x000bb617UL, 0x000bba62UL, 
-0x000bc120UL, 0x000bcd55UL, 0x000bd5bfUL, 0x000bd9caUL, 0x000be46bUL, 0x000be81eUL, 0x000bf0f4UL, 0x000bfc81UL, 
-0x000c0237UL, 0x000c0e42UL, 0x000c16a8UL, 0x000c1addUL, 0x000c277cUL, 0x000c2b09UL, 0x000c33e3UL, 0x000c3f96UL, 
-0x000c44d4UL, 0x000c48a1UL, 0x000c504bUL, 0x000c5c3eUL, 0x000c619fUL, 0x000c6deaUL, 0x000c7500UL, 0x000c7975UL, 
-0x000c8384UL, 0x000c8ff1UL, 0x000c971bUL, 0x000c9b6eUL, 0x000ca6cfUL, 0x000caabaUL, 0x000cb250UL, 0x000cbe25UL, 
-0x000cc567UL, 0x000cc912UL, 0x000cd1f8UL, 0x000cdd8dUL, 0x000ce02cUL, 0x000cec59UL, 0x000cf4b3UL, 0x000cf8c6UL, 
-0x000d0151UL, 0x000d0d24UL, 0x000d15ceUL, 0x000d19bbUL, 0x000d241aUL, 0x000d286fUL, 0x000d3085UL, 0x000d3cf0UL, 
-0x000d47b2UL, 0x000d4bc7UL, 0x000d532dUL, 0x000d5f58UL, 0x000d62f9UL, 0x000d6e8cUL, 0x000d7666UL, 0x000d7a13UL, 
-0x000d80e2UL, 0x000d8c97UL, 0x000d947dUL, 0x000d9808UL, 0x000da5a9UL, 0x000da9dcUL, 0x000db136UL, 0x000dbd43UL, 
-0x000dc601UL, 0x000dca74UL, 0x000dd29eUL, 0x000ddeebUL, 0x000de34aUL, 0x000def3fUL, 0x000df7d5UL, 0x000dfba0UL, 
-0x000e04fbUL, 0x000e088eUL, 0x000e1064UL, 0x000e1c11UL, 0x000e21b0UL, 0x000e2dc5UL, 0x000e352fUL, 0x000e395aUL, 
-0x000e4218UL, 0x000e4e6dUL, 0x000e5687UL, 0x000e5af2UL, 0x000e6753UL, 0x000e6b26UL, 0x000e73ccUL, 0x000e7fb9UL, 
-0x000e8548UL, 0x000e893dUL, 0x000e91d7UL, 0x000e9da2UL, 0x000ea003UL, 0x000eac76UL, 0x000eb49cUL, 0x000eb8e9UL, 
-0x000ec3abUL, 0x000ecfdeUL, 0x000ed734UL, 0x000edb41UL, 0x000ee6e0UL, 0x000eea95UL, 0x000ef27fUL, 0x000efe0aUL, 
-0x000f079dUL, 0x000f0be8UL, 0x000f1302UL, 0x000f1f77UL, 0x000f22d6UL, 0x000f2ea3UL, 0x000f3649UL, 0x000f3a3cUL, 
-0x000f417eUL, 0x000f4d0bUL, 0x000f55e1UL, 0x000f5994UL, 0x000f6435UL, 0x000f6840UL, 0x000f70aaUL, 0x000f7cdfUL, 
-0x000f862eUL, 0x000f8a5bUL, 0x000f92b1UL, 0x000f9ec4UL, 0x000fa365UL, 0x000faf10UL, 0x000fb7faUL, 0x000fbb8fUL, 
-0x000fc0cdUL, 0x000fccb8UL, 0x000fd452UL, 0x000fd827UL, 0x000fe586UL, 0x000fe9f3UL, 0x000ff119UL, 0x000ffd6cUL, 
-0x001007b4UL, 0x00100bc1UL, 0x0010132bUL, 0x00101f5eUL, 0x001022ffUL, 0x00102e8aUL, 0x00103660UL, 0x00103a15UL, 
-0x00104157UL, 0x00104d22UL, 0x001055c8UL, 0x001059bdUL, 0x0010641cUL, 0x00106869UL, 0x00107083UL, 0x00107cf6UL, 
-0x00108607UL, 0x00108a72UL, 0x00109298UL, 0x00109eedUL, 0x0010a34cUL, 0x0010af39UL, 0x0010b7d3UL, 0x0010bba6UL, 
-0x0010c0e4UL, 0x0010cc91UL, 0x0010d47bUL, 0x0010d80eUL, 0x0010e5afUL, 0x0010e9daUL, 0x0010f130UL, 0x0010fd45UL, 
-0x001104d2UL, 0x001108a7UL, 0x0011104dUL, 0x00111c38UL, 0x00112199UL, 0x00112decUL, 0x00113506UL, 0x00113973UL, 
-0x00114231UL, 0x00114e44UL, 0x001156aeUL, 0x00115adbUL, 0x0011677aUL, 0x00116b0fUL, 0x001173e5UL, 0x00117f90UL, 
-0x00118561UL, 0x00118914UL, 0x001191feUL, 0x00119d8bUL, 0x0011a02aUL, 0x0011ac5fUL, 0x0011b4b5UL, 0x0011b8c0UL, 
-0x0011c382UL, 0x0011cff7UL, 0x0011d71dUL, 0x0011db68UL, 0x0011e6c9UL, 0x0011eabcUL, 0x0011f256UL, 0x0011fe23UL, 
-0x00120178UL, 0x00120d0dUL, 0x001215e7UL, 0x00121992UL, 0x00122433UL, 0x00122846UL, 0x001230acUL, 0x00123cd9UL, 
-0x0012479bUL, 0x00124beeUL, 0x00125304UL, 0x00125f71UL, 0x001262d0UL, 0x00126ea5UL, 0x0012764fUL, 0x00127a3aUL, 
-0x001280cbUL, 0x00128cbeUL, 0x00129454UL, 0x00129821UL, 0x0012a580UL, 0x0012a9f5UL, 0x0012b11fUL, 0x0012bd6aUL, 
-0x0012c628UL, 0x0012ca5dUL, 0x0012d2b7UL, 0x0012dec2UL, 0x0012e363UL, 0x0012ef16UL, 0x0012f7fcUL, 0x0012fb89UL, 
-0x0013021eUL, 0x00130e6bUL, 0x00131681UL, 0x00131af4UL, 0x00132755UL, 0x00132b20UL, 0x001333caUL, 0x00133fbfUL, 
-0x001344fdUL, 0x00134888UL, 0x00135062UL, 0x00135c17UL, 0x001361b6UL, 0x00136dc3UL, 0x00137529UL, 0x0013795cUL, 
-0x001383adUL, 0x00138fd8UL, 0x00139732UL, 0x00139b47UL, 0x0013a6e6UL, 0x0013aa93UL, 0x0013b279UL, 0x0013be0cUL, 
-0x0013c54eUL, 0x0013c93bUL, 0x0013d1d1UL, 0x0013dda4UL, 0x0013e005UL, 0x0013ec70UL, 0x0013f49aUL, 0x0013f8efUL, 
-0x00140659UL, 0x00140a2cUL, 0x001412c6UL, 0x00141eb3UL, 0x00142312UL, 0x00142f67UL, 0x0014378dUL, 0x00143bf8UL, 
-0x001440baUL, 0x00144ccfUL, 0x00145425UL, 0x00145850UL, 0x001465f1UL, 0x00146984UL, 0x0014716eUL, 0x00147d1bUL, 
-0x001487eaUL, 0x00148b9fUL, 0x00149375UL, 0x00149f00UL, 0x0014a2a1UL, 0x0014aed4UL, 0x0014b63eUL, 0x0014ba4bUL, 
-0x0014c109UL, 0x0014cd7cUL, 0x0014d596UL, 0x0014d9e3UL, 0x0014e442UL, 0x0014e837UL, 0x0014f0ddUL, 0x0014fca8UL, 
-0x0015053fUL, 0x0015094aUL, 0x001511a0UL, 0x00151dd5UL, 0x00152074UL, 0x00152c01UL, 0x001534ebUL, 0x0015389eUL, 
-0x001543dcUL, 0x00154fa9UL, 0x00155743UL, 0x00155b36UL, 0x00156697UL, 0x00156ae2UL, 0x00157208UL, 0x00157e7dUL, 
-0x0015848cUL, 0x001588f9UL, 0x00159013UL, 0x00159c66UL, 0x0015a1c7UL, 0x0015adb2UL, 0x0015b558UL, 0x0015b92dUL, 
-0x0015c26fUL, 0x0015ce1aUL, 0x0015d6f0UL, 0x0015da85UL, 0x0015e724UL, 0x0015eb51UL, 0x0015f3bbUL, 0x0015ffceUL, 
-0x00160095UL, 0x00160ce0UL, 0x0016140aUL, 0x0016187fUL, 0x001625deUL, 0x001629abUL, 0x00163141UL, 0x00163d34UL, 
-0x00164676UL, 0x00164a03UL, 0x001652e9UL, 0x00165e9cUL, 0x0016633dUL, 0x00166f48UL, 0x001677a2UL, 0x00167bd7UL, 
-0x00168126UL, 0x00168d53UL, 0x001695b9UL, 0x001699ccUL, 0x0016a46dUL, 0x0016a818UL, 0x0016b0f2UL, 0x0016bc87UL, 
-0x0016c7c5UL, 0x0016cbb0UL, 0x0016d35aUL, 0x0016df2fUL, 0x0016e28eUL, 0x0016eefbUL, 0x0016f611UL, 0x0016fa64UL, 
-0x001703f3UL, 0x00170f86UL, 0x0017176cUL, 0x00171b19UL, 0x001726b8UL, 0x00172acdUL, 0x00173227UL, 0x00173e52UL, 
-0x00174510UL, 0x00174965UL, 0x0017518fUL, 0x00175dfaUL, 0x0017605bUL, 0x00176c2eUL, 0x001774c4UL, 0x001778b1UL, 
-0x00178240UL, 0x00178e35UL, 0x001796dfUL, 0x00179aaaUL, 0x0017a70bUL, 0x0017ab7eUL, 0x0017b394UL, 0x0017bfe1UL, 
-0x0017c4a3UL, 0x0017c8d6UL, 0x0017d03cUL, 0x0017dc49UL, 0x0017e1e8UL, 0x0017ed9dUL, 0x0017f577UL, 0x0017f902UL, 
-0x0018046eUL, 0x0018081bUL, 0x001810f1UL, 0x00181c84UL, 0x00182125UL, 0x00182d50UL, 0x001835baUL, 0x001839cfUL, 
-0x0018428dUL, 0x00184ef8UL, 0x00185612UL, 0x00185a67UL, 0x001867c6UL, 0x00186bb3UL, 0x00187359UL, 0x00187f2cUL, 
-0x001885ddUL, 0x001889a8UL, 0x00189142UL, 0x00189d37UL, 0x0018a096UL, 0x0018ace3UL, 0x0018b409UL, 0x0018b87cUL, 
-0x0018c33eUL, 0x0018cf4bUL, 0x0018d7a1UL, 0x0018dbd4UL, 0x0018e675UL, 0x0018ea00UL, 0x0018f2eaUL, 0x0018fe9fUL, 
-0x00190708UL, 0x00190b7dUL, 0x00191397UL, 0x00191fe2UL, 0x00192243UL, 0x00192e36UL, 0x001936dcUL, 0x00193aa9UL, 
-0x001941ebUL, 0x00194d9eUL, 0x00195574UL, 0x00195901UL, 0x001964a0UL, 0x001968d5UL, 0x0019703fUL, 0x00197c4aUL, 
-0x001986bbUL, 0x00198aceUL, 0x00199224UL, 0x00199e51UL, 0x0019a3f0UL, 0x0019af85UL, 0x0019b76fUL, 0x0019bb1aUL, 
-0x0019c058UL, 0x0019cc2dUL, 0x0019d4c7UL, 0x0019d8b2UL, 0x0019e513UL, 0x0019e966UL, 0x0019f18cUL, 0x0019fdf9UL, 
-0x001a02a2UL, 0x001a0ed7UL, 0x001a163dUL, 0x001a1a48UL, 0x001a27e9UL, 0x001a2b9cUL, 0x001a3376UL, 0x001a3f03UL, 
-0x001a4441UL, 0x001a4834UL, 0x001a50deUL, 0x001a5cabUL, 0x001a610aUL, 0x001a6d7fUL, 0x001a7595UL, 0x001a79e0UL, 
-0x001a8311UL, 0x001a8f64UL, 0x001a978eUL, 0x001a9bfbUL, 0x001aa65aUL, 0x001aaa2fUL, 0x001ab2c5UL, 0x001abeb0UL, 
-0x001ac5f2UL, 0x001ac987UL, 0x001ad16dUL, 0x001add18UL, 0x001ae0b9UL, 0x001aecccUL, 0x001af426UL, 0x001af853UL, 
-0x001b01c4UL, 0x001b0db1UL, 0x001b155bUL, 0x001b192eUL, 0x001b248fUL, 0x001b28faUL, 0x001b3010UL, 0x001b3c65UL, 
-0x001b4727UL, 0x001b4b52UL, 0x001b53b8UL, 0x001b5fcdUL, 0x001b626cUL, 0x001b6e19UL, 0x001b76f3UL, 0x001b7a86UL, 
-0x001b8077UL, 0x001b8c02UL, 0x001b94e8UL, 0x001b989dUL, 0x001ba53cUL, 0x001ba949UL, 0x001bb1a3UL, 0x001bbdd6UL, 
-0x001bc694UL, 0x001bcae1UL, 0x001bd20bUL, 0x001bde7eUL, 0x001be3dfUL, 0x001befaaUL, 0x001bf740UL, 0x001bfb35UL, 
-0x001c0583UL, 0x001c09f6UL, 0x001c111cUL, 0x001c1d69UL, 0x001c20c8UL, 0x001c2cbdUL, 0x001c3457UL, 0x001c3822UL, 
-0x001c4360UL, 0x001c4f15UL, 0x001c57ffUL, 0x001c5b8aUL, 0x001c662bUL, 0x001c6a5eUL, 0x001c72b4UL, 0x001c7ec1UL, 
-0x001c8430UL, 0x001c8845UL, 0x001c90afUL, 0x001c9cdaUL, 0x001ca17bUL, 0x001cad0eUL, 0x001cb5e4UL, 0x001cb991UL, 
-0x001cc2d3UL, 0x001ccea6UL, 0x001cd64cUL, 0x001cda39UL, 0x001ce798UL, 0x001cebedUL, 0x001cf307UL, 0x001cff72UL, 
-0x001d06e5UL, 0x001d0a90UL, 0x001d127aUL, 0x001d1e0fUL, 0x001d23aeUL, 0x001d2fdbUL, 0x001d3731UL, 0x001d3b44UL, 
-0x001d4006UL, 0x001d4c73UL, 0x001d5499UL, 0x001d58ecUL, 0x001d654dUL, 0x001d6938UL, 0x001d71d2UL, 0x001d7da7UL, 
-0x001d8756UL, 0x001d8b23UL, 0x001d93c9UL, 0x001d9fbcUL, 0x001da21dUL, 0x001dae68UL, 0x001db682UL, 0x001dbaf7UL, 
-0x001dc1b5UL, 0x001dcdc0UL, 0x001dd52aUL, 0x001dd95fUL, 0x001de4feUL, 0x001de88bUL, 0x001df061UL, 0x001dfc14UL, 
-0x001e034fUL, 0x001e0f3aUL, 0x001e17d0UL, 0x001e1ba5UL, 0x001e2604UL, 0x001e2a71UL, 0x001e329bUL, 0x001e3eeeUL, 
-0x001e45acUL, 0x001e49d9UL, 0x001e5133UL, 0x001e5d46UL, 0x001e60e7UL, 0x001e6c92UL, 0x001e7478UL, 0x001e780dUL, 
-0x001e82fcUL, 0x001e8e89UL, 0x001e9663UL, 0x001e9a16UL, 0x001ea7b7UL, 0x001eabc2UL, 0x001eb328UL, 0x001ebf5dUL, 
-0x001ec41fUL, 0x001ec86aUL, 0x001ed080UL, 0x001edcf5UL, 0x001ee154UL, 0x001eed21UL, 0x001ef5cbUL, 0x001ef9beUL, 
-0x001f0029UL, 0x001f0c5cUL, 0x001f14b6UL, 0x001f18c3UL, 0x001f2562UL, 0x001f2917UL, 0x001f31fdUL, 0x001f3d88UL, 
-0x001f46caUL, 0x001f4abfUL, 0x001f5255UL, 0x001f5e20UL, 0x001f6381UL, 0x001f6ff4UL, 0x001f771eUL, 0x001f7b6bUL, 
-0x001f819aUL, 0x001f8defUL, 0x001f9505UL, 0x001f9970UL, 0x001fa4d1UL, 0x001fa8a4UL, 0x001fb04eUL, 0x001fbc3bUL, 
-0x001fc779UL, 0x001fcb0cUL, 0x001fd3e6UL, 0x001fdf93UL, 0x001fe232UL, 0x001fee47UL, 0x001ff6adUL, 0x001ffad8UL, 
-0x0020031dUL, 0x00200f68UL, 0x00201782UL, 0x00201bf7UL, 0x00202656UL, 0x00202a23UL, 0x002032c9UL, 0x00203ebcUL, 
-0x002045feUL, 0x0020498bUL, 0x00205161UL, 0x00205d14UL, 0x002060b5UL, 0x00206cc0UL, 0x0020742aUL, 0x0020785fUL, 
-0x002082aeUL, 0x00208edbUL, 0x00209631UL, 0x00209a44UL, 0x0020a7e5UL, 0x0020ab90UL, 0x0020b37aUL, 0x0020bf0fUL, 
-0x0020c44dUL, 0x0020c838UL, 0x0020d0d2UL, 0x0020dca7UL, 0x0020e106UL, 0x0020ed73UL, 0x0020f599UL, 0x0020f9ecUL, 
-0x0021007bUL, 0x00210c0eUL, 0x002114e4UL, 0x00211891UL, 0x00212530UL, 0x00212945UL, 0x002131afUL, 0x00213ddaUL, 
-0x00214698UL, 0x00214aedUL, 0x00215207UL, 0x00215e72UL, 0x002163d3UL, 0x00216fa6UL, 0x0021774cUL, 0x00217b39UL, 
-0x002181c8UL, 0x00218dbdUL, 0x00219557UL, 0x00219922UL, 0x0021a483UL, 0x0021a8f6UL, 0x0021b01cUL, 0x0021bc69UL, 
-0x0021c72bUL, 0x0021cb5eUL, 0x0021d3b4UL, 0x0021dfc1UL, 0x0021e260UL, 0x0021ee15UL, 0x0021f6ffUL, 0x0021fa8aUL, 
-0x002205d1UL, 0x002209a4UL, 0x0022114eUL, 0x00221d3bUL, 0x0022209aUL, 0x00222cefUL, 0x00223405UL, 0x00223870UL, 
-0x00224332UL, 0x00224f47UL, 0x002257adUL, 0x00225bd8UL, 0x00226679UL, 0x00226a0cUL, 0x002272e6UL, 0x00227e93UL, 
-0x00228462UL, 0x00228817UL, 0x002290fdUL, 0x00229c88UL, 0x0022a129UL, 0x0022ad5cUL, 0x0022b5b6UL, 0x0022b9c3UL, 
-0x0022c281UL, 0x0022cef4UL, 0x0022d61eUL, 0x0022da6bUL, 0x0022e7caUL, 0x0022ebbfUL, 0x0022f355UL, 0x0022ff20UL, 
-0x002306b7UL, 0x00230ac2UL, 0x00231228UL, 0x00231e5dUL, 0x002323fcUL, 0x00232f89UL, 0x00233763UL, 0x00233b16UL, 
-0x00234054UL, 0x00234c21UL, 0x002354cbUL, 0x002358beUL, 0x0023651fUL, 0x0023696aUL, 0x00237180UL, 0x00237df5UL, 
-0x00238704UL, 0x00238b71UL, 0x0023939bUL, 0x00239feeUL, 0x0023a24fUL, 0x0023ae3aUL, 0x0023b6d0UL, 0x0023baa5UL, 
-0x0023c1e7UL, 0x0023cd92UL, 0x0023d578UL, 0x0023d90dUL, 0x0023e4acUL, 0x0023e8d9UL, 0x0023f033UL, 0x0023fc46UL, 
-0x002402f0UL, 0x00240e85UL, 0x0024166fUL, 0x00241a1aUL, 0x002427bbUL, 0x00242bceUL, 0x00243324UL, 0x00243f51UL, 
-0x00244413UL, 0x00244866UL, 0x0024508cUL, 0x00245cf9UL, 0x00246158UL, 0x00246d2dUL, 0x002475c7UL, 0x002479b2UL, 
-0x00248343UL, 0x00248f36UL, 0x002497dcUL, 0x00249ba9UL, 0x0024a608UL, 0x0024aa7dUL, 0x0024b297UL, 0x0024bee2UL, 
-0x0024c5a0UL, 0x0024c9d5UL, 0x0024d13fUL, 0x0024dd4aUL, 0x0024e0ebUL, 0x0024ec9eUL, 0x0024f474UL, 0x0024f801UL, 
-0x00250196UL, 0x00250de3UL, 0x00251509UL, 0x0025197cUL, 0x002524ddUL, 0x002528a8UL, 0x00253042UL, 0x00253c37UL, 
-0x00254775UL, 0x00254b00UL, 0x002553eaUL, 0x00255f9fUL, 0x0025623eUL, 0x00256e4bUL, 0x002576a1UL, 0x00257ad4UL, 
-0x00258025UL, 0x00258c50UL, 0x002594baUL, 0x002598cfUL, 0x0025a56eUL, 0x0025a91bUL, 0x0025b1f1UL, 0x0025bd84UL, 
-0x0025c6c6UL, 0x0025cab3UL, 0x0025d259UL, 0x0025de2cUL, 0x0025e38dUL, 0x0025eff8UL, 0x0025f712UL, 0x0025fb67UL, 
-0x0026043cUL, 0x00260849UL, 0x002610a3UL, 0x00261cd6UL, 0x00262177UL, 0x00262d02UL, 0x002635e8UL, 0x0026399dUL, 
-0x002642dfUL, 0x00264eaaUL, 0x00265640UL, 0x00265a35UL, 0x00266794UL, 0x00266be1UL, 0x0026730bUL, 0x00267f7eUL, 
-0x0026858fUL, 0x002689faUL, 0x00269110UL, 0x00269d65UL, 0x0026a0c4UL, 0x0026acb1UL, 0x0026b45bUL, 0x0026b82eUL, 
-0x0026c36cUL, 0x0026cf19UL, 0x0026d7f3UL, 0x0026db86UL, 0x0026e627UL, 0x0026ea52UL, 0x0026f2b8UL, 0x0026fecdUL, 
-0x0027075aUL, 0x00270b2fUL, 0x002713c5UL, 0x00271fb0UL, 0x00272211UL, 0x00272e64UL, 0x0027368eUL, 0x00273afbUL, 
-0x002741b9UL, 0x00274dccUL, 0x00275526UL, 0x00275953UL, 0x002764f2UL, 0x00276887UL, 0x0027706dUL, 0x00277c18UL, 
-0x002786e9UL, 0x00278a9cUL, 0x00279276UL, 0x00279e03UL, 0x0027a3a2UL, 0x0027afd7UL, 0x0027b73dUL, 0x0027bb48UL, 
-0x0027c00aUL, 0x0027cc7fUL, 0x0027d495UL, 0x0027d8e0UL, 0x0027e541UL, 0x0027e934UL, 0x0027f1deUL, 0x0027fdabUL, 
-0x002800c7UL, 0x00280cb2UL, 0x00281458UL, 0x0028182dUL, 0x0028258cUL, 0x002829f9UL, 0x00283113UL, 0x00283d66UL, 
-0x00284624UL, 0x00284a51UL, 0x002852bbUL, 0x00285eceUL, 0x0028636fUL, 0x00286f1aUL, 0x002877f0UL, 0x00287b85UL, 
-0x00288174UL, 0x00288d01UL, 0x002895ebUL, 0x0028999eUL, 0x0028a43fUL, 0x0028a84aUL, 0x0028b0a0UL, 0x0028bcd5UL, 
-0x0028c797UL, 0x0028cbe2UL, 0x0028d308UL, 0x0028df7dUL, 0x0028e2dcUL, 0x0028eea9UL, 0x0028f643UL, 0x0028fa36UL, 
-0x002903a1UL, 0x00290fd4UL, 0x0029173eUL, 0x00291b4bUL, 0x002926eaUL, 0x00292a9fUL, 0x00293275UL, 0x00293e00UL, 
-0x00294542UL, 0x00294937UL, 0x002951ddUL, 0x00295da8UL, 0x00296009UL, 0x00296c7cUL, 0x00297496UL, 0x002978e3UL, 
-0x00298212UL, 0x00298e67UL, 0x0029968dUL, 0x00299af8UL, 0x0029a759UL, 0x0029ab2cUL, 0x0029b3c6UL, 0x0029bfb3UL, 
-0x0029c4f1UL, 0x0029c884UL, 0x0029d06eUL, 0x0029dc1bUL, 0x0029e1baUL, 0x0029edcfUL, 0x0029f525UL, 0x0029f950UL, 
-0x002a060bUL, 0x002a0a7eUL, 0x002a1294UL, 0x002a1ee1UL, 0x002a2340UL, 0x002a2f35UL, 0x002a37dfUL, 0x002a3baaUL, 
-0x002a40e8UL, 0x002a4c9dUL, 0x002a5477UL, 0x002a5802UL, 0x002a65a3UL, 0x002a69d6UL, 0x002a713cUL, 0x002a7d49UL, 
-0x002a87b8UL, 0x002a8bcdUL, 0x002a9327UL, 0x002a9f52UL, 0x002aa2f3UL, 0x002aae86UL, 0x002ab66cUL, 0x002aba19UL, 
-0x002ac15bUL, 0x002acd2eUL, 0x002ad5c4UL, 0x002ad9b1UL, 0x002ae410UL, 0x002ae865UL, 0x002af08fUL, 0x002afcfaUL, 
-0x002b056dUL, 0x002b0918UL, 0x002b11f2UL, 0x002b1d87UL, 0x002b2026UL, 0x002b2c53UL, 0x002b34b9UL, 0x002b38ccUL, 
-0x002b438eUL, 0x002b4ffbUL, 0x002b5711UL, 0x002b5b64UL, 0x002b66c5UL, 0x002b6ab0UL, 0x002b725aUL, 0x002b7e2fUL, 
-0x002b84deUL, 0x002b88abUL, 0x002b9041UL, 0x002b9c34UL, 0x002ba195UL, 0x002bade0UL, 0x002bb50aUL, 0x002bb97fUL, 
-0x002bc23dUL, 0x002bce48UL, 0x002bd6a2UL, 0x002bdad7UL, 0x002be776UL, 0x002beb03UL, 0x002bf3e9UL, 0x002bff9cUL, 
-0x002c012aUL, 0x002c0d5fUL, 0x002c15b5UL, 0x002c19c0UL, 0x002c2461UL, 0x002c2814UL, 0x002c30feUL, 0x002c3c8bUL, 
-0x002c47c9UL, 0x002c4bbcUL, 0x002c5356UL, 0x002c5f23UL, 0x002c6282UL, 0x002c6ef7UL, 0x002c761dUL, 0x002c7a68UL, 
-0x002c8099UL, 0x002c8cecUL, 0x002c9406UL, 0x002c9873UL, 0x002ca5d2UL, 0x002ca9a7UL, 0x002cb14dUL, 0x002cbd38UL, 
-0x002cc67aUL, 0x002cca0fUL, 0x002cd2e5UL, 0x002cde90UL, 0x002ce331UL, 0x002cef44UL, 0x002cf7aeUL, 0x002cfbdbUL, 
-0x002d024cUL, 0x002d0e39UL, 0x002d16d3UL, 0x002d1aa6UL, 0x002d2707UL, 0x002d2b72UL, 0x002d3398UL, 0x002d3fedUL, 
-0x002d44afUL, 0x002d48daUL, 0x002d5030UL, 0x002d5c45UL, 0x002d61e4UL, 0x002d6d91UL, 0x002d757bUL, 0x002d790eUL, 
-0x002d83ffUL, 0x002d8f8aUL, 0x002d9760UL, 0x002d9b15UL, 0x002da6b4UL, 0x002daac1UL, 0x002db22bUL, 0x002dbe5eUL, 
-0x002dc51cUL, 0x002dc969UL, 0x002dd183UL, 0x002dddf6UL, 0x002de057UL, 0x002dec22UL, 0x002df4c8UL, 0x002df8bdUL, 
-0x002e07e6UL, 0x002e0b93UL, 0x002e1379UL, 0x002e1f0cUL, 0x002e22adUL, 0x002e2ed8UL, 0x002e3632UL, 0x002e3a47UL, 
-0x002e4105UL, 0x002e4d70UL, 0x002e559aUL, 0x002e59efUL, 0x002e644eUL, 0x002e683bUL, 0x002e70d1UL, 0x002e7ca4UL, 
-0x002e8655UL, 0x002e8a20UL, 0x002e92caUL, 0x002e9ebfUL, 0x002ea31eUL, 0x002eaf6bUL, 0x002eb781UL, 0x002ebbf4UL, 
-0x002ec0b6UL, 0x002eccc3UL, 0x002ed429UL, 0x002ed85cUL, 0x002ee5fdUL, 0x002ee988UL, 0x002ef162UL, 0x002efd17UL, 
-0x002f0480UL, 0x002f08f5UL, 0x002f101fUL, 0x002f1c6aUL, 0x002f21cbUL, 0x002f2dbeUL, 0x002f3554UL, 0x002f3921UL, 
-0x002f4263UL, 0x002f4e16UL, 0x002f56fcUL, 0x002f5a89UL, 0x002f6728UL, 0x002f6b5dUL, 0x002f73b7UL, 0x002f7fc2UL, 
-0x002f8533UL, 0x002f8946UL, 0x002f91acUL, 0x002f9dd9UL, 0x002fa078UL, 0x002fac0dUL, 0x002fb4e7UL, 0x002fb892UL, 
-0x002fc3d0UL, 0x002fcfa5UL, 0x002fd74fUL, 0x002fdb3aUL, 0x002fe69bUL, 0x002feaeeUL, 0x002ff204UL, 0x002ffe71UL, 
-0x003004a9UL, 0x003008dcUL, 0x00301036UL, 0x00301c43UL, 0x003021e2UL, 0x00302d97UL, 0x0030357dUL, 0x00303908UL, 
-0x0030424aUL, 0x00304e3fUL, 0x003056d5UL, 0x00305aa0UL, 0x00306701UL, 0x00306b74UL, 0x0030739eUL, 0x00307febUL, 
-0x0030851aUL, 0x0030896fUL, 0x00309185UL, 0x00309df0UL, 0x0030a051UL, 0x0030ac24UL, 0x0030b4ceUL, 0x0030b8bbUL, 
-0x0030c3f9UL, 0x0030cf8cUL, 0x0030d766UL, 0x0030db13UL, 0x0030e6b2UL, 0x0030eac7UL, 0x0030f22dUL, 0x0030fe58UL, 
-0x003107cfUL, 0x00310bbaUL, 0x00311350UL, 0x00311f25UL, 0x00312284UL, 0x00312ef1UL, 0x0031361bUL, 0x00313a6eUL, 
-0x0031412cUL, 0x00314d59UL, 0x003155b3UL, 0x003159c6UL, 0x00316467UL, 0x00316812UL, 0x003170f8UL, 0x00317c8dUL, 
-0x0031867cUL, 0x00318a09UL, 0x003192e3UL, 0x00319e96UL, 0x0031a337UL, 0x0031af42UL, 0x0031b7a8UL, 0x0031bbddUL, 
-0x0031c09fUL, 0x0031cceaUL, 0x0031d400UL, 0x0031d875UL, 0x0031e5d4UL, 0x0031e9a1UL, 0x0031f14bUL, 0x0031fd3eUL, 
-0x00320265UL, 0x00320e10UL, 0x003216faUL, 0x00321a8fUL, 0x0032272eUL, 0x00322b5bUL, 0x003233b1UL, 0x00323fc4UL, 
-0x00324486UL, 0x003248f3UL, 0x00325019UL, 0x00325c6cUL, 0x003261cdUL, 0x00326db8UL, 0x00327552UL, 0x00327927UL, 
-0x003283d6UL, 0x00328fa3UL, 0x00329749UL, 0x00329b3cUL, 0x0032a69dUL, 0x0032aae8UL, 0x0032b202UL, 0x0032be77UL, 
-0x0032c535UL, 0x0032c940UL, 0x0032d1aaUL, 0x0032dddfUL, 0x0032e07eUL, 0x0032ec0bUL, 0x0032f4e1UL, 0x0032f894UL, 
-0x00330103UL, 0x00330d76UL, 0x0033159cUL, 0x003319e9UL, 0x00332448UL, 0x0033283dUL, 0x003330d7UL, 0x00333ca2UL, 
-0x003347e0UL, 0x00334b95UL, 0x0033537fUL, 0x00335f0aUL, 0x003362abUL, 0x00336edeUL, 0x00337634UL, 0x00337a41UL, 
-0x003380b0UL, 0x00338cc5UL, 0x0033942fUL, 0x0033985aUL, 0x0033a5fbUL, 0x0033a98eUL, 0x0033b164UL, 0x0033bd11UL, 
-0x0033c653UL, 0x0033ca26UL, 0x0033d2ccUL, 0x0033deb9UL, 0x0033e318UL, 0x0033ef6dUL, 0x0033f787UL, 0x0033fbf2UL, 
-0x00340544UL, 0x00340931UL, 0x003411dbUL, 0x00341daeUL, 0x0034200fUL, 0x00342c7aUL, 0x00343490UL, 0x003438e5UL, 
-0x003443a7UL, 0x00344fd2UL, 0x00345738UL, 0x00345b4dUL, 0x003466ecUL, 0x00346a99UL, 0x00347273UL, 0x00347e06UL, 
-0x003484f7UL, 0x00348882UL, 0x00349068UL, 0x00349c1dUL, 0x0034a1bcUL, 0x0034adc9UL, 0x0034b523UL, 0x0034b956UL, 
-0x0034c214UL, 0x0034ce61UL, 0x0034d68bUL, 0x0034dafeUL, 0x0034e75fUL, 0x0034eb2aUL, 0x0034f3c0UL, 0x0034ffb5UL, 
-0x00350622UL, 0x00350a57UL, 0x003512bdUL, 0x00351ec8UL, 0x00352369UL, 0x00352f1cUL, 0x003537f6UL, 0x00353b83UL, 
-0x003540c1UL, 0x00354cb4UL, 0x0035545eUL, 0x0035582bUL, 0x0035658aUL, 0x003569ffUL, 0x00357115UL, 0x00357d60UL, 
-0x00358791UL, 0x00358be4UL, 0x0035930eUL, 0x00359f7bUL, 0x0035a2daUL, 0x0035aeafUL, 0x0035b645UL, 0x0035ba30UL, 
-0x0035c172UL, 0x0035cd07UL, 0x0035d5edUL, 0x0035d998UL, 0x0035e439UL, 0x0035e84cUL, 0x0035f0a6UL, 0x0035fcd3UL, 
-0x00360388UL, 0x00360ffdUL, 0x00361717UL, 0x00361b62UL, 0x003626c3UL, 0x00362ab6UL, 0x0036325cUL, 0x00363e29UL, 
-0x0036456bUL, 0x0036491eUL, 0x003651f4UL, 0x00365d81UL, 0x00366020UL, 0x00366c55UL, 0x003674bfUL, 0x003678caUL, 
-0x0036823bUL, 0x00368e4eUL, 0x003696a4UL, 0x00369ad1UL, 0x0036a770UL, 0x0036ab05UL, 0x0036b3efUL, 0x0036bf9aUL, 
-0x0036c4d8UL, 0x0036c8adUL, 0x0036d047UL, 0x0036dc32UL, 0x0036e193UL, 0x0036ede6UL, 0x0036f50cUL, 0x0036f979UL, 
-0x003700eeUL, 0x00370c9bUL, 0x00371471UL, 0x00371804UL, 0x003725a5UL, 0x003729d0UL, 0x0037313aUL, 0x00373d4fUL, 
-0x0037460dUL, 0x00374a78UL, 0x00375292UL, 0x00375ee7UL, 0x00376346UL, 0x00376f33UL, 0x003777d9UL, 0x00377bacUL, 
-0x0037815dUL, 0x00378d28UL, 0x003795c2UL, 0x003799b7UL, 0x0037a416UL, 0x0037a863UL, 0x0037b089UL, 0x0037bcfcUL, 
-0x0037c7beUL, 0x0037cbcbUL, 0x0037d321UL, 0x0037df54UL, 0x0037e2f5UL, 0x0037ee80UL, 0x0037f66aUL, 0x0037fa1fUL, 
-0x00380773UL, 0x00380b06UL, 0x003813ecUL, 0x00381f99UL, 0x00382238UL, 0x00382e4dUL, 0x003836a7UL, 0x00383ad2UL, 
-0x00384190UL, 0x00384de5UL, 0x0038550fUL, 0x0038597aUL, 0x003864dbUL, 0x003868aeUL, 0x00387044UL, 0x00387c31UL, 
-0x003886c0UL, 0x00388ab5UL, 0x0038925fUL, 0x00389e2aUL, 0x0038a38bUL, 0x0038affeUL, 0x0038b714UL, 0x0038bb61UL, 
-0x0038c023UL, 0x0038cc56UL, 0x0038d4bcUL, 0x0038d8c9UL, 0x0038e568UL, 0x0038e91dUL, 0x0038f1f7UL, 0x0038fd82UL, 
-0x00390415UL, 0x00390860UL, 0x0039108aUL, 0x00391cffUL, 0x0039215eUL, 0x00392d2bUL, 0x003935c1UL, 0x003939b4UL, 
-0x003942f6UL, 0x00394e83UL, 0x00395669UL, 0x00395a1cUL, 0x003967bdUL, 0x00396bc8UL, 0x00397322UL, 0x00397f57UL, 
-0x003985a6UL, 0x003989d3UL, 0x00399139UL, 0x00399d4cUL, 0x0039a0edUL, 0x0039ac98UL, 0x0039b472UL, 0x0039b807UL, 
-0x0039c345UL, 0x0039cf30UL, 0x0039d7daUL, 0x0039dbafUL, 0x0039e60eUL, 0x0039ea7bUL, 0x0039f291UL, 0x0039fee4UL, 
-0x003a01bfUL, 0x003a0dcaUL, 0x003a1520UL, 0x003a1955UL, 0x003a24f4UL, 0x003a2881UL, 0x003a306bUL, 0x003a3c1eUL, 
-0x003a475cUL, 0x003a4b29UL, 0x003a53c3UL, 0x003a5fb6UL, 0x003a6217UL, 0x003a6e62UL, 0x003a7688UL, 0x003a7afdUL, 
-0x003a800cUL, 0x003a8c79UL, 0x003a9493UL, 0x003a98e6UL, 0x003aa547UL, 0x003aa932UL, 0x003ab1d8UL, 0x003abdadUL, 
-0x003ac6efUL, 0x003aca9aUL, 0x003ad270UL, 0x003ade05UL, 0x003ae3a4UL, 0x003aefd1UL, 0x003af73bUL, 0x003afb4eUL, 
-0x003b02d9UL, 0x003b0eacUL, 0x003b1646UL, 0x003b1a33UL, 0x003b2792UL, 0x003b2be7UL, 0x003b330dUL, 0x003b3f78UL, 
-0x003b443aUL, 0x003b484fUL, 0x003b50a5UL, 0x003b5cd0UL, 0x003b6171UL, 0x003b6d04UL, 0x003b75eeUL, 0x003b799bUL, 
-0x003b836aUL, 0x003b8f1fUL, 0x003b97f5UL, 0x003b9b80UL, 0x003ba621UL, 0x003baa54UL, 0x003bb2beUL, 0x003bbecbUL, 
-0x003bc589UL, 0x003bc9fcUL, 0x003bd116UL, 0x003bdd63UL, 0x003be0c2UL, 0x003becb7UL, 0x003bf45dUL, 0x003bf828UL, 
-0x003c069eUL, 0x003c0aebUL, 0x003c1201UL, 0x003c1e74UL, 0x003c23d5UL, 0x003c2fa0UL, 0x003c374aUL, 0x003c3b3fUL, 
-0x003c407dUL, 0x003c4c08UL, 0x003c54e2UL, 0x003c5897UL, 0x003c6536UL, 0x003c6943UL, 0x003c71a9UL, 0x003c7ddcUL, 
-0x003c872dUL, 0x003c8b58UL, 0x003c93b2UL, 0x003c9fc7UL, 0x003ca266UL, 0x003cae13UL, 0x003cb6f9UL, 0x003cba8cUL, 
-0x003cc1ceUL, 0x003ccdbbUL, 0x003cd551UL, 0x003cd924UL, 0x003ce485UL, 0x003ce8f0UL, 0x003cf01aUL, 0x003cfc6fUL, 
-0x003d05f8UL, 0x003d098dUL, 0x003d1167UL, 0x003d1d12UL, 0x003d20b3UL, 0x003d2cc6UL, 0x003d342cUL, 0x003d3859UL, 
-0x003d431bUL, 0x003d4f6eUL, 0x003d5784UL, 0x003d5bf1UL, 0x003d6650UL, 0x003d6a25UL, 0x003d72cfUL, 0x003d7ebaUL, 
-0x003d844bUL, 0x003d883eUL, 0x003d90d4UL, 0x003d9ca1UL, 0x003da100UL, 0x003dad75UL, 0x003db59fUL, 0x003db9eaUL, 
-0x003dc2a8UL, 0x003dceddUL, 0x003dd637UL, 0x003dda42UL, 0x003de7e3UL, 0x003deb96UL, 0x003df37cUL, 0x003dff09UL, 
-0x003e0052UL, 0x003e0c27UL, 0x003e14cdUL, 0x003e18b8UL, 0x003e2519UL, 0x003e296cUL, 0x003e3186UL, 0x003e3df3UL, 
-0x003e46b1UL, 0x003e4ac4UL, 0x003e522eUL, 0x003e5e5bUL, 0x003e63faUL, 0x003e6f8fUL, 0x003e7765UL, 0x003e7b10UL, 
-0x003e81e1UL, 0x003e8d94UL, 0x003e957eUL, 0x003e990bUL, 0x003ea4aaUL, 0x003ea8dfUL, 0x003eb035UL, 0x003ebc40UL, 
-0x003ec702UL, 0x003ecb77UL, 0x003ed39dUL, 0x003edfe8UL, 0x003ee249UL, 0x003eee3cUL, 0x003ef6d6UL, 0x003efaa3UL, 
-0x003f0334UL, 0x003f0f41UL, 0x003f17abUL, 0x003f1bdeUL, 0x003f267fUL, 0x003f2a0aUL, 0x003f32e0UL, 0x003f3e95UL, 
-0x003f45d7UL, 0x003f49a2UL, 0x003f5148UL, 0x003f5d3dUL, 0x003f609cUL, 0x003f6ce9UL, 0x003f7403UL, 0x003f7876UL, 
-0x003f8287UL, 0x003f8ef2UL, 0x003f9618UL, 0x003f9a6dUL, 0x003fa7ccUL, 0x003fabb9UL, 0x003fb353UL, 0x003fbf26UL, 
-0x003fc464UL, 0x003fc811UL, 0x003fd0fbUL, 0x003fdc8eUL, 0x003fe12fUL, 0x003fed5aUL, 0x003ff5b0UL, 0x003ff9c5UL, 
-0x0040063aUL, 0x00400a4fUL, 0x004012a5UL, 0x00401ed0UL, 0x00402371UL, 0x00402f04UL, 0x004037eeUL, 0x00403b9bUL, 
-0x004040d9UL, 0x00404cacUL, 0x00405446UL, 0x00405833UL, 0x00406592UL, 0x004069e7UL, 0x0040710dUL, 0x00407d78UL, 
-0x00408789UL, 0x00408bfcUL, 0x00409316UL, 0x00409f63UL, 0x0040a2c2UL, 0x0040aeb7UL, 0x0040b65dUL, 0x0040ba28UL, 
-0x0040c16aUL, 0x0040cd1fUL, 0x0040d5f5UL, 0x0040d980UL, 0x0040e421UL, 0x0040e854UL, 0x0040f0beUL, 0x0040fccbUL, 
-0x0041055cUL, 0x00410929UL, 0x004111c3UL, 0x00411db6UL, 0x00412017UL, 0x00412c62UL, 0x00413488UL, 0x004138fdUL, 
-0x004143bfUL, 0x00414fcaUL, 0x00415720UL, 0x00415b55UL, 0x004166f4UL, 0x00416a81UL, 0x0041726bUL, 0x00417e1eUL, 
-0x004184efUL, 0x0041889aUL, 0x00419070UL, 0x00419c05UL, 0x0041a1a4UL, 0x0041add1UL, 0x0041b53bUL, 0x0041b94eUL, 
-0x0041c20cUL, 0x0041ce79UL, 0x0041d693UL, 0x0041dae6UL, 0x0041e747UL, 0x0041eb32UL, 0x0041f3d8UL, 0x0041ffadUL, 
-0x004200f6UL, 0x00420c83UL, 0x00421469UL, 0x0042181cUL, 0x004225bdUL, 0x004229c8UL, 0x00423122UL, 0x00423d57UL, 
-0x00424615UL, 0x00424a60UL, 0x0042528aUL, 0x00425effUL, 0x0042635eUL, 0x00426f2bUL, 0x004277c1UL, 0x00427bb4UL, 
-0x00428145UL, 0x00428d30UL, 0x004295daUL, 0x004299afUL, 0x0042a40eUL, 0x0042a87bUL, 0x0042b091UL, 0x0042bce4UL, 
-0x0042c7a6UL, 0x0042cbd3UL, 0x0042d339UL, 0x0042df4cUL, 0x0042e2edUL, 0x0042ee98UL, 0x0042f672UL, 0x0042fa07UL, 
-0x00430390UL, 0x00430fe5UL, 0x0043170fUL, 0x00431b7aUL, 0x004326dbUL, 0x00432aaeUL, 0x00433244UL, 0x00433e31UL, 
-0x00434573UL, 0x00434906UL, 0x004351ecUL, 0x00435d99UL, 0x00436038UL, 0x00436c4dUL, 0x004374a7UL, 0x004378d2UL, 
-0x00438223UL, 0x00438e56UL, 0x004396bcUL, 0x00439ac9UL, 0x0043a768UL, 0x0043ab1dUL, 0x0043b3f7UL, 0x0043bf82UL, 
-0x0043c4c0UL, 0x0043c8b5UL, 0x0043d05fUL, 0x0043dc2aUL, 0x0043e18bUL, 0x0043edfeUL, 0x0043f514UL, 0x0043f961UL, 
-0x004407d7UL, 0x00440ba2UL, 0x00441348UL, 0x00441f3dUL, 0x0044229cUL, 0x00442ee9UL, 0x00443603UL, 0x00443a76UL, 
-0x00444134UL, 0x00444d41UL, 0x004455abUL, 0x004459deUL, 0x0044647fUL, 0x0044680aUL, 0x004470e0UL, 0x00447c95UL, 
-0x00448664UL, 0x00448a11UL, 0x004492fbUL, 0x00449e8eUL, 0x0044a32fUL, 0x0044af5aUL, 0x0044b7b0UL, 0x0044bbc5UL, 
-0x0044c087UL, 0x0044ccf2UL, 0x0044d418UL, 0x0044d86dUL, 0x0044e5ccUL, 0x0044e9b9UL, 0x0044f153UL, 0x0044fd26UL, 
-0x004504b1UL, 0x004508c4UL, 0x0045102eUL, 0x00451c5bUL, 0x004521faUL, 0x00452d8fUL, 0x00453565UL, 0x00453910UL, 
-0x00454252UL, 0x00454e27UL, 0x004556cdUL, 0x00455ab8UL, 0x00456719UL, 0x00456b6cUL, 0x00457386UL, 0x00457ff3UL, 
-0x00458502UL, 0x00458977UL, 0x0045919dUL, 0x00459de8UL, 0x0045a049UL, 0x0045ac3cUL, 0x0045b4d6UL, 0x0045b8a3UL, 
-0x0045c3e1UL, 0x0045cf94UL, 0x0045d77eUL, 0x0045db0bUL, 0x0045e6aaUL, 0x0045eadfUL, 0x0045f235UL, 0x0045fe40UL, 
-0x0046011bUL, 0x00460d6eUL, 0x00461584UL, 0x004619f1UL, 0x00462450UL, 0x00462825UL, 0x004630cfUL, 0x00463cbaUL, 
-0x004647f8UL, 0x00464b8dUL, 0x00465367UL, 0x00465f12UL, 0x004662b3UL, 0x00466ec6UL, 0x0046762cUL, 0x00467a59UL, 
-0x004680a8UL, 0x00468cddUL, 0x00469437UL, 0x00469842UL, 0x0046a5e3UL, 0x0046a996UL, 0x0046b17cUL, 0x0046bd09UL, 
-0x0046c64bUL, 0x0046ca3eUL, 0x0046d2d4UL, 0x0046dea1UL, 0x0046e300UL, 0x0046ef75UL, 0x0046f79fUL, 0x0046fbeaUL, 
-0x0047027dUL, 0x00470e08UL, 0x004716e2UL, 0x00471a97UL, 0x00472736UL, 0x00472b43UL, 0x004733a9UL, 0x00473fdcUL, 
-0x0047449eUL, 0x004748ebUL, 0x00475001UL, 0x00475c74UL, 0x004761d5UL, 0x00476da0UL, 0x0047754aUL, 0x0047793fUL, 
-0x004783ceUL, 0x00478fbbUL, 0x00479751UL, 0x00479b24UL, 0x0047a685UL, 0x0047aaf0UL, 0x0047b21aUL, 0x0047be6fUL, 
-0x0047c52dUL, 0x0047c958UL, 0x0047d1b2UL, 0x0047ddc7UL, 0x0047e066UL, 0x0047ec13UL, 0x0047f4f9UL, 0x0047f88cUL, 
-0x004805e0UL, 0x00480995UL, 0x0048117fUL, 0x00481d0aUL, 0x004820abUL, 0x00482cdeUL, 0x00483434UL, 0x00483841UL, 
-0x00484303UL, 0x00484f76UL, 0x0048579cUL, 0x00485be9UL, 0x00486648UL, 0x00486a3dUL, 0x004872d7UL, 0x00487ea2UL, 
-0x00488453UL, 0x00488826UL, 0x004890ccUL, 0x00489cb9UL, 0x0048a118UL, 0x0048ad6dUL, 0x0048b587UL, 0x0048b9f2UL, 
-0x0048c2b0UL, 0x0048cec5UL, 0x0048d62fUL, 0x0048da5aUL, 0x0048e7fbUL, 0x0048eb8eUL, 0x0048f364UL, 0x0048ff11UL, 
-0x00490686UL, 0x00490af3UL, 0x00491219UL, 0x00491e6cUL, 0x004923cdUL, 0x00492fb8UL, 0x00493752UL, 0x00493b27UL, 
-0x00494065UL, 0x00494c10UL, 0x004954faUL, 0x0049588fUL, 0x0049652eUL, 0x0049695bUL, 0x004971b1UL, 0x00497dc4UL, 
-0x00498735UL, 0x00498b40UL, 0x004993aaUL, 0x00499fdfUL, 0x0049a27eUL, 0x0049ae0bUL, 0x0049b6e1UL, 0x0049ba94UL, 
-0x0049c1d6UL, 0x0049cda3UL, 0x0049d549UL, 0x0049d93cUL, 0x0049e49dUL, 0x0049e8e8UL, 0x0049f002UL, 0x0049fc77UL, 
-0x004a032cUL, 0x004a0f59UL, 0x004a17b3UL, 0x004a1bc6UL, 0x004a2667UL, 0x004a2a12UL, 0x004a32f8UL, 0x004a3e8dUL, 
-0x004a45cfUL, 0x004a49baUL, 0x004a5150UL, 0x004a5d25UL, 0x004a6084UL, 0x004a6cf1UL, 0x004a741bUL, 0x004a786eUL, 
-0x004a829fUL, 0x004a8eeaUL, 0x004a9600UL, 0x004a9a75UL, 0x004aa7d4UL, 0x004aaba1UL, 0x004ab34bUL, 0x004abf3eUL, 
-0x004ac47cUL, 0x004ac809UL, 0x004ad0e3UL, 0x004adc96UL, 0x004ae137UL, 0x004aed42UL, 0x004af5a8UL, 0x004af9ddUL, 
-0x004b004aUL, 0x004b0c3fUL, 0x004b14d5UL, 0x004b18a0UL, 0x004b2501UL, 0x004b2974UL, 0x004b319eUL, 0x004b3debUL, 
-0x004b46a9UL, 0x004b4adcUL, 0x004b5236UL, 0x004b5e43UL, 0x004b63e2UL, 0x004b6f97UL, 0x004b777dUL, 0x004b7b08UL, 
-0x004b81f9UL, 0x004b8d8cUL, 0x004b9566UL, 0x004b9913UL, 0x004ba4b2UL, 0x004ba8c7UL, 0x004bb02dUL, 0x004bbc58UL, 
-0x004bc71aUL, 0x004bcb6fUL, 0x004bd385UL, 0x004bdff0UL, 0x004be251UL, 0x004bee24UL, 0x004bf6ceUL, 0x004bfabbUL, 
-0x004c040dUL, 0x004c0878UL, 0x004c1092UL, 0x004c1ce7UL, 0x004c2146UL, 0x004c2d33UL, 0x004c35d9UL, 0x004c39acUL, 
-0x004c42eeUL, 0x004c4e9bUL, 0x004c5671UL, 0x004c5a04UL, 0x004c67a5UL, 0x004c6bd0UL, 0x004c733aUL, 0x004c7f4fUL, 
-0x004c85beUL, 0x004c89cbUL, 0x004c9121UL, 0x004c9d54UL, 0x004ca0f5UL, 0x004cac80UL, 0x004cb46aUL, 0x004cb81fUL, 
-0x004cc35dUL, 0x004ccf28UL, 0x004cd7c2UL, 0x004cdbb7UL, 0x004ce616UL, 0x004cea63UL, 0x004cf289UL, 0x004cfefcUL, 
-0x004d076bUL, 0x004d0b1eUL, 0x004d13f4UL, 0x004d1f81UL, 0x004d2220UL, 0x004d2e55UL, 0x004d36bfUL, 0x004d3acaUL, 
-0x004d4188UL, 0x004d4dfdUL, 0x004d5517UL, 0x004d5962UL, 0x004d64c3UL, 0x004d68b6UL, 0x004d705cUL, 0x004d7c29UL, 
-0x004d86d8UL, 0x004d8aadUL, 0x004d9247UL, 0x004d9e32UL, 0x004da393UL, 0x004dafe6UL, 0x004db70cUL, 0x004dbb79UL, 
-0x004dc03bUL, 0x004dcc4eUL, 0x004dd4a4UL, 0x004dd8d1UL, 0x004de570UL, 0x004de905UL, 0x004df1efUL, 0x004dfd9aUL, 
-0x004e02c1UL, 0x004e0eb4UL, 0x004e165eUL, 0x004e1a2bUL, 0x004e278aUL, 0x004e2bffUL, 0x004e3315UL, 0x004e3f60UL, 
-0x004e4422UL, 0x004e4857UL, 0x004e50bdUL, 0x004e5cc8UL, 0x004e6169UL, 0x004e6d1cUL, 0x004e75f6UL, 0x004e7983UL, 
-0x004e8372UL, 0x004e8f07UL, 0x004e97edUL, 0x004e9b98UL, 0x004ea639UL, 0x004eaa4cUL, 0x004eb2a6UL, 0x004ebed3UL, 
-0x004ec591UL, 0x004ec9e4UL, 0x004ed10eUL, 0x004edd7bUL, 0x004ee0daUL, 0x004eecafUL, 0x004ef445UL, 0x004ef830UL, 
-0x004f01a7UL, 0x004f0dd2UL, 0x004f1538UL, 0x004f194dUL, 0x004f24ecUL, 0x004f2899UL, 0x004f3073UL, 0x004f3c06UL, 
-0x004f4744UL, 0x004f4b31UL, 0x004f53dbUL, 0x004f5faeUL, 0x004f620fUL, 0x004f6e7aUL, 0x004f7690UL, 0x004f7ae5UL, 
-0x004f8014UL, 0x004f8c61UL, 0x004f948bUL, 0x004f98feUL, 0x004fa55fUL, 0x004fa92aUL, 0x004fb1c0UL, 0x004fbdb5UL, 
-0x004fc6f7UL, 0x004fca82UL, 0x004fd268UL, 0x004fde1dUL, 0x004fe3bcUL, 0x004fefc9UL, 0x004ff723UL, 0x004ffb56UL, 
-0x0050018eUL, 0x00500dfbUL, 0x00501511UL, 0x00501964UL, 0x005024c5UL, 0x005028b0UL, 0x0050305aUL, 0x00503c2fUL, 
-0x0050476dUL, 0x00504b18UL, 0x005053f2UL, 0x00505f87UL, 0x00506226UL, 0x00506e53UL, 0x005076b9UL, 0x00507accUL, 
-0x0050803dUL, 0x00508c48UL, 0x005094a2UL, 0x005098d7UL, 0x0050a576UL, 0x0050a903UL, 0x0050b1e9UL, 0x0050bd9cUL, 
-0x0050c6deUL, 0x0050caabUL, 0x0050d241UL, 0x0050de34UL, 0x0050e395UL, 0x0050efe0UL, 0x0050f70aUL, 0x0050fb7fUL, 
-0x005102e8UL, 0x00510e9dUL, 0x00511677UL, 0x00511a02UL, 0x005127a3UL, 0x00512bd6UL, 0x0051333cUL, 0x00513f49UL, 
-0x0051440bUL, 0x0051487eUL, 0x00515094UL, 0x00515ce1UL, 0x00516140UL, 0x00516d35UL, 0x005175dfUL, 0x005179aaUL, 
-0x0051835bUL, 0x00518f2eUL, 0x005197c4UL, 0x00519bb1UL, 0x0051a610UL, 0x0051aa65UL, 0x0051b28fUL, 0x0051befaUL, 
-0x0051c5b8UL, 0x0051c9cdUL, 0x0051d127UL, 0x0051dd52UL, 0x0051e0f3UL, 0x0051ec86UL, 0x0051f46cUL, 0x0051f819UL, 
-0x00520742UL, 0x00520b37UL, 0x005213ddUL, 0x00521fa8UL, 0x00522209UL, 0x00522e7cUL, 0x00523696UL, 0x00523ae3UL, 
-0x005241a1UL, 0x00524dd4UL, 0x0052553eUL, 0x0052594bUL, 0x005264eaUL, 0x0052689fUL, 0x00527075UL, 0x00527c00UL, 
-0x005286f1UL, 0x00528a84UL, 0x0052926eUL, 0x00529e1bUL, 0x0052a3baUL, 0x0052afcfUL, 0x0052b725UL, 0x0052bb50UL, 
-0x0052c012UL, 0x0052cc67UL, 0x0052d48dUL, 0x0052d8f8UL, 0x0052e559UL, 0x0052e92cUL, 0x0052f1c6UL, 0x0052fdb3UL, 
-0x00530424UL, 0x00530851UL, 0x005310bbUL, 0x00531cceUL, 0x0053216fUL, 0x00532d1aUL, 0x005335f0UL, 0x00533985UL, 
-0x005342c7UL, 0x00534eb2UL, 0x00535658UL, 0x00535a2dUL, 0x0053678cUL, 0x00536bf9UL, 0x00537313UL, 0x00537f66UL, 
-0x00538597UL, 0x005389e2UL, 0x00539108UL, 0x00539d7dUL, 0x0053a0dcUL, 0x0053aca9UL, 0x0053b443UL, 0x0053b836UL, 
-0x0053c374UL, 0x0053cf01UL, 0x0053d7ebUL, 0x0053db9eUL, 0x0053e63fUL, 0x0053ea4aUL, 0x0053f2a0UL, 0x0053fed5UL, 
-0x00540063UL, 0x00540c16UL, 0x005414fcUL, 0x00541889UL, 0x00542528UL, 0x0054295dUL, 0x005431b7UL, 0x00543dc2UL, 
-0x00544680UL, 0x00544af5UL, 0x0054521fUL, 0x00545e6aUL, 0x005463cbUL, 0x00546fbeUL, 0x00547754UL, 0x00547b21UL, 
-0x005481d0UL, 0x00548da5UL, 0x0054954fUL, 0x0054993aUL, 0x0054a49bUL, 0x0054a8eeUL, 0x0054b004UL, 0x0054bc71UL, 
-0x0054c733UL, 0x0054cb46UL, 0x0054d3acUL, 0x0054dfd9UL, 0x0054e278UL, 0x0054ee0dUL, 0x0054f6e7UL, 0x0054fa92UL, 
-0x00550305UL, 0x00550f70UL, 0x0055179aUL, 0x00551befUL, 0x0055264eUL, 0x00552a3bUL, 0x005532d1UL, 0x00553ea4UL, 
-0x005545e6UL, 0x00554993UL, 0x00555179UL, 0x00555d0cUL, 0x005560adUL, 0x00556cd8UL, 0x00557432UL, 0x00557847UL, 
-0x005582b6UL, 0x00558ec3UL, 0x00559629UL, 0x00559a5cUL, 0x0055a7fdUL, 0x0055ab88UL, 0x0055b362UL, 0x0055bf17UL, 
-0x0055c455UL, 0x0055c820UL, 0x0055d0caUL, 0x0055dcbfUL, 0x0055e11eUL, 0x0055ed6bUL, 0x0055f581UL, 0x0055f9f4UL, 
-0x005606afUL, 0x00560adaUL, 0x00561230UL, 0x00561e45UL, 0x005623e4UL, 0x00562f91UL, 0x0056377bUL, 0x00563b0eUL, 
-0x0056404cUL, 0x00564c39UL, 0x005654d3UL, 0x005658a6UL, 0x00566507UL, 0x00566972UL, 0x00567198UL, 0x00567dedUL, 
-0x0056871cUL, 0x00568b69UL, 0x00569383UL, 0x00569ff6UL, 0x0056a257UL, 0x0056ae22UL, 0x0056b6c8UL, 0x0056babdUL, 
-0x0056c1ffUL, 0x0056cd8aUL, 0x0056d560UL, 0x0056d915UL, 0x0056e4b4UL, 0x0056e8c1UL, 0x0056f02bUL, 0x0056fc5eUL, 
-0x005705c9UL, 0x005709bcUL, 0x00571156UL, 0x00571d23UL, 0x00572082UL, 0x00572cf7UL, 0x0057341dUL, 0x00573868UL, 
-0x0057432aUL, 0x00574f5fUL, 0x005757b5UL, 0x00575bc0UL, 0x00576661UL, 0x00576a14UL, 0x005772feUL, 0x00577e8bUL, 
-0x0057847aUL, 0x0057880fUL, 0x005790e5UL, 0x00579c90UL, 0x0057a131UL, 0x0057ad44UL, 0x0057b5aeUL, 0x0057b9dbUL, 
-0x0057c299UL, 0x0057ceecUL, 0x0057d606UL, 0x0057da73UL, 0x0057e7d2UL, 0x0057eba7UL, 0x0057f34dUL, 0x0057ff38UL, 
-0x00580254UL, 0x00580e21UL, 0x005816cbUL, 0x00581abeUL, 0x0058271fUL, 0x00582b6aUL, 0x00583380UL, 0x00583ff5UL, 
-0x005844b7UL, 0x005848c2UL, 0x00585028UL, 0x00585c5dUL, 0x005861fcUL, 0x00586d89UL, 0x00587563UL, 0x00587916UL, 
-0x005883e7UL, 0x00588f92UL, 0x00589778UL, 0x00589b0dUL, 0x0058a6acUL, 0x0058aad9UL, 0x0058b233UL, 0x0058be46UL, 
-0x0058c504UL, 0x0058c971UL, 0x0058d19bUL, 0x0058ddeeUL, 0x0058e04fUL, 0x0058ec3aUL, 0x0058f4d0UL, 0x0058f8a5UL, 
-0x00590132UL, 0x00590d47UL, 0x005915adUL, 0x005919d8UL, 0x00592479UL, 0x0059280cUL, 0x005930e6UL, 0x00593c93UL, 
-0x005947d1UL, 0x00594ba4UL, 0x0059534eUL, 0x00595f3bUL, 0x0059629aUL, 0x00596eefUL, 0x00597605UL, 0x00597a70UL, 
-0x00598081UL, 0x00598cf4UL, 0x0059941eUL, 0x0059986bUL, 0x0059a5caUL, 0x0059a9bfUL, 0x0059b155UL, 0x0059bd20UL, 
-0x0059c662UL, 0x0059ca17UL, 0x0059d2fdUL, 0x0059de88UL, 0x0059e329UL, 0x0059ef5cUL, 0x0059f7b6UL, 0x0059fbc3UL, 
-0x005a0498UL, 0x005a08edUL, 0x005a1007UL, 0x005a1c72UL, 0x005a21d3UL, 0x005a2da6UL, 0x005a354cUL, 0x005a3939UL, 
-0x005a427bUL, 0x005a4e0eUL, 0x005a56e4UL, 0x005a5a91UL, 0x005a6730UL, 0x005a6b45UL, 0x005a73afUL, 0x005a7fdaUL, 
-0x005a852bUL, 0x005a895eUL, 0x005a91b4UL, 0x005a9dc1UL, 0x005aa060UL, 0x005aac15UL, 0x005ab4ffUL, 0x005ab88aUL, 
-0x005ac3c8UL, 0x005acfbdUL, 0x005ad757UL, 0x005adb22UL, 0x005ae683UL, 0x005aeaf6UL, 0x005af21cUL, 0x005afe69UL, 
-0x005b07feUL, 0x005b0b8bUL, 0x005b1361UL, 0x005b1f14UL, 0x005b22b5UL, 0x005b2ec0UL, 0x005b362aUL, 0x005b3a5fUL, 
-0x005b411dUL, 0x005b4d68UL, 0x005b5582UL, 0x005b59f7UL, 0x005b6456UL, 0x005b6823UL, 0x005b70c9UL, 0x005b7cbcUL, 
-0x005b864dUL, 0x005b8a38UL, 0x005b92d2UL, 0x005b9ea7UL, 0x005ba306UL, 0x005baf73UL, 0x005bb799UL, 0x005bbbecUL, 
-0x005bc0aeUL, 0x005bccdbUL, 0x005bd431UL, 0x005bd844UL, 0x005be5e5UL, 0x005be990UL, 0x005bf17aUL, 0x005bfd0fUL, 
-0x005c03b9UL, 0x005c0fccUL, 0x005c1726UL, 0x005c1b53UL, 0x005c26f2UL, 0x005c2a87UL, 0x005c326dUL, 0x005c3e18UL, 
-0x005c455aUL, 0x005c492fUL, 0x005c51c5UL, 0x005c5db0UL, 0x005c6011UL, 0x005c6c64UL, 0x005c748eUL, 0x005c78fbUL, 
-0x005c820aUL, 0x005c8e7fUL, 0x005c9695UL, 0x005c9ae0UL, 0x005ca741UL, 0x005cab34UL, 0x005cb3deUL, 0x005cbfabUL, 
-0x005cc4e9UL, 0x005cc89cUL, 0x005cd076UL, 0x005cdc03UL, 0x005ce1a2UL, 0x005cedd7UL, 0x005cf53dUL, 0x005cf948UL, 
-0x005d00dfUL, 0x005d0caaUL, 0x005d1440UL, 0x005d1835UL, 0x005d2594UL, 0x005d29e1UL, 0x005d310bUL, 0x005d3d7eUL, 
-0x005d463cUL, 0x005d4a49UL, 0x005d52a3UL, 0x005d5ed6UL, 0x005d6377UL, 0x005d6f02UL, 0x005d77e8UL, 0x005d7b9dUL, 
-0x005d816cUL, 0x005d8d19UL, 0x005d95f3UL, 0x005d9986UL, 0x005da427UL, 0x005da852UL, 0x005db0b8UL, 0x005dbccdUL, 
-0x005dc78fUL, 0x005dcbfaUL, 0x005dd310UL, 0x005ddf65UL, 0x005de2c4UL, 0x005deeb1UL, 0x005df65bUL, 0x005dfa2eUL, 
-0x005e0575UL, 0x005e0900UL, 0x005e11eaUL, 0x005e1d9fUL, 0x005e203eUL, 0x005e2c4bUL, 0x005e34a1UL, 0x005e38d4UL, 
-0x005e4396UL, 0x005e4fe3UL, 0x005e5709UL, 0x005e5b7cUL, 0x005e66ddUL, 0x005e6aa8UL, 0x005e7242UL, 0x005e7e37UL, 
-0x005e84c6UL, 0x005e88b3UL, 0x005e9059UL, 0x005e9c2cUL, 0x005ea18dUL, 0x005eadf8UL, 0x005eb512UL, 0x005eb967UL, 
-0x005ec225UL, 0x005ece50UL, 0x005ed6baUL, 0x005edacfUL, 0x005ee76eUL, 0x005eeb1bUL, 0x005ef3f1UL, 0x005eff84UL, 
-0x005f0613UL, 0x005f0a66UL, 0x005f128cUL, 0x005f1ef9UL, 0x005f2358UL, 0x005f2f2dUL, 0x005f37c7UL, 0x005f3bb2UL, 
-0x005f40f0UL, 0x005f4c85UL, 0x005f546fUL, 0x005f581aUL, 0x005f65bbUL, 0x005f69ceUL, 0x005f7124UL, 0x005f7d51UL, 
-0x005f87a0UL, 0x005f8bd5UL, 0x005f933fUL, 0x005f9f4aUL, 0x005fa2ebUL, 0x005fae9eUL, 0x005fb674UL, 0x005fba01UL, 
-0x005fc143UL, 0x005fcd36UL, 0x005fd5dcUL, 0x005fd9a9UL, 0x005fe408UL, 0x005fe87dUL, 0x005ff097UL, 0x005ffce2UL, 
-0x00600527UL, 0x00600952UL, 0x006011b8UL, 0x00601dcdUL, 0x0060206cUL, 0x00602c19UL, 0x006034f3UL, 0x00603886UL, 
-0x006043c4UL, 0x00604fb1UL, 0x0060575bUL, 0x00605b2eUL, 0x0060668fUL, 0x00606afaUL, 0x00607210UL, 0x00607e65UL, 
-0x00608494UL, 0x006088e1UL, 0x0060900bUL, 0x00609c7eUL, 0x0060a1dfUL, 0x0060adaaUL, 0x0060b540UL, 0x0060b935UL, 
-0x0060c277UL, 0x0060ce02UL, 0x0060d6e8UL, 0x0060da9dUL, 0x0060e73cUL, 0x0060eb49UL, 0x0060f3a3UL, 0x0060ffd6UL, 
-0x00610641UL, 0x00610a34UL, 0x006112deUL, 0x00611eabUL, 0x0061230aUL, 0x00612f7fUL, 0x00613795UL, 0x00613be0UL, 
-0x006140a2UL, 0x00614cd7UL, 0x0061543dUL, 0x00615848UL, 0x006165e9UL, 0x0061699cUL, 0x00617176UL, 0x00617d03UL, 
-0x006187f2UL, 0x00618b87UL, 0x0061936dUL, 0x00619f18UL, 0x0061a2b9UL, 0x0061aeccUL, 0x0061b626UL, 0x0061ba53UL, 
-0x0061c111UL, 0x0061cd64UL, 0x0061d58eUL, 0x0061d9fbUL, 0x0061e45aUL, 0x0061e82fUL, 0x0061f0c5UL, 0x0061fcb0UL, 
-0x006203ebUL, 0x00620f9eUL, 0x00621774UL, 0x00621b01UL, 0x006226a0UL, 0x00622ad5UL, 0x0062323fUL, 0x00623e4aUL, 
-0x00624508UL, 0x0062497dUL, 0x00625197UL, 0x00625de2UL, 0x00626043UL, 0x00626c36UL, 0x006274dcUL, 0x006278a9UL, 
-0x00628258UL, 0x00628e2dUL, 0x006296c7UL, 0x00629ab2UL, 0x0062a713UL, 0x0062ab66UL, 0x0062b38cUL, 0x0062bff9UL, 
-0x0062c4bbUL, 0x0062c8ceUL, 0x0062d024UL, 0x0062dc51UL, 0x0062e1f0UL, 0x0062ed85UL, 0x0062f56fUL, 0x0062f91aUL, 
-0x0063008dUL, 0x00630cf8UL, 0x00631412UL, 0x00631867UL, 0x006325c6UL, 0x006329b3UL, 0x00633159UL, 0x00633d2cUL, 
-0x0063466eUL, 0x00634a1bUL, 0x006352f1UL, 0x00635e84UL, 0x00636325UL, 0x00636f50UL, 0x006377baUL, 0x00637bcfUL, 
-0x0063813eUL, 0x00638d4bUL, 0x006395a1UL, 0x006399d4UL, 0x0063a475UL, 0x0063a800UL, 0x0063b0eaUL, 0x0063bc9fUL, 
-0x0063c7ddUL, 0x0063cba8UL, 0x0063d342UL, 0x0063df37UL, 0x0063e296UL, 0x0063eee3UL, 0x0063f609UL, 0x0063fa7cUL, 
-0x006404caUL, 0x006408bfUL, 0x00641055UL, 0x00641c20UL, 0x00642181UL, 0x00642df4UL, 0x0064351eUL, 0x0064396bUL, 
-0x00644229UL, 0x00644e5cUL, 0x006456b6UL, 0x00645ac3UL, 0x00646762UL, 0x00646b17UL, 0x006473fdUL, 0x00647f88UL, 
-0x00648579UL, 0x0064890cUL, 0x006491e6UL, 0x00649d93UL, 0x0064a032UL, 0x0064ac47UL, 0x0064b4adUL, 0x0064b8d8UL, 
-0x0064c39aUL, 0x0064cfefUL, 0x0064d705UL, 0x0064db70UL, 0x0064e6d1UL, 0x0064eaa4UL, 0x0064f24eUL, 0x0064fe3bUL, 
-0x006507acUL, 0x00650bd9UL, 0x00651333UL, 0x00651f46UL, 0x006522e7UL, 0x00652e92UL, 0x00653678UL, 0x00653a0dUL, 
-0x0065414fUL, 0x00654d3aUL, 0x006555d0UL, 0x006559a5UL, 0x00656404UL, 0x00656871UL, 0x0065709bUL, 0x00657ceeUL, 
-0x0065861fUL, 0x00658a6aUL, 0x00659280UL, 0x00659ef5UL, 0x0065a354UL, 0x0065af21UL, 0x0065b7cbUL, 0x0065bbbeUL, 
-0x0065c0fcUL, 0x0065cc89UL, 0x0065d463UL, 0x0065d816UL, 0x0065e5b7UL, 0x0065e9c2UL, 0x0065f128UL, 0x0065fd5dUL, 
-0x00660206UL, 0x00660e73UL, 0x00661699UL, 0x00661aecUL, 0x0066274dUL, 0x00662b38UL, 0x006633d2UL, 0x00663fa7UL, 
-0x006644e5UL, 0x00664890UL, 0x0066507aUL, 0x00665c0fUL, 0x006661aeUL, 0x00666ddbUL, 0x00667531UL, 0x00667944UL, 
-0x006683b5UL, 0x00668fc0UL, 0x0066972aUL, 0x00669b5fUL, 0x0066a6feUL, 0x0066aa8bUL, 0x0066b261UL, 0x0066be14UL, 
-0x0066c556UL, 0x0066c923UL, 0x0066d1c9UL, 0x0066ddbcUL, 0x0066e01dUL, 0x0066ec68UL, 0x0066f482UL, 0x0066f8f7UL, 
-0x00670160UL, 0x00670d15UL, 0x006715ffUL, 0x0067198aUL, 0x0067242bUL, 0x0067285eUL, 0x006730b4UL, 0x00673cc1UL, 
-0x00674783UL, 0x00674bf6UL, 0x0067531cUL, 0x00675f69UL, 0x006762c8UL, 0x00676ebdUL, 0x00677657UL, 0x00677a22UL, 
-0x006780d3UL, 0x00678ca6UL, 0x0067944cUL, 0x00679839UL, 0x0067a598UL, 0x0067a9edUL, 0x0067b107UL, 0x0067bd72UL, 
-0x0067c630UL, 0x0067ca45UL, 0x0067d2afUL, 0x0067dedaUL, 0x0067e37bUL, 0x0067ef0eUL, 0x0067f7e4UL, 0x0067fb91UL, 
-0x006806fdUL, 0x00680a88UL, 0x00681262UL, 0x00681e17UL, 0x006823b6UL, 0x00682fc3UL, 0x00683729UL, 0x00683b5cUL, 
-0x0068401eUL, 0x00684c6bUL, 0x00685481UL, 0x006858f4UL, 0x00686555UL, 0x00686920UL, 0x006871caUL, 0x00687dbfUL, 
-0x0068874eUL, 0x00688b3bUL, 0x006893d1UL, 0x00689fa4UL, 0x0068a205UL, 0x0068ae70UL, 0x0068b69aUL, 0x0068baefUL, 
-0x0068c1adUL, 0x0068cdd8UL, 0x0068d532UL, 0x0068d947UL, 0x0068e4e6UL, 0x0068e893UL, 0x0068f079UL, 0x0068fc0cUL, 
-0x0069059bUL, 0x006909eeUL, 0x00691104UL, 0x00691d71UL, 0x006920d0UL, 0x00692ca5UL, 0x0069344fUL, 0x0069383aUL, 
-0x00694378UL, 0x00694f0dUL, 0x006957e7UL, 0x00695b92UL, 0x00696633UL, 0x00696a46UL, 0x006972acUL, 0x00697ed9UL, 
-0x00698428UL, 0x0069885dUL, 0x006990b7UL, 0x00699cc2UL, 0x0069a163UL, 0x0069ad16UL, 0x0069b5fcUL, 0x0069b989UL, 
-0x0069c2cbUL, 0x0069cebeUL, 0x0069d654UL, 0x0069da21UL, 0x0069e780UL, 0x0069ebf5UL, 0x0069f31fUL, 0x0069ff6aUL, 
-0x006a0031UL, 0x006a0c44UL, 0x006a14aeUL, 0x006a18dbUL, 0x006a257aUL, 0x006a290fUL, 0x006a31e5UL, 0x006a3d90UL, 
-0x006a46d2UL, 0x006a4aa7UL, 0x006a524dUL, 0x006a5e38UL, 0x006a6399UL, 0x006a6fecUL, 0x006a7706UL, 0x006a7b73UL, 
-0x006a8182UL, 0x006a8df7UL, 0x006a951dUL, 0x006a9968UL, 0x006aa4c9UL, 0x006aa8bcUL, 0x006ab056UL, 0x006abc23UL, 
-0x006ac761UL, 0x006acb14UL, 0x006ad3feUL, 0x006adf8bUL, 0x006ae22aUL, 0x006aee5fUL, 0x006af6b5UL, 0x006afac0UL, 
-0x006b0357UL, 0x006b0f22UL, 0x006b17c8UL, 0x006b1bbdUL, 0x006b261cUL, 0x006b2a69UL, 0x006b3283UL, 0x006b3ef6UL, 
-0x006b45b4UL, 0x006b49c1UL, 0x006b512bUL, 0x006b5d5eUL, 0x006b60ffUL, 0x006b6c8aUL, 0x006b7460UL, 0x006b7815UL, 
-0x006b82e4UL, 0x006b8e91UL, 0x006b967bUL, 0x006b9a0eUL, 0x006ba7afUL, 0x006babdaUL, 0x006bb330UL, 0x006bbf45UL, 
-0x006bc407UL, 0x006bc872UL, 0x006bd098UL, 0x006bdcedUL, 0x006be14cUL, 0x006bed39UL, 0x006bf5d3UL, 0x006bf9a6UL, 
-0x006c0710UL, 0x006c0b65UL, 0x006c138fUL, 0x006c1ffaUL, 0x006c225bUL, 0x006c2e2eUL, 0x006c36c4UL, 0x006c3ab1UL, 
-0x006c41f3UL, 0x006c4d86UL, 0x006c556cUL, 0x006c5919UL, 0x006c64b8UL, 0x006c68cdUL, 0x006c7027UL, 0x006c7c52UL, 
-0x006c86a3UL, 0x006c8ad6UL, 0x006c923cUL, 0x006c9e49UL, 0x006ca3e8UL, 0x006caf9dUL, 0x006cb777UL, 0x006cbb02UL, 
-0x006cc040UL, 0x006ccc35UL, 0x006cd4dfUL, 0x006cd8aaUL, 0x006ce50bUL, 0x006ce97eUL, 0x006cf194UL, 0x006cfde1UL, 
-0x006d0476UL, 0x006d0803UL, 0x006d10e9UL, 0x006d1c9cUL, 0x006d213dUL, 0x006d2d48UL, 0x006d35a2UL, 0x006d39d7UL, 
-0x006d4295UL, 0x006d4ee0UL, 0x006d560aUL, 0x006d5a7fUL, 0x006d67deUL, 0x006d6babUL, 0x006d7341UL, 0x006d7f34UL, 
-0x006d85c5UL, 0x006d89b0UL, 0x006d915aUL, 0x006d9d2fUL, 0x006da08eUL, 0x006dacfbUL, 0x006db411UL, 0x006db864UL, 
-0x006dc326UL, 0x006dcf53UL, 0x006dd7b9UL, 0x006ddbccUL, 0x006de66dUL, 0x006dea18UL, 0x006df2f2UL, 0x006dfe87UL, 
-0x006e01dcUL, 0x006e0da9UL, 0x006e1543UL, 0x006e1936UL, 0x006e2497UL, 0x006e28e2UL, 0x006e3008UL, 0x006e3c7dUL, 
-0x006e473fUL, 0x006e4b4aUL, 0x006e53a0UL, 0x006e5fd5UL, 0x006e6274UL, 0x006e6e01UL, 0x006e76ebUL, 0x006e7a9eUL, 
-0x006e806fUL, 0x006e8c1aUL, 0x006e94f0UL, 0x006e9885UL, 0x006ea524UL, 0x006ea951UL, 0x006eb1bbUL, 0x006ebdceUL, 
-0x006ec68cUL, 0x006ecaf9UL, 0x006ed213UL, 0x006ede66UL, 0x006ee3c7UL, 0x006eefb2UL, 0x006ef758UL, 0x006efb2dUL, 
-0x006f02baUL, 0x006f0ecfUL, 0x006f1625UL, 0x006f1a50UL, 0x006f27f1UL, 0x006f2b84UL, 0x006f336eUL, 0x006f3f1bUL, 
-0x006f4459UL, 0x006f482cUL, 0x006f50c6UL, 0x006f5cb3UL, 0x006f6112UL, 0x006f6d67UL, 0x006f758dUL, 0x006f79f8UL, 
-0x006f8309UL, 0x006f8f7cUL, 0x006f9796UL, 0x006f9be3UL, 0x006fa642UL, 0x006faa37UL, 0x006fb2ddUL, 0x006fbea8UL, 
-0x006fc5eaUL, 0x006fc99fUL, 0x006fd175UL, 0x006fdd00UL, 0x006fe0a1UL, 0x006fecd4UL, 0x006ff43eUL, 0x006ff84bUL, 
-0x00700293UL, 0x00700ee6UL, 0x0070160cUL, 0x00701a79UL, 0x007027d8UL, 0x00702badUL, 0x00703347UL, 0x00703f32UL, 
-0x00704470UL, 0x00704805UL, 0x007050efUL, 0x00705c9aUL, 0x0070613bUL, 0x00706d4eUL, 0x007075a4UL, 0x007079d1UL, 
-0x00708320UL, 0x00708f55UL, 0x007097bfUL, 0x00709bcaUL, 0x0070a66bUL, 0x0070aa1eUL, 0x0070b2f4UL, 0x0070be81UL, 
-0x0070c5c3UL, 0x0070c9b6UL, 0x0070d15cUL, 0x0070dd29UL, 0x0070e088UL, 0x0070ecfdUL, 0x0070f417UL, 0x0070f862UL, 
-0x007101f5UL, 0x00710d80UL, 0x0071156aUL, 0x0071191fUL, 0x007124beUL, 0x007128cbUL, 0x00713021UL, 0x00713c54UL, 
-0x00714716UL, 0x00714b63UL, 0x00715389UL, 0x00715ffcUL, 0x0071625dUL, 0x00716e28UL, 0x007176c2UL, 0x00717ab7UL, 
-0x00718046UL, 0x00718c33UL, 0x007194d9UL, 0x007198acUL, 0x0071a50dUL, 0x0071a978UL, 0x0071b192UL, 0x0071bde7UL, 
-0x0071c6a5UL, 0x0071cad0UL, 0x0071d23aUL, 0x0071de4fUL, 0x0071e3eeUL, 0x0071ef9bUL, 0x0071f771UL, 0x0071fb04UL, 
-0x0072045fUL, 0x0072082aUL, 0x007210c0UL, 0x00721cb5UL, 0x00722114UL, 0x00722d61UL, 0x0072358bUL, 0x007239feUL, 
-0x007242bcUL, 0x00724ec9UL, 0x00725623UL, 0x00725a56UL, 0x007267f7UL, 0x00726b82UL, 0x00727368UL, 0x00727f1dUL, 
-0x007285ecUL, 0x00728999UL, 0x00729173UL, 0x00729d06UL, 0x0072a0a7UL, 0x0072acd2UL, 0x0072b438UL, 0x0072b84dUL, 
-0x0072c30fUL, 0x0072cf7aUL, 0x0072d790UL, 0x0072dbe5UL, 0x0072e644UL, 0x0072ea31UL, 0x0072f2dbUL, 0x0072feaeUL, 
-0x00730739UL, 0x00730b4cUL, 0x007313a6UL, 0x00731fd3UL, 0x00732272UL, 0x00732e07UL, 0x007336edUL, 0x00733a98UL, 
-0x007341daUL, 0x00734dafUL, 0x00735545UL, 0x00735930UL, 0x00736491UL, 0x007368e4UL, 0x0073700eUL, 0x00737c7bUL, 
-0x0073868aUL, 0x00738affUL, 0x00739215UL, 0x00739e60UL, 0x0073a3c1UL, 0x0073afb4UL, 0x0073b75eUL, 0x0073bb2bUL, 
-0x0073c069UL, 0x0073cc1cUL, 0x0073d4f6UL, 0x0073d883UL, 0x0073e522UL, 0x0073e957UL, 0x0073f1bdUL, 0x0073fdc8UL, 
-0x0074037eUL, 0x00740f0bUL, 0x007417e1UL, 0x00741b94UL, 0x00742635UL, 0x00742a40UL, 0x007432aaUL, 0x00743edfUL, 
-0x0074459dUL, 0x007449e8UL, 0x00745102UL, 0x00745d77UL, 0x007460d6UL, 0x00746ca3UL, 0x00747449UL, 0x0074783cUL, 
-0x007482cdUL, 0x00748eb8UL, 0x00749652UL, 0x00749a27UL, 0x0074a786UL, 0x0074abf3UL, 0x0074b319UL, 0x0074bf6cUL, 
-0x0074c42eUL, 0x0074c85bUL, 0x0074d0b1UL, 0x0074dcc4UL, 0x0074e165UL, 0x0074ed10UL, 0x0074f5faUL, 0x0074f98fUL, 
-0x00750018UL, 0x00750c6dUL, 0x00751487UL, 0x007518f2UL, 0x00752553UL, 0x00752926UL, 0x007531ccUL, 0x00753db9UL, 
-0x007546fbUL, 0x00754a8eUL, 0x00755264UL, 0x00755e11UL, 0x007563b0UL, 0x00756fc5UL, 0x0075772fUL, 0x00757b5aUL, 
-0x007581abUL, 0x00758ddeUL, 0x00759534UL, 0x00759941UL, 0x0075a4e0UL, 0x0075a895UL, 0x0075b07fUL, 0x0075bc0aUL, 
-0x0075c748UL, 0x0075cb3dUL, 0x0075d3d7UL, 0x0075dfa2UL, 0x0075e203UL, 0x0075ee76UL, 0x0075f69cUL, 0x0075fae9UL, 
-0x007605b2UL, 0x007609c7UL, 0x0076112dUL, 0x00761d58UL, 0x007620f9UL, 0x00762c8cUL, 0x00763466UL, 0x00763813UL, 
-0x00764351UL, 0x00764f24UL, 0x007657ceUL, 0x00765bbbUL, 0x0076661aUL, 0x00766a6fUL, 0x00767285UL, 0x00767ef0UL, 
-0x00768401UL, 0x00768874UL, 0x0076909eUL, 0x00769cebUL, 0x0076a14aUL, 0x0076ad3fUL, 0x0076b5d5UL, 0x0076b9a0UL, 
-0x0076c2e2UL, 0x0076ce97UL, 0x0076d67dUL, 0x0076da08UL, 0x0076e7a9UL, 0x0076ebdcUL, 0x0076f336UL, 0x0076ff43UL, 
-0x007706d4UL, 0x00770aa1UL, 0x0077124bUL, 0x00771e3eUL, 0x0077239fUL, 0x00772feaUL, 0x00773700UL, 0x00773b75UL, 
-0x00774037UL, 0x00774c42UL, 0x007754a8UL, 0x007758ddUL, 0x0077657cUL, 0x00776909UL, 0x007771e3UL, 0x00777d96UL, 
-0x00778767UL, 0x00778b12UL, 0x007793f8UL, 0x00779f8dUL, 0x0077a22cUL, 0x0077ae59UL, 0x0077b6b3UL, 0x0077bac6UL, 
-0x0077c184UL, 0x0077cdf1UL, 0x0077d51bUL, 0x0077d96eUL, 0x0077e4cfUL, 0x0077e8baUL, 0x0077f050UL, 0x0077fc25UL, 
-0x00780149UL, 0x00780d3cUL, 0x007815d6UL, 0x007819a3UL, 0x00782402UL, 0x00782877UL, 0x0078309dUL, 0x00783ce8UL, 
-0x007847aaUL, 0x00784bdfUL, 0x00785335UL, 0x00785f40UL, 0x007862e1UL, 0x00786e94UL, 0x0078767eUL, 0x00787a0bUL, 
-0x007880faUL, 0x00788c8fUL, 0x00789465UL, 0x00789810UL, 0x0078a5b1UL, 0x0078a9c4UL, 0x0078b12eUL, 0x0078bd5bUL, 
-0x0078c619UL, 0x0078ca6cUL, 0x0078d286UL, 0x0078def3UL, 0x0078e352UL, 0x0078ef27UL, 0x0078f7cdUL, 0x0078fbb8UL, 
-0x0079022fUL, 0x00790e5aUL, 0x007916b0UL, 0x00791ac5UL, 0x00792764UL, 0x00792b11UL, 0x007933fbUL, 0x00793f8eUL, 
-0x007944ccUL, 0x007948b9UL, 0x00795053UL, 0x00795c26UL, 0x00796187UL, 0x00796df2UL, 0x00797518UL, 0x0079796dUL, 
-0x0079839cUL, 0x00798fe9UL, 0x00799703UL, 0x00799b76UL, 0x0079a6d7UL, 0x0079aaa2UL, 0x0079b248UL, 0x0079be3dUL, 
-0x0079c57fUL, 0x0079c90aUL, 0x0079d1e0UL, 0x0079dd95UL, 0x0079e034UL, 0x0079ec41UL, 0x0079f4abUL, 0x0079f8deUL, 
-0x007a0785UL, 0x007a0bf0UL, 0x007a131aUL, 0x007a1f6fUL, 0x007a22ceUL, 0x007a2ebbUL, 0x007a3651UL, 0x007a3a24UL, 
-0x007a4166UL, 0x007a4d13UL, 0x007a55f9UL, 0x007a598cUL, 0x007a642dUL, 0x007a6858UL, 0x007a70b2UL, 0x007a7cc7UL, 
-0x007a8636UL, 0x007a8a43UL, 0x007a92a9UL, 0x007a9edcUL, 0x007aa37dUL, 0x007aaf08UL, 0x007ab7e2UL, 0x007abb97UL, 
-0x007ac0d5UL, 0x007acca0UL, 0x007ad44aUL, 0x007ad83fUL, 0x007ae59eUL, 0x007ae9ebUL, 0x007af101UL, 0x007afd74UL, 
-0x007b04e3UL, 0x007b0896UL, 0x007b107cUL, 0x007b1c09UL, 0x007b21a8UL, 0x007b2dddUL, 0x007b3537UL, 0x007b3942UL, 
-0x007b4200UL, 0x007b4e75UL, 0x007b569fUL, 0x007b5aeaUL, 0x007b674bUL, 0x007b6b3eUL, 0x007b73d4UL, 0x007b7fa1UL, 
-0x007b8550UL, 0x007b8925UL, 0x007b91cfUL, 0x007b9dbaUL, 0x007ba01bUL, 0x007bac6eUL, 0x007bb484UL, 0x007bb8f1UL, 
-0x007bc3b3UL, 0x007bcfc6UL, 0x007bd72cUL, 0x007bdb59UL, 0x007be6f8UL, 0x007bea8dUL, 0x007bf267UL, 0x007bfe12UL, 
-0x007c00a4UL, 0x007c0cd1UL, 0x007c143bUL, 0x007c184eUL, 0x007c25efUL, 0x007c299aUL, 0x007c3170UL, 0x007c3d05UL, 
-0x007c4647UL, 0x007c4a32UL, 0x007c52d8UL, 0x007c5eadUL, 0x007c630cUL, 0x007c6f79UL, 0x007c7793UL, 0x007c7be6UL, 
-0x007c8117UL, 0x007c8d62UL, 0x007c9588UL, 0x007c99fdUL, 0x007ca45cUL, 0x007ca829UL, 0x007cb0c3UL, 0x007cbcb6UL, 
-0x007cc7f4UL, 0x007ccb81UL, 0x007cd36bUL, 0x007cdf1eUL, 0x007ce2bfUL, 0x007ceecaUL, 0x007cf620UL, 0x007cfa55UL, 
-0x007d03c2UL, 0x007d0fb7UL, 0x007d175dUL, 0x007d1b28UL, 0x007d2689UL, 0x007d2afcUL, 0x007d3216UL, 0x007d3e63UL, 
-0x007d4521UL, 0x007d4954UL, 0x007d51beUL, 0x007d5dcbUL, 0x007d606aUL, 0x007d6c1fUL, 0x007d74f5UL, 0x007d7880UL, 
-0x007d8271UL, 0x007d8e04UL, 0x007d96eeUL, 0x007d9a9bUL, 0x007da73aUL, 0x007dab4fUL, 0x007db3a5UL, 0x007dbfd0UL, 
-0x007dc492UL, 0x007dc8e7UL, 0x007dd00dUL, 0x007ddc78UL, 0x007de1d9UL, 0x007dedacUL, 0x007df546UL, 0x007df933UL, 
-0x007e0668UL, 0x007e0a1dUL, 0x007e12f7UL, 0x007e1e82UL, 0x007e2323UL, 0x007e2f56UL, 0x007e37bcUL, 0x007e3bc9UL, 
-0x007e408bUL, 0x007e4cfeUL, 0x007e5414UL, 0x007e5861UL, 0x007e65c0UL, 0x007e69b5UL, 0x007e715fUL, 0x007e7d2aUL, 
-0x007e87dbUL, 0x007e8baeUL, 0x007e9344UL, 0x007e9f31UL, 0x007ea290UL, 0x007eaee5UL, 0x007eb60fUL, 0x007eba7aUL, 
-0x007ec138UL, 0x007ecd4dUL, 0x007ed5a7UL, 0x007ed9d2UL, 0x007ee473UL, 0x007ee806UL, 0x007ef0ecUL, 0x007efc99UL, 
-0x007f050eUL, 0x007f097bUL, 0x007f1191UL, 0x007f1de4UL, 0x007f2045UL, 0x007f2c30UL, 0x007f34daUL, 0x007f38afUL, 
-0x007f43edUL, 0x007f4f98UL, 0x007f5772UL, 0x007f5b07UL, 0x007f66a6UL, 0x007f6ad3UL, 0x007f7239UL, 0x007f7e4cUL, 
-0x007f84bdUL, 0x007f88c8UL, 0x007f9022UL, 0x007f9c57UL, 0x007fa1f6UL, 0x007fad83UL, 0x007fb569UL, 0x007fb91cUL, 
-0x007fc25eUL, 0x007fce2bUL, 0x007fd6c1UL, 0x007fdab4UL, 0x007fe715UL, 0x007feb60UL, 0x007ff38aUL, 0x007fffffUL, 
+static const __code uint16_t golay23_encode[4096] = {
+0x0000, 0x0475, 0x049f, 0x00ea, 0x054b, 0x013e, 0x01d4, 0x05a1,
+0x06e3, 0x0296, 0x027c, 0x0609, 0x03a8, 0x07dd, 0x0737, 0x0342,
+0x01b3, 0x05c6, 0x052c, 0x0159, 0x04f8, 0x008d, 0x0067, 0x0412,
+0x0750, 0x0325, 0x03cf, 0x07ba, 0x021b, 0x066e, 0x0684, 0x02f1,
+0x0366, 0x0713, 0x07f9, 0x038c, 0x062d, 0x0258, 0x02b2, 0x06c7,
+0x0585, 0x01f0, 0x011a, 0x056f, 0x00ce, 0x04bb, 0x0451, 0x0024,
+0x02d5, 0x06a0, 0x064a, 0x023f, 0x079e, 0x03eb, 0x0301, 0x0774,
+0x0436, 0x0043, 0x00a9, 0x04dc, 0x017d, 0x0508, 0x05e2, 0x0197,
+0x06cc, 0x02b9, 0x0253, 0x0626, 0x0387, 0x07f2, 0x0718, 0x036d,
+0x002f, 0x045a, 0x04b0, 0x00c5, 0x0564, 0x0111, 0x01fb, 0x058e,
+0x077f, 0x030a, 0x03e0, 0x0795, 0x0234, 0x0641, 0x06ab, 0x02de,
+0x019c, 0x05e9, 0x0503, 0x0176, 0x04d7, 0x00a2, 0x0048, 0x043d,
+0x05aa, 0x01df, 0x0135, 0x0540, 0x00e1, 0x0494, 0x047e, 0x000b,
+0x0349, 0x073c, 0x07d6, 0x03a3, 0x0602, 0x0277, 0x029d, 0x06e8,
+0x0419, 0x006c, 0x0086, 0x04f3, 0x0152, 0x0527, 0x05cd, 0x01b8,
+0x02fa, 0x068f, 0x0665, 0x0210, 0x07b1, 0x03c4, 0x032e, 0x075b,
+0x01ed, 0x0598, 0x0572, 0x0107, 0x04a6, 0x00d3, 0x0039, 0x044c,
+0x070e, 0x037b, 0x0391, 0x07e4, 0x0245, 0x0630, 0x06da, 0x02af,
+0x005e, 0x042b, 0x04c1, 0x00b4, 0x0515, 0x0160, 0x018a, 0x05ff,
+0x06bd, 0x02c8, 0x0222, 0x0657, 0x03f6, 0x0783, 0x0769, 0x031c,
+0x028b, 0x06fe, 0x0614, 0x0261, 0x07c0, 0x03b5, 0x035f, 0x072a,
+0x0468, 0x001d, 0x00f7, 0x0482, 0x0123, 0x0556, 0x05bc, 0x01c9,
+0x0338, 0x074d, 0x07a7, 0x03d2, 0x0673, 0x0206, 0x02ec, 0x0699,
+0x05db, 0x01ae, 0x0144, 0x0531, 0x0090, 0x04e5, 0x040f, 0x007a,
+0x0721, 0x0354, 0x03be, 0x07cb, 0x026a, 0x061f, 0x06f5, 0x0280,
+0x01c2, 0x05b7, 0x055d, 0x0128, 0x0489, 0x00fc, 0x0016, 0x0463,
+0x0692, 0x02e7, 0x020d, 0x0678, 0x03d9, 0x07ac, 0x0746, 0x0333,
+0x0071, 0x0404, 0x04ee, 0x009b, 0x053a, 0x014f, 0x01a5, 0x05d0,
+0x0447, 0x0032, 0x00d8, 0x04ad, 0x010c, 0x0579, 0x0593, 0x01e6,
+0x02a4, 0x06d1, 0x063b, 0x024e, 0x07ef, 0x039a, 0x0370, 0x0705,
+0x05f4, 0x0181, 0x016b, 0x051e, 0x00bf, 0x04ca, 0x0420, 0x0055,
+0x0317, 0x0762, 0x0788, 0x03fd, 0x065c, 0x0229, 0x02c3, 0x06b6,
+0x03da, 0x07af, 0x0745, 0x0330, 0x0691, 0x02e4, 0x020e, 0x067b,
+0x0539, 0x014c, 0x01a6, 0x05d3, 0x0072, 0x0407, 0x04ed, 0x0098,
+0x0269, 0x061c, 0x06f6, 0x0283, 0x0722, 0x0357, 0x03bd, 0x07c8,
+0x048a, 0x00ff, 0x0015, 0x0460, 0x01c1, 0x05b4, 0x055e, 0x012b,
+0x00bc, 0x04c9, 0x0423, 0x0056, 0x05f7, 0x0182, 0x0168, 0x051d,
+0x065f, 0x022a, 0x02c0, 0x06b5, 0x0314, 0x0761, 0x078b, 0x03fe,
+0x010f, 0x057a, 0x0590, 0x01e5, 0x0444, 0x0031, 0x00db, 0x04ae,
+0x07ec, 0x0399, 0x0373, 0x0706, 0x02a7, 0x06d2, 0x0638, 0x024d,
+0x0516, 0x0163, 0x0189, 0x05fc, 0x005d, 0x0428, 0x04c2, 0x00b7,
+0x03f5, 0x0780, 0x076a, 0x031f, 0x06be, 0x02cb, 0x0221, 0x0654,
+0x04a5, 0x00d0, 0x003a, 0x044f, 0x01ee, 0x059b, 0x0571, 0x0104,
+0x0246, 0x0633, 0x06d9, 0x02ac, 0x070d, 0x0378, 0x0392, 0x07e7,
+0x0670, 0x0205, 0x02ef, 0x069a, 0x033b, 0x074e, 0x07a4, 0x03d1,
+0x0093, 0x04e6, 0x040c, 0x0079, 0x05d8, 0x01ad, 0x0147, 0x0532,
+0x07c3, 0x03b6, 0x035c, 0x0729, 0x0288, 0x06fd, 0x0617, 0x0262,
+0x0120, 0x0555, 0x05bf, 0x01ca, 0x046b, 0x001e, 0x00f4, 0x0481,
+0x0237, 0x0642, 0x06a8, 0x02dd, 0x077c, 0x0309, 0x03e3, 0x0796,
+0x04d4, 0x00a1, 0x004b, 0x043e, 0x019f, 0x05ea, 0x0500, 0x0175,
+0x0384, 0x07f1, 0x071b, 0x036e, 0x06cf, 0x02ba, 0x0250, 0x0625,
+0x0567, 0x0112, 0x01f8, 0x058d, 0x002c, 0x0459, 0x04b3, 0x00c6,
+0x0151, 0x0524, 0x05ce, 0x01bb, 0x041a, 0x006f, 0x0085, 0x04f0,
+0x07b2, 0x03c7, 0x032d, 0x0758, 0x02f9, 0x068c, 0x0666, 0x0213,
+0x00e2, 0x0497, 0x047d, 0x0008, 0x05a9, 0x01dc, 0x0136, 0x0543,
+0x0601, 0x0274, 0x029e, 0x06eb, 0x034a, 0x073f, 0x07d5, 0x03a0,
+0x04fb, 0x008e, 0x0064, 0x0411, 0x01b0, 0x05c5, 0x052f, 0x015a,
+0x0218, 0x066d, 0x0687, 0x02f2, 0x0753, 0x0326, 0x03cc, 0x07b9,
+0x0548, 0x013d, 0x01d7, 0x05a2, 0x0003, 0x0476, 0x049c, 0x00e9,
+0x03ab, 0x07de, 0x0734, 0x0341, 0x06e0, 0x0295, 0x027f, 0x060a,
+0x079d, 0x03e8, 0x0302, 0x0777, 0x02d6, 0x06a3, 0x0649, 0x023c,
+0x017e, 0x050b, 0x05e1, 0x0194, 0x0435, 0x0040, 0x00aa, 0x04df,
+0x062e, 0x025b, 0x02b1, 0x06c4, 0x0365, 0x0710, 0x07fa, 0x038f,
+0x00cd, 0x04b8, 0x0452, 0x0027, 0x0586, 0x01f3, 0x0119, 0x056c,
+0x07b4, 0x03c1, 0x032b, 0x075e, 0x02ff, 0x068a, 0x0660, 0x0215,
+0x0157, 0x0522, 0x05c8, 0x01bd, 0x041c, 0x0069, 0x0083, 0x04f6,
+0x0607, 0x0272, 0x0298, 0x06ed, 0x034c, 0x0739, 0x07d3, 0x03a6,
+0x00e4, 0x0491, 0x047b, 0x000e, 0x05af, 0x01da, 0x0130, 0x0545,
+0x04d2, 0x00a7, 0x004d, 0x0438, 0x0199, 0x05ec, 0x0506, 0x0173,
+0x0231, 0x0644, 0x06ae, 0x02db, 0x077a, 0x030f, 0x03e5, 0x0790,
+0x0561, 0x0114, 0x01fe, 0x058b, 0x002a, 0x045f, 0x04b5, 0x00c0,
+0x0382, 0x07f7, 0x071d, 0x0368, 0x06c9, 0x02bc, 0x0256, 0x0623,
+0x0178, 0x050d, 0x05e7, 0x0192, 0x0433, 0x0046, 0x00ac, 0x04d9,
+0x079b, 0x03ee, 0x0304, 0x0771, 0x02d0, 0x06a5, 0x064f, 0x023a,
+0x00cb, 0x04be, 0x0454, 0x0021, 0x0580, 0x01f5, 0x011f, 0x056a,
+0x0628, 0x025d, 0x02b7, 0x06c2, 0x0363, 0x0716, 0x07fc, 0x0389,
+0x021e, 0x066b, 0x0681, 0x02f4, 0x0755, 0x0320, 0x03ca, 0x07bf,
+0x04fd, 0x0088, 0x0062, 0x0417, 0x01b6, 0x05c3, 0x0529, 0x015c,
+0x03ad, 0x07d8, 0x0732, 0x0347, 0x06e6, 0x0293, 0x0279, 0x060c,
+0x054e, 0x013b, 0x01d1, 0x05a4, 0x0005, 0x0470, 0x049a, 0x00ef,
+0x0659, 0x022c, 0x02c6, 0x06b3, 0x0312, 0x0767, 0x078d, 0x03f8,
+0x00ba, 0x04cf, 0x0425, 0x0050, 0x05f1, 0x0184, 0x016e, 0x051b,
+0x07ea, 0x039f, 0x0375, 0x0700, 0x02a1, 0x06d4, 0x063e, 0x024b,
+0x0109, 0x057c, 0x0596, 0x01e3, 0x0442, 0x0037, 0x00dd, 0x04a8,
+0x053f, 0x014a, 0x01a0, 0x05d5, 0x0074, 0x0401, 0x04eb, 0x009e,
+0x03dc, 0x07a9, 0x0743, 0x0336, 0x0697, 0x02e2, 0x0208, 0x067d,
+0x048c, 0x00f9, 0x0013, 0x0466, 0x01c7, 0x05b2, 0x0558, 0x012d,
+0x026f, 0x061a, 0x06f0, 0x0285, 0x0724, 0x0351, 0x03bb, 0x07ce,
+0x0095, 0x04e0, 0x040a, 0x007f, 0x05de, 0x01ab, 0x0141, 0x0534,
+0x0676, 0x0203, 0x02e9, 0x069c, 0x033d, 0x0748, 0x07a2, 0x03d7,
+0x0126, 0x0553, 0x05b9, 0x01cc, 0x046d, 0x0018, 0x00f2, 0x0487,
+0x07c5, 0x03b0, 0x035a, 0x072f, 0x028e, 0x06fb, 0x0611, 0x0264,
+0x03f3, 0x0786, 0x076c, 0x0319, 0x06b8, 0x02cd, 0x0227, 0x0652,
+0x0510, 0x0165, 0x018f, 0x05fa, 0x005b, 0x042e, 0x04c4, 0x00b1,
+0x0240, 0x0635, 0x06df, 0x02aa, 0x070b, 0x037e, 0x0394, 0x07e1,
+0x04a3, 0x00d6, 0x003c, 0x0449, 0x01e8, 0x059d, 0x0577, 0x0102,
+0x046e, 0x001b, 0x00f1, 0x0484, 0x0125, 0x0550, 0x05ba, 0x01cf,
+0x028d, 0x06f8, 0x0612, 0x0267, 0x07c6, 0x03b3, 0x0359, 0x072c,
+0x05dd, 0x01a8, 0x0142, 0x0537, 0x0096, 0x04e3, 0x0409, 0x007c,
+0x033e, 0x074b, 0x07a1, 0x03d4, 0x0675, 0x0200, 0x02ea, 0x069f,
+0x0708, 0x037d, 0x0397, 0x07e2, 0x0243, 0x0636, 0x06dc, 0x02a9,
+0x01eb, 0x059e, 0x0574, 0x0101, 0x04a0, 0x00d5, 0x003f, 0x044a,
+0x06bb, 0x02ce, 0x0224, 0x0651, 0x03f0, 0x0785, 0x076f, 0x031a,
+0x0058, 0x042d, 0x04c7, 0x00b2, 0x0513, 0x0166, 0x018c, 0x05f9,
+0x02a2, 0x06d7, 0x063d, 0x0248, 0x07e9, 0x039c, 0x0376, 0x0703,
+0x0441, 0x0034, 0x00de, 0x04ab, 0x010a, 0x057f, 0x0595, 0x01e0,
+0x0311, 0x0764, 0x078e, 0x03fb, 0x065a, 0x022f, 0x02c5, 0x06b0,
+0x05f2, 0x0187, 0x016d, 0x0518, 0x00b9, 0x04cc, 0x0426, 0x0053,
+0x01c4, 0x05b1, 0x055b, 0x012e, 0x048f, 0x00fa, 0x0010, 0x0465,
+0x0727, 0x0352, 0x03b8, 0x07cd, 0x026c, 0x0619, 0x06f3, 0x0286,
+0x0077, 0x0402, 0x04e8, 0x009d, 0x053c, 0x0149, 0x01a3, 0x05d6,
+0x0694, 0x02e1, 0x020b, 0x067e, 0x03df, 0x07aa, 0x0740, 0x0335,
+0x0583, 0x01f6, 0x011c, 0x0569, 0x00c8, 0x04bd, 0x0457, 0x0022,
+0x0360, 0x0715, 0x07ff, 0x038a, 0x062b, 0x025e, 0x02b4, 0x06c1,
+0x0430, 0x0045, 0x00af, 0x04da, 0x017b, 0x050e, 0x05e4, 0x0191,
+0x02d3, 0x06a6, 0x064c, 0x0239, 0x0798, 0x03ed, 0x0307, 0x0772,
+0x06e5, 0x0290, 0x027a, 0x060f, 0x03ae, 0x07db, 0x0731, 0x0344,
+0x0006, 0x0473, 0x0499, 0x00ec, 0x054d, 0x0138, 0x01d2, 0x05a7,
+0x0756, 0x0323, 0x03c9, 0x07bc, 0x021d, 0x0668, 0x0682, 0x02f7,
+0x01b5, 0x05c0, 0x052a, 0x015f, 0x04fe, 0x008b, 0x0061, 0x0414,
+0x034f, 0x073a, 0x07d0, 0x03a5, 0x0604, 0x0271, 0x029b, 0x06ee,
+0x05ac, 0x01d9, 0x0133, 0x0546, 0x00e7, 0x0492, 0x0478, 0x000d,
+0x02fc, 0x0689, 0x0663, 0x0216, 0x07b7, 0x03c2, 0x0328, 0x075d,
+0x041f, 0x006a, 0x0080, 0x04f5, 0x0154, 0x0521, 0x05cb, 0x01be,
+0x0029, 0x045c, 0x04b6, 0x00c3, 0x0562, 0x0117, 0x01fd, 0x0588,
+0x06ca, 0x02bf, 0x0255, 0x0620, 0x0381, 0x07f4, 0x071e, 0x036b,
+0x019a, 0x05ef, 0x0505, 0x0170, 0x04d1, 0x00a4, 0x004e, 0x043b,
+0x0779, 0x030c, 0x03e6, 0x0793, 0x0232, 0x0647, 0x06ad, 0x02d8,
+0x031d, 0x0768, 0x0782, 0x03f7, 0x0656, 0x0223, 0x02c9, 0x06bc,
+0x05fe, 0x018b, 0x0161, 0x0514, 0x00b5, 0x04c0, 0x042a, 0x005f,
+0x02ae, 0x06db, 0x0631, 0x0244, 0x07e5, 0x0390, 0x037a, 0x070f,
+0x044d, 0x0038, 0x00d2, 0x04a7, 0x0106, 0x0573, 0x0599, 0x01ec,
+0x007b, 0x040e, 0x04e4, 0x0091, 0x0530, 0x0145, 0x01af, 0x05da,
+0x0698, 0x02ed, 0x0207, 0x0672, 0x03d3, 0x07a6, 0x074c, 0x0339,
+0x01c8, 0x05bd, 0x0557, 0x0122, 0x0483, 0x00f6, 0x001c, 0x0469,
+0x072b, 0x035e, 0x03b4, 0x07c1, 0x0260, 0x0615, 0x06ff, 0x028a,
+0x05d1, 0x01a4, 0x014e, 0x053b, 0x009a, 0x04ef, 0x0405, 0x0070,
+0x0332, 0x0747, 0x07ad, 0x03d8, 0x0679, 0x020c, 0x02e6, 0x0693,
+0x0462, 0x0017, 0x00fd, 0x0488, 0x0129, 0x055c, 0x05b6, 0x01c3,
+0x0281, 0x06f4, 0x061e, 0x026b, 0x07ca, 0x03bf, 0x0355, 0x0720,
+0x06b7, 0x02c2, 0x0228, 0x065d, 0x03fc, 0x0789, 0x0763, 0x0316,
+0x0054, 0x0421, 0x04cb, 0x00be, 0x051f, 0x016a, 0x0180, 0x05f5,
+0x0704, 0x0371, 0x039b, 0x07ee, 0x024f, 0x063a, 0x06d0, 0x02a5,
+0x01e7, 0x0592, 0x0578, 0x010d, 0x04ac, 0x00d9, 0x0033, 0x0446,
+0x02f0, 0x0685, 0x066f, 0x021a, 0x07bb, 0x03ce, 0x0324, 0x0751,
+0x0413, 0x0066, 0x008c, 0x04f9, 0x0158, 0x052d, 0x05c7, 0x01b2,
+0x0343, 0x0736, 0x07dc, 0x03a9, 0x0608, 0x027d, 0x0297, 0x06e2,
+0x05a0, 0x01d5, 0x013f, 0x054a, 0x00eb, 0x049e, 0x0474, 0x0001,
+0x0196, 0x05e3, 0x0509, 0x017c, 0x04dd, 0x00a8, 0x0042, 0x0437,
+0x0775, 0x0300, 0x03ea, 0x079f, 0x023e, 0x064b, 0x06a1, 0x02d4,
+0x0025, 0x0450, 0x04ba, 0x00cf, 0x056e, 0x011b, 0x01f1, 0x0584,
+0x06c6, 0x02b3, 0x0259, 0x062c, 0x038d, 0x07f8, 0x0712, 0x0367,
+0x043c, 0x0049, 0x00a3, 0x04d6, 0x0177, 0x0502, 0x05e8, 0x019d,
+0x02df, 0x06aa, 0x0640, 0x0235, 0x0794, 0x03e1, 0x030b, 0x077e,
+0x058f, 0x01fa, 0x0110, 0x0565, 0x00c4, 0x04b1, 0x045b, 0x002e,
+0x036c, 0x0719, 0x07f3, 0x0386, 0x0627, 0x0252, 0x02b8, 0x06cd,
+0x075a, 0x032f, 0x03c5, 0x07b0, 0x0211, 0x0664, 0x068e, 0x02fb,
+0x01b9, 0x05cc, 0x0526, 0x0153, 0x04f2, 0x0087, 0x006d, 0x0418,
+0x06e9, 0x029c, 0x0276, 0x0603, 0x03a2, 0x07d7, 0x073d, 0x0348,
+0x000a, 0x047f, 0x0495, 0x00e0, 0x0541, 0x0134, 0x01de, 0x05ab,
+0x00c7, 0x04b2, 0x0458, 0x002d, 0x058c, 0x01f9, 0x0113, 0x0566,
+0x0624, 0x0251, 0x02bb, 0x06ce, 0x036f, 0x071a, 0x07f0, 0x0385,
+0x0174, 0x0501, 0x05eb, 0x019e, 0x043f, 0x004a, 0x00a0, 0x04d5,
+0x0797, 0x03e2, 0x0308, 0x077d, 0x02dc, 0x06a9, 0x0643, 0x0236,
+0x03a1, 0x07d4, 0x073e, 0x034b, 0x06ea, 0x029f, 0x0275, 0x0600,
+0x0542, 0x0137, 0x01dd, 0x05a8, 0x0009, 0x047c, 0x0496, 0x00e3,
+0x0212, 0x0667, 0x068d, 0x02f8, 0x0759, 0x032c, 0x03c6, 0x07b3,
+0x04f1, 0x0084, 0x006e, 0x041b, 0x01ba, 0x05cf, 0x0525, 0x0150,
+0x060b, 0x027e, 0x0294, 0x06e1, 0x0340, 0x0735, 0x07df, 0x03aa,
+0x00e8, 0x049d, 0x0477, 0x0002, 0x05a3, 0x01d6, 0x013c, 0x0549,
+0x07b8, 0x03cd, 0x0327, 0x0752, 0x02f3, 0x0686, 0x066c, 0x0219,
+0x015b, 0x052e, 0x05c4, 0x01b1, 0x0410, 0x0065, 0x008f, 0x04fa,
+0x056d, 0x0118, 0x01f2, 0x0587, 0x0026, 0x0453, 0x04b9, 0x00cc,
+0x038e, 0x07fb, 0x0711, 0x0364, 0x06c5, 0x02b0, 0x025a, 0x062f,
+0x04de, 0x00ab, 0x0041, 0x0434, 0x0195, 0x05e0, 0x050a, 0x017f,
+0x023d, 0x0648, 0x06a2, 0x02d7, 0x0776, 0x0303, 0x03e9, 0x079c,
+0x012a, 0x055f, 0x05b5, 0x01c0, 0x0461, 0x0014, 0x00fe, 0x048b,
+0x07c9, 0x03bc, 0x0356, 0x0723, 0x0282, 0x06f7, 0x061d, 0x0268,
+0x0099, 0x04ec, 0x0406, 0x0073, 0x05d2, 0x01a7, 0x014d, 0x0538,
+0x067a, 0x020f, 0x02e5, 0x0690, 0x0331, 0x0744, 0x07ae, 0x03db,
+0x024c, 0x0639, 0x06d3, 0x02a6, 0x0707, 0x0372, 0x0398, 0x07ed,
+0x04af, 0x00da, 0x0030, 0x0445, 0x01e4, 0x0591, 0x057b, 0x010e,
+0x03ff, 0x078a, 0x0760, 0x0315, 0x06b4, 0x02c1, 0x022b, 0x065e,
+0x051c, 0x0169, 0x0183, 0x05f6, 0x0057, 0x0422, 0x04c8, 0x00bd,
+0x07e6, 0x0393, 0x0379, 0x070c, 0x02ad, 0x06d8, 0x0632, 0x0247,
+0x0105, 0x0570, 0x059a, 0x01ef, 0x044e, 0x003b, 0x00d1, 0x04a4,
+0x0655, 0x0220, 0x02ca, 0x06bf, 0x031e, 0x076b, 0x0781, 0x03f4,
+0x00b6, 0x04c3, 0x0429, 0x005c, 0x05fd, 0x0188, 0x0162, 0x0517,
+0x0480, 0x00f5, 0x001f, 0x046a, 0x01cb, 0x05be, 0x0554, 0x0121,
+0x0263, 0x0616, 0x06fc, 0x0289, 0x0728, 0x035d, 0x03b7, 0x07c2,
+0x0533, 0x0146, 0x01ac, 0x05d9, 0x0078, 0x040d, 0x04e7, 0x0092,
+0x03d0, 0x07a5, 0x074f, 0x033a, 0x069b, 0x02ee, 0x0204, 0x0671,
+0x04a9, 0x00dc, 0x0036, 0x0443, 0x01e2, 0x0597, 0x057d, 0x0108,
+0x024a, 0x063f, 0x06d5, 0x02a0, 0x0701, 0x0374, 0x039e, 0x07eb,
+0x051a, 0x016f, 0x0185, 0x05f0, 0x0051, 0x0424, 0x04ce, 0x00bb,
+0x03f9, 0x078c, 0x0766, 0x0313, 0x06b2, 0x02c7, 0x022d, 0x0658,
+0x07cf, 0x03ba, 0x0350, 0x0725, 0x0284, 0x06f1, 0x061b, 0x026e,
+0x012c, 0x0559, 0x05b3, 0x01c6, 0x0467, 0x0012, 0x00f8, 0x048d,
+0x067c, 0x0209, 0x02e3, 0x0696, 0x0337, 0x0742, 0x07a8, 0x03dd,
+0x009f, 0x04ea, 0x0400, 0x0075, 0x05d4, 0x01a1, 0x014b, 0x053e,
+0x0265, 0x0610, 0x06fa, 0x028f, 0x072e, 0x035b, 0x03b1, 0x07c4,
+0x0486, 0x00f3, 0x0019, 0x046c, 0x01cd, 0x05b8, 0x0552, 0x0127,
+0x03d6, 0x07a3, 0x0749, 0x033c, 0x069d, 0x02e8, 0x0202, 0x0677,
+0x0535, 0x0140, 0x01aa, 0x05df, 0x007e, 0x040b, 0x04e1, 0x0094,
+0x0103, 0x0576, 0x059c, 0x01e9, 0x0448, 0x003d, 0x00d7, 0x04a2,
+0x07e0, 0x0395, 0x037f, 0x070a, 0x02ab, 0x06de, 0x0634, 0x0241,
+0x00b0, 0x04c5, 0x042f, 0x005a, 0x05fb, 0x018e, 0x0164, 0x0511,
+0x0653, 0x0226, 0x02cc, 0x06b9, 0x0318, 0x076d, 0x0787, 0x03f2,
+0x0544, 0x0131, 0x01db, 0x05ae, 0x000f, 0x047a, 0x0490, 0x00e5,
+0x03a7, 0x07d2, 0x0738, 0x034d, 0x06ec, 0x0299, 0x0273, 0x0606,
+0x04f7, 0x0082, 0x0068, 0x041d, 0x01bc, 0x05c9, 0x0523, 0x0156,
+0x0214, 0x0661, 0x068b, 0x02fe, 0x075f, 0x032a, 0x03c0, 0x07b5,
+0x0622, 0x0257, 0x02bd, 0x06c8, 0x0369, 0x071c, 0x07f6, 0x0383,
+0x00c1, 0x04b4, 0x045e, 0x002b, 0x058a, 0x01ff, 0x0115, 0x0560,
+0x0791, 0x03e4, 0x030e, 0x077b, 0x02da, 0x06af, 0x0645, 0x0230,
+0x0172, 0x0507, 0x05ed, 0x0198, 0x0439, 0x004c, 0x00a6, 0x04d3,
+0x0388, 0x07fd, 0x0717, 0x0362, 0x06c3, 0x02b6, 0x025c, 0x0629,
+0x056b, 0x011e, 0x01f4, 0x0581, 0x0020, 0x0455, 0x04bf, 0x00ca,
+0x023b, 0x064e, 0x06a4, 0x02d1, 0x0770, 0x0305, 0x03ef, 0x079a,
+0x04d8, 0x00ad, 0x0047, 0x0432, 0x0193, 0x05e6, 0x050c, 0x0179,
+0x00ee, 0x049b, 0x0471, 0x0004, 0x05a5, 0x01d0, 0x013a, 0x054f,
+0x060d, 0x0278, 0x0292, 0x06e7, 0x0346, 0x0733, 0x07d9, 0x03ac,
+0x015d, 0x0528, 0x05c2, 0x01b7, 0x0416, 0x0063, 0x0089, 0x04fc,
+0x07be, 0x03cb, 0x0321, 0x0754, 0x02f5, 0x0680, 0x066a, 0x021f,
+0x0773, 0x0306, 0x03ec, 0x0799, 0x0238, 0x064d, 0x06a7, 0x02d2,
+0x0190, 0x05e5, 0x050f, 0x017a, 0x04db, 0x00ae, 0x0044, 0x0431,
+0x06c0, 0x02b5, 0x025f, 0x062a, 0x038b, 0x07fe, 0x0714, 0x0361,
+0x0023, 0x0456, 0x04bc, 0x00c9, 0x0568, 0x011d, 0x01f7, 0x0582,
+0x0415, 0x0060, 0x008a, 0x04ff, 0x015e, 0x052b, 0x05c1, 0x01b4,
+0x02f6, 0x0683, 0x0669, 0x021c, 0x07bd, 0x03c8, 0x0322, 0x0757,
+0x05a6, 0x01d3, 0x0139, 0x054c, 0x00ed, 0x0498, 0x0472, 0x0007,
+0x0345, 0x0730, 0x07da, 0x03af, 0x060e, 0x027b, 0x0291, 0x06e4,
+0x01bf, 0x05ca, 0x0520, 0x0155, 0x04f4, 0x0081, 0x006b, 0x041e,
+0x075c, 0x0329, 0x03c3, 0x07b6, 0x0217, 0x0662, 0x0688, 0x02fd,
+0x000c, 0x0479, 0x0493, 0x00e6, 0x0547, 0x0132, 0x01d8, 0x05ad,
+0x06ef, 0x029a, 0x0270, 0x0605, 0x03a4, 0x07d1, 0x073b, 0x034e,
+0x02d9, 0x06ac, 0x0646, 0x0233, 0x0792, 0x03e7, 0x030d, 0x0778,
+0x043a, 0x004f, 0x00a5, 0x04d0, 0x0171, 0x0504, 0x05ee, 0x019b,
+0x036a, 0x071f, 0x07f5, 0x0380, 0x0621, 0x0254, 0x02be, 0x06cb,
+0x0589, 0x01fc, 0x0116, 0x0563, 0x00c2, 0x04b7, 0x045d, 0x0028,
+0x069e, 0x02eb, 0x0201, 0x0674, 0x03d5, 0x07a0, 0x074a, 0x033f,
+0x007d, 0x0408, 0x04e2, 0x0097, 0x0536, 0x0143, 0x01a9, 0x05dc,
+0x072d, 0x0358, 0x03b2, 0x07c7, 0x0266, 0x0613, 0x06f9, 0x028c,
+0x01ce, 0x05bb, 0x0551, 0x0124, 0x0485, 0x00f0, 0x001a, 0x046f,
+0x05f8, 0x018d, 0x0167, 0x0512, 0x00b3, 0x04c6, 0x042c, 0x0059,
+0x031b, 0x076e, 0x0784, 0x03f1, 0x0650, 0x0225, 0x02cf, 0x06ba,
+0x044b, 0x003e, 0x00d4, 0x04a1, 0x0100, 0x0575, 0x059f, 0x01ea,
+0x02a8, 0x06dd, 0x0637, 0x0242, 0x07e3, 0x0396, 0x037c, 0x0709,
+0x0052, 0x0427, 0x04cd, 0x00b8, 0x0519, 0x016c, 0x0186, 0x05f3,
+0x06b1, 0x02c4, 0x022e, 0x065b, 0x03fa, 0x078f, 0x0765, 0x0310,
+0x01e1, 0x0594, 0x057e, 0x010b, 0x04aa, 0x00df, 0x0035, 0x0440,
+0x0702, 0x0377, 0x039d, 0x07e8, 0x0249, 0x063c, 0x06d6, 0x02a3,
+0x0334, 0x0741, 0x07ab, 0x03de, 0x067f, 0x020a, 0x02e0, 0x0695,
+0x05d7, 0x01a2, 0x0148, 0x053d, 0x009c, 0x04e9, 0x0403, 0x0076,
+0x0287, 0x06f2, 0x0618, 0x026d, 0x07cc, 0x03b9, 0x0353, 0x0726,
+0x0464, 0x0011, 0x00fb, 0x048e, 0x012f, 0x055a, 0x05b0, 0x01c5,
+0x063a, 0x024f, 0x02a5, 0x06d0, 0x0371, 0x0704, 0x07ee, 0x039b,
+0x00d9, 0x04ac, 0x0446, 0x0033, 0x0592, 0x01e7, 0x010d, 0x0578,
+0x0789, 0x03fc, 0x0316, 0x0763, 0x02c2, 0x06b7, 0x065d, 0x0228,
+0x016a, 0x051f, 0x05f5, 0x0180, 0x0421, 0x0054, 0x00be, 0x04cb,
+0x055c, 0x0129, 0x01c3, 0x05b6, 0x0017, 0x0462, 0x0488, 0x00fd,
+0x03bf, 0x07ca, 0x0720, 0x0355, 0x06f4, 0x0281, 0x026b, 0x061e,
+0x04ef, 0x009a, 0x0070, 0x0405, 0x01a4, 0x05d1, 0x053b, 0x014e,
+0x020c, 0x0679, 0x0693, 0x02e6, 0x0747, 0x0332, 0x03d8, 0x07ad,
+0x00f6, 0x0483, 0x0469, 0x001c, 0x05bd, 0x01c8, 0x0122, 0x0557,
+0x0615, 0x0260, 0x028a, 0x06ff, 0x035e, 0x072b, 0x07c1, 0x03b4,
+0x0145, 0x0530, 0x05da, 0x01af, 0x040e, 0x007b, 0x0091, 0x04e4,
+0x07a6, 0x03d3, 0x0339, 0x074c, 0x02ed, 0x0698, 0x0672, 0x0207,
+0x0390, 0x07e5, 0x070f, 0x037a, 0x06db, 0x02ae, 0x0244, 0x0631,
+0x0573, 0x0106, 0x01ec, 0x0599, 0x0038, 0x044d, 0x04a7, 0x00d2,
+0x0223, 0x0656, 0x06bc, 0x02c9, 0x0768, 0x031d, 0x03f7, 0x0782,
+0x04c0, 0x00b5, 0x005f, 0x042a, 0x018b, 0x05fe, 0x0514, 0x0161,
+0x07d7, 0x03a2, 0x0348, 0x073d, 0x029c, 0x06e9, 0x0603, 0x0276,
+0x0134, 0x0541, 0x05ab, 0x01de, 0x047f, 0x000a, 0x00e0, 0x0495,
+0x0664, 0x0211, 0x02fb, 0x068e, 0x032f, 0x075a, 0x07b0, 0x03c5,
+0x0087, 0x04f2, 0x0418, 0x006d, 0x05cc, 0x01b9, 0x0153, 0x0526,
+0x04b1, 0x00c4, 0x002e, 0x045b, 0x01fa, 0x058f, 0x0565, 0x0110,
+0x0252, 0x0627, 0x06cd, 0x02b8, 0x0719, 0x036c, 0x0386, 0x07f3,
+0x0502, 0x0177, 0x019d, 0x05e8, 0x0049, 0x043c, 0x04d6, 0x00a3,
+0x03e1, 0x0794, 0x077e, 0x030b, 0x06aa, 0x02df, 0x0235, 0x0640,
+0x011b, 0x056e, 0x0584, 0x01f1, 0x0450, 0x0025, 0x00cf, 0x04ba,
+0x07f8, 0x038d, 0x0367, 0x0712, 0x02b3, 0x06c6, 0x062c, 0x0259,
+0x00a8, 0x04dd, 0x0437, 0x0042, 0x05e3, 0x0196, 0x017c, 0x0509,
+0x064b, 0x023e, 0x02d4, 0x06a1, 0x0300, 0x0775, 0x079f, 0x03ea,
+0x027d, 0x0608, 0x06e2, 0x0297, 0x0736, 0x0343, 0x03a9, 0x07dc,
+0x049e, 0x00eb, 0x0001, 0x0474, 0x01d5, 0x05a0, 0x054a, 0x013f,
+0x03ce, 0x07bb, 0x0751, 0x0324, 0x0685, 0x02f0, 0x021a, 0x066f,
+0x052d, 0x0158, 0x01b2, 0x05c7, 0x0066, 0x0413, 0x04f9, 0x008c,
+0x05e0, 0x0195, 0x017f, 0x050a, 0x00ab, 0x04de, 0x0434, 0x0041,
+0x0303, 0x0776, 0x079c, 0x03e9, 0x0648, 0x023d, 0x02d7, 0x06a2,
+0x0453, 0x0026, 0x00cc, 0x04b9, 0x0118, 0x056d, 0x0587, 0x01f2,
+0x02b0, 0x06c5, 0x062f, 0x025a, 0x07fb, 0x038e, 0x0364, 0x0711,
+0x0686, 0x02f3, 0x0219, 0x066c, 0x03cd, 0x07b8, 0x0752, 0x0327,
+0x0065, 0x0410, 0x04fa, 0x008f, 0x052e, 0x015b, 0x01b1, 0x05c4,
+0x0735, 0x0340, 0x03aa, 0x07df, 0x027e, 0x060b, 0x06e1, 0x0294,
+0x01d6, 0x05a3, 0x0549, 0x013c, 0x049d, 0x00e8, 0x0002, 0x0477,
+0x032c, 0x0759, 0x07b3, 0x03c6, 0x0667, 0x0212, 0x02f8, 0x068d,
+0x05cf, 0x01ba, 0x0150, 0x0525, 0x0084, 0x04f1, 0x041b, 0x006e,
+0x029f, 0x06ea, 0x0600, 0x0275, 0x07d4, 0x03a1, 0x034b, 0x073e,
+0x047c, 0x0009, 0x00e3, 0x0496, 0x0137, 0x0542, 0x05a8, 0x01dd,
+0x004a, 0x043f, 0x04d5, 0x00a0, 0x0501, 0x0174, 0x019e, 0x05eb,
+0x06a9, 0x02dc, 0x0236, 0x0643, 0x03e2, 0x0797, 0x077d, 0x0308,
+0x01f9, 0x058c, 0x0566, 0x0113, 0x04b2, 0x00c7, 0x002d, 0x0458,
+0x071a, 0x036f, 0x0385, 0x07f0, 0x0251, 0x0624, 0x06ce, 0x02bb,
+0x040d, 0x0078, 0x0092, 0x04e7, 0x0146, 0x0533, 0x05d9, 0x01ac,
+0x02ee, 0x069b, 0x0671, 0x0204, 0x07a5, 0x03d0, 0x033a, 0x074f,
+0x05be, 0x01cb, 0x0121, 0x0554, 0x00f5, 0x0480, 0x046a, 0x001f,
+0x035d, 0x0728, 0x07c2, 0x03b7, 0x0616, 0x0263, 0x0289, 0x06fc,
+0x076b, 0x031e, 0x03f4, 0x0781, 0x0220, 0x0655, 0x06bf, 0x02ca,
+0x0188, 0x05fd, 0x0517, 0x0162, 0x04c3, 0x00b6, 0x005c, 0x0429,
+0x06d8, 0x02ad, 0x0247, 0x0632, 0x0393, 0x07e6, 0x070c, 0x0379,
+0x003b, 0x044e, 0x04a4, 0x00d1, 0x0570, 0x0105, 0x01ef, 0x059a,
+0x02c1, 0x06b4, 0x065e, 0x022b, 0x078a, 0x03ff, 0x0315, 0x0760,
+0x0422, 0x0057, 0x00bd, 0x04c8, 0x0169, 0x051c, 0x05f6, 0x0183,
+0x0372, 0x0707, 0x07ed, 0x0398, 0x0639, 0x024c, 0x02a6, 0x06d3,
+0x0591, 0x01e4, 0x010e, 0x057b, 0x00da, 0x04af, 0x0445, 0x0030,
+0x01a7, 0x05d2, 0x0538, 0x014d, 0x04ec, 0x0099, 0x0073, 0x0406,
+0x0744, 0x0331, 0x03db, 0x07ae, 0x020f, 0x067a, 0x0690, 0x02e5,
+0x0014, 0x0461, 0x048b, 0x00fe, 0x055f, 0x012a, 0x01c0, 0x05b5,
+0x06f7, 0x0282, 0x0268, 0x061d, 0x03bc, 0x07c9, 0x0723, 0x0356,
+0x018e, 0x05fb, 0x0511, 0x0164, 0x04c5, 0x00b0, 0x005a, 0x042f,
+0x076d, 0x0318, 0x03f2, 0x0787, 0x0226, 0x0653, 0x06b9, 0x02cc,
+0x003d, 0x0448, 0x04a2, 0x00d7, 0x0576, 0x0103, 0x01e9, 0x059c,
+0x06de, 0x02ab, 0x0241, 0x0634, 0x0395, 0x07e0, 0x070a, 0x037f,
+0x02e8, 0x069d, 0x0677, 0x0202, 0x07a3, 0x03d6, 0x033c, 0x0749,
+0x040b, 0x007e, 0x0094, 0x04e1, 0x0140, 0x0535, 0x05df, 0x01aa,
+0x035b, 0x072e, 0x07c4, 0x03b1, 0x0610, 0x0265, 0x028f, 0x06fa,
+0x05b8, 0x01cd, 0x0127, 0x0552, 0x00f3, 0x0486, 0x046c, 0x0019,
+0x0742, 0x0337, 0x03dd, 0x07a8, 0x0209, 0x067c, 0x0696, 0x02e3,
+0x01a1, 0x05d4, 0x053e, 0x014b, 0x04ea, 0x009f, 0x0075, 0x0400,
+0x06f1, 0x0284, 0x026e, 0x061b, 0x03ba, 0x07cf, 0x0725, 0x0350,
+0x0012, 0x0467, 0x048d, 0x00f8, 0x0559, 0x012c, 0x01c6, 0x05b3,
+0x0424, 0x0051, 0x00bb, 0x04ce, 0x016f, 0x051a, 0x05f0, 0x0185,
+0x02c7, 0x06b2, 0x0658, 0x022d, 0x078c, 0x03f9, 0x0313, 0x0766,
+0x0597, 0x01e2, 0x0108, 0x057d, 0x00dc, 0x04a9, 0x0443, 0x0036,
+0x0374, 0x0701, 0x07eb, 0x039e, 0x063f, 0x024a, 0x02a0, 0x06d5,
+0x0063, 0x0416, 0x04fc, 0x0089, 0x0528, 0x015d, 0x01b7, 0x05c2,
+0x0680, 0x02f5, 0x021f, 0x066a, 0x03cb, 0x07be, 0x0754, 0x0321,
+0x01d0, 0x05a5, 0x054f, 0x013a, 0x049b, 0x00ee, 0x0004, 0x0471,
+0x0733, 0x0346, 0x03ac, 0x07d9, 0x0278, 0x060d, 0x06e7, 0x0292,
+0x0305, 0x0770, 0x079a, 0x03ef, 0x064e, 0x023b, 0x02d1, 0x06a4,
+0x05e6, 0x0193, 0x0179, 0x050c, 0x00ad, 0x04d8, 0x0432, 0x0047,
+0x02b6, 0x06c3, 0x0629, 0x025c, 0x07fd, 0x0388, 0x0362, 0x0717,
+0x0455, 0x0020, 0x00ca, 0x04bf, 0x011e, 0x056b, 0x0581, 0x01f4,
+0x06af, 0x02da, 0x0230, 0x0645, 0x03e4, 0x0791, 0x077b, 0x030e,
+0x004c, 0x0439, 0x04d3, 0x00a6, 0x0507, 0x0172, 0x0198, 0x05ed,
+0x071c, 0x0369, 0x0383, 0x07f6, 0x0257, 0x0622, 0x06c8, 0x02bd,
+0x01ff, 0x058a, 0x0560, 0x0115, 0x04b4, 0x00c1, 0x002b, 0x045e,
+0x05c9, 0x01bc, 0x0156, 0x0523, 0x0082, 0x04f7, 0x041d, 0x0068,
+0x032a, 0x075f, 0x07b5, 0x03c0, 0x0661, 0x0214, 0x02fe, 0x068b,
+0x047a, 0x000f, 0x00e5, 0x0490, 0x0131, 0x0544, 0x05ae, 0x01db,
+0x0299, 0x06ec, 0x0606, 0x0273, 0x07d2, 0x03a7, 0x034d, 0x0738,
+0x0254, 0x0621, 0x06cb, 0x02be, 0x071f, 0x036a, 0x0380, 0x07f5,
+0x04b7, 0x00c2, 0x0028, 0x045d, 0x01fc, 0x0589, 0x0563, 0x0116,
+0x03e7, 0x0792, 0x0778, 0x030d, 0x06ac, 0x02d9, 0x0233, 0x0646,
+0x0504, 0x0171, 0x019b, 0x05ee, 0x004f, 0x043a, 0x04d0, 0x00a5,
+0x0132, 0x0547, 0x05ad, 0x01d8, 0x0479, 0x000c, 0x00e6, 0x0493,
+0x07d1, 0x03a4, 0x034e, 0x073b, 0x029a, 0x06ef, 0x0605, 0x0270,
+0x0081, 0x04f4, 0x041e, 0x006b, 0x05ca, 0x01bf, 0x0155, 0x0520,
+0x0662, 0x0217, 0x02fd, 0x0688, 0x0329, 0x075c, 0x07b6, 0x03c3,
+0x0498, 0x00ed, 0x0007, 0x0472, 0x01d3, 0x05a6, 0x054c, 0x0139,
+0x027b, 0x060e, 0x06e4, 0x0291, 0x0730, 0x0345, 0x03af, 0x07da,
+0x052b, 0x015e, 0x01b4, 0x05c1, 0x0060, 0x0415, 0x04ff, 0x008a,
+0x03c8, 0x07bd, 0x0757, 0x0322, 0x0683, 0x02f6, 0x021c, 0x0669,
+0x07fe, 0x038b, 0x0361, 0x0714, 0x02b5, 0x06c0, 0x062a, 0x025f,
+0x011d, 0x0568, 0x0582, 0x01f7, 0x0456, 0x0023, 0x00c9, 0x04bc,
+0x064d, 0x0238, 0x02d2, 0x06a7, 0x0306, 0x0773, 0x0799, 0x03ec,
+0x00ae, 0x04db, 0x0431, 0x0044, 0x05e5, 0x0190, 0x017a, 0x050f,
+0x03b9, 0x07cc, 0x0726, 0x0353, 0x06f2, 0x0287, 0x026d, 0x0618,
+0x055a, 0x012f, 0x01c5, 0x05b0, 0x0011, 0x0464, 0x048e, 0x00fb,
+0x020a, 0x067f, 0x0695, 0x02e0, 0x0741, 0x0334, 0x03de, 0x07ab,
+0x04e9, 0x009c, 0x0076, 0x0403, 0x01a2, 0x05d7, 0x053d, 0x0148,
+0x00df, 0x04aa, 0x0440, 0x0035, 0x0594, 0x01e1, 0x010b, 0x057e,
+0x063c, 0x0249, 0x02a3, 0x06d6, 0x0377, 0x0702, 0x07e8, 0x039d,
+0x016c, 0x0519, 0x05f3, 0x0186, 0x0427, 0x0052, 0x00b8, 0x04cd,
+0x078f, 0x03fa, 0x0310, 0x0765, 0x02c4, 0x06b1, 0x065b, 0x022e,
+0x0575, 0x0100, 0x01ea, 0x059f, 0x003e, 0x044b, 0x04a1, 0x00d4,
+0x0396, 0x07e3, 0x0709, 0x037c, 0x06dd, 0x02a8, 0x0242, 0x0637,
+0x04c6, 0x00b3, 0x0059, 0x042c, 0x018d, 0x05f8, 0x0512, 0x0167,
+0x0225, 0x0650, 0x06ba, 0x02cf, 0x076e, 0x031b, 0x03f1, 0x0784,
+0x0613, 0x0266, 0x028c, 0x06f9, 0x0358, 0x072d, 0x07c7, 0x03b2,
+0x00f0, 0x0485, 0x046f, 0x001a, 0x05bb, 0x01ce, 0x0124, 0x0551,
+0x07a0, 0x03d5, 0x033f, 0x074a, 0x02eb, 0x069e, 0x0674, 0x0201,
+0x0143, 0x0536, 0x05dc, 0x01a9, 0x0408, 0x007d, 0x0097, 0x04e2,
+0x0527, 0x0152, 0x01b8, 0x05cd, 0x006c, 0x0419, 0x04f3, 0x0086,
+0x03c4, 0x07b1, 0x075b, 0x032e, 0x068f, 0x02fa, 0x0210, 0x0665,
+0x0494, 0x00e1, 0x000b, 0x047e, 0x01df, 0x05aa, 0x0540, 0x0135,
+0x0277, 0x0602, 0x06e8, 0x029d, 0x073c, 0x0349, 0x03a3, 0x07d6,
+0x0641, 0x0234, 0x02de, 0x06ab, 0x030a, 0x077f, 0x0795, 0x03e0,
+0x00a2, 0x04d7, 0x043d, 0x0048, 0x05e9, 0x019c, 0x0176, 0x0503,
+0x07f2, 0x0387, 0x036d, 0x0718, 0x02b9, 0x06cc, 0x0626, 0x0253,
+0x0111, 0x0564, 0x058e, 0x01fb, 0x045a, 0x002f, 0x00c5, 0x04b0,
+0x03eb, 0x079e, 0x0774, 0x0301, 0x06a0, 0x02d5, 0x023f, 0x064a,
+0x0508, 0x017d, 0x0197, 0x05e2, 0x0043, 0x0436, 0x04dc, 0x00a9,
+0x0258, 0x062d, 0x06c7, 0x02b2, 0x0713, 0x0366, 0x038c, 0x07f9,
+0x04bb, 0x00ce, 0x0024, 0x0451, 0x01f0, 0x0585, 0x056f, 0x011a,
+0x008d, 0x04f8, 0x0412, 0x0067, 0x05c6, 0x01b3, 0x0159, 0x052c,
+0x066e, 0x021b, 0x02f1, 0x0684, 0x0325, 0x0750, 0x07ba, 0x03cf,
+0x013e, 0x054b, 0x05a1, 0x01d4, 0x0475, 0x0000, 0x00ea, 0x049f,
+0x07dd, 0x03a8, 0x0342, 0x0737, 0x0296, 0x06e3, 0x0609, 0x027c,
+0x04ca, 0x00bf, 0x0055, 0x0420, 0x0181, 0x05f4, 0x051e, 0x016b,
+0x0229, 0x065c, 0x06b6, 0x02c3, 0x0762, 0x0317, 0x03fd, 0x0788,
+0x0579, 0x010c, 0x01e6, 0x0593, 0x0032, 0x0447, 0x04ad, 0x00d8,
+0x039a, 0x07ef, 0x0705, 0x0370, 0x06d1, 0x02a4, 0x024e, 0x063b,
+0x07ac, 0x03d9, 0x0333, 0x0746, 0x02e7, 0x0692, 0x0678, 0x020d,
+0x014f, 0x053a, 0x05d0, 0x01a5, 0x0404, 0x0071, 0x009b, 0x04ee,
+0x061f, 0x026a, 0x0280, 0x06f5, 0x0354, 0x0721, 0x07cb, 0x03be,
+0x00fc, 0x0489, 0x0463, 0x0016, 0x05b7, 0x01c2, 0x0128, 0x055d,
+0x0206, 0x0673, 0x0699, 0x02ec, 0x074d, 0x0338, 0x03d2, 0x07a7,
+0x04e5, 0x0090, 0x007a, 0x040f, 0x01ae, 0x05db, 0x0531, 0x0144,
+0x03b5, 0x07c0, 0x072a, 0x035f, 0x06fe, 0x028b, 0x0261, 0x0614,
+0x0556, 0x0123, 0x01c9, 0x05bc, 0x001d, 0x0468, 0x0482, 0x00f7,
+0x0160, 0x0515, 0x05ff, 0x018a, 0x042b, 0x005e, 0x00b4, 0x04c1,
+0x0783, 0x03f6, 0x031c, 0x0769, 0x02c8, 0x06bd, 0x0657, 0x0222,
+0x00d3, 0x04a6, 0x044c, 0x0039, 0x0598, 0x01ed, 0x0107, 0x0572,
+0x0630, 0x0245, 0x02af, 0x06da, 0x037b, 0x070e, 0x07e4, 0x0391,
+0x06fd, 0x0288, 0x0262, 0x0617, 0x03b6, 0x07c3, 0x0729, 0x035c,
+0x001e, 0x046b, 0x0481, 0x00f4, 0x0555, 0x0120, 0x01ca, 0x05bf,
+0x074e, 0x033b, 0x03d1, 0x07a4, 0x0205, 0x0670, 0x069a, 0x02ef,
+0x01ad, 0x05d8, 0x0532, 0x0147, 0x04e6, 0x0093, 0x0079, 0x040c,
+0x059b, 0x01ee, 0x0104, 0x0571, 0x00d0, 0x04a5, 0x044f, 0x003a,
+0x0378, 0x070d, 0x07e7, 0x0392, 0x0633, 0x0246, 0x02ac, 0x06d9,
+0x0428, 0x005d, 0x00b7, 0x04c2, 0x0163, 0x0516, 0x05fc, 0x0189,
+0x02cb, 0x06be, 0x0654, 0x0221, 0x0780, 0x03f5, 0x031f, 0x076a,
+0x0031, 0x0444, 0x04ae, 0x00db, 0x057a, 0x010f, 0x01e5, 0x0590,
+0x06d2, 0x02a7, 0x024d, 0x0638, 0x0399, 0x07ec, 0x0706, 0x0373,
+0x0182, 0x05f7, 0x051d, 0x0168, 0x04c9, 0x00bc, 0x0056, 0x0423,
+0x0761, 0x0314, 0x03fe, 0x078b, 0x022a, 0x065f, 0x06b5, 0x02c0,
+0x0357, 0x0722, 0x07c8, 0x03bd, 0x061c, 0x0269, 0x0283, 0x06f6,
+0x05b4, 0x01c1, 0x012b, 0x055e, 0x00ff, 0x048a, 0x0460, 0x0015,
+0x02e4, 0x0691, 0x067b, 0x020e, 0x07af, 0x03da, 0x0330, 0x0745,
+0x0407, 0x0072, 0x0098, 0x04ed, 0x014c, 0x0539, 0x05d3, 0x01a6,
+0x0710, 0x0365, 0x038f, 0x07fa, 0x025b, 0x062e, 0x06c4, 0x02b1,
+0x01f3, 0x0586, 0x056c, 0x0119, 0x04b8, 0x00cd, 0x0027, 0x0452,
+0x06a3, 0x02d6, 0x023c, 0x0649, 0x03e8, 0x079d, 0x0777, 0x0302,
+0x0040, 0x0435, 0x04df, 0x00aa, 0x050b, 0x017e, 0x0194, 0x05e1,
+0x0476, 0x0003, 0x00e9, 0x049c, 0x013d, 0x0548, 0x05a2, 0x01d7,
+0x0295, 0x06e0, 0x060a, 0x027f, 0x07de, 0x03ab, 0x0341, 0x0734,
+0x05c5, 0x01b0, 0x015a, 0x052f, 0x008e, 0x04fb, 0x0411, 0x0064,
+0x0326, 0x0753, 0x07b9, 0x03cc, 0x066d, 0x0218, 0x02f2, 0x0687,
+0x01dc, 0x05a9, 0x0543, 0x0136, 0x0497, 0x00e2, 0x0008, 0x047d,
+0x073f, 0x034a, 0x03a0, 0x07d5, 0x0274, 0x0601, 0x06eb, 0x029e,
+0x006f, 0x041a, 0x04f0, 0x0085, 0x0524, 0x0151, 0x01bb, 0x05ce,
+0x068c, 0x02f9, 0x0213, 0x0666, 0x03c7, 0x07b2, 0x0758, 0x032d,
+0x02ba, 0x06cf, 0x0625, 0x0250, 0x07f1, 0x0384, 0x036e, 0x071b,
+0x0459, 0x002c, 0x00c6, 0x04b3, 0x0112, 0x0567, 0x058d, 0x01f8,
+0x0309, 0x077c, 0x0796, 0x03e3, 0x0642, 0x0237, 0x02dd, 0x06a8,
+0x05ea, 0x019f, 0x0175, 0x0500, 0x00a1, 0x04d4, 0x043e, 0x004b,
+0x0293, 0x06e6, 0x060c, 0x0279, 0x07d8, 0x03ad, 0x0347, 0x0732,
+0x0470, 0x0005, 0x00ef, 0x049a, 0x013b, 0x054e, 0x05a4, 0x01d1,
+0x0320, 0x0755, 0x07bf, 0x03ca, 0x066b, 0x021e, 0x02f4, 0x0681,
+0x05c3, 0x01b6, 0x015c, 0x0529, 0x0088, 0x04fd, 0x0417, 0x0062,
+0x01f5, 0x0580, 0x056a, 0x011f, 0x04be, 0x00cb, 0x0021, 0x0454,
+0x0716, 0x0363, 0x0389, 0x07fc, 0x025d, 0x0628, 0x06c2, 0x02b7,
+0x0046, 0x0433, 0x04d9, 0x00ac, 0x050d, 0x0178, 0x0192, 0x05e7,
+0x06a5, 0x02d0, 0x023a, 0x064f, 0x03ee, 0x079b, 0x0771, 0x0304,
+0x045f, 0x002a, 0x00c0, 0x04b5, 0x0114, 0x0561, 0x058b, 0x01fe,
+0x02bc, 0x06c9, 0x0623, 0x0256, 0x07f7, 0x0382, 0x0368, 0x071d,
+0x05ec, 0x0199, 0x0173, 0x0506, 0x00a7, 0x04d2, 0x0438, 0x004d,
+0x030f, 0x077a, 0x0790, 0x03e5, 0x0644, 0x0231, 0x02db, 0x06ae,
+0x0739, 0x034c, 0x03a6, 0x07d3, 0x0272, 0x0607, 0x06ed, 0x0298,
+0x01da, 0x05af, 0x0545, 0x0130, 0x0491, 0x00e4, 0x000e, 0x047b,
+0x068a, 0x02ff, 0x0215, 0x0660, 0x03c1, 0x07b4, 0x075e, 0x032b,
+0x0069, 0x041c, 0x04f6, 0x0083, 0x0522, 0x0157, 0x01bd, 0x05c8,
+0x037e, 0x070b, 0x07e1, 0x0394, 0x0635, 0x0240, 0x02aa, 0x06df,
+0x059d, 0x01e8, 0x0102, 0x0577, 0x00d6, 0x04a3, 0x0449, 0x003c,
+0x02cd, 0x06b8, 0x0652, 0x0227, 0x0786, 0x03f3, 0x0319, 0x076c,
+0x042e, 0x005b, 0x00b1, 0x04c4, 0x0165, 0x0510, 0x05fa, 0x018f,
+0x0018, 0x046d, 0x0487, 0x00f2, 0x0553, 0x0126, 0x01cc, 0x05b9,
+0x06fb, 0x028e, 0x0264, 0x0611, 0x03b0, 0x07c5, 0x072f, 0x035a,
+0x01ab, 0x05de, 0x0534, 0x0141, 0x04e0, 0x0095, 0x007f, 0x040a,
+0x0748, 0x033d, 0x03d7, 0x07a2, 0x0203, 0x0676, 0x069c, 0x02e9,
+0x05b2, 0x01c7, 0x012d, 0x0558, 0x00f9, 0x048c, 0x0466, 0x0013,
+0x0351, 0x0724, 0x07ce, 0x03bb, 0x061a, 0x026f, 0x0285, 0x06f0,
+0x0401, 0x0074, 0x009e, 0x04eb, 0x014a, 0x053f, 0x05d5, 0x01a0,
+0x02e2, 0x0697, 0x067d, 0x0208, 0x07a9, 0x03dc, 0x0336, 0x0743,
+0x06d4, 0x02a1, 0x024b, 0x063e, 0x039f, 0x07ea, 0x0700, 0x0375,
+0x0037, 0x0442, 0x04a8, 0x00dd, 0x057c, 0x0109, 0x01e3, 0x0596,
+0x0767, 0x0312, 0x03f8, 0x078d, 0x022c, 0x0659, 0x06b3, 0x02c6,
+0x0184, 0x05f1, 0x051b, 0x016e, 0x04cf, 0x00ba, 0x0050, 0x0425,
+0x0149, 0x053c, 0x05d6, 0x01a3, 0x0402, 0x0077, 0x009d, 0x04e8,
+0x07aa, 0x03df, 0x0335, 0x0740, 0x02e1, 0x0694, 0x067e, 0x020b,
+0x00fa, 0x048f, 0x0465, 0x0010, 0x05b1, 0x01c4, 0x012e, 0x055b,
+0x0619, 0x026c, 0x0286, 0x06f3, 0x0352, 0x0727, 0x07cd, 0x03b8,
+0x022f, 0x065a, 0x06b0, 0x02c5, 0x0764, 0x0311, 0x03fb, 0x078e,
+0x04cc, 0x00b9, 0x0053, 0x0426, 0x0187, 0x05f2, 0x0518, 0x016d,
+0x039c, 0x07e9, 0x0703, 0x0376, 0x06d7, 0x02a2, 0x0248, 0x063d,
+0x057f, 0x010a, 0x01e0, 0x0595, 0x0034, 0x0441, 0x04ab, 0x00de,
+0x0785, 0x03f0, 0x031a, 0x076f, 0x02ce, 0x06bb, 0x0651, 0x0224,
+0x0166, 0x0513, 0x05f9, 0x018c, 0x042d, 0x0058, 0x00b2, 0x04c7,
+0x0636, 0x0243, 0x02a9, 0x06dc, 0x037d, 0x0708, 0x07e2, 0x0397,
+0x00d5, 0x04a0, 0x044a, 0x003f, 0x059e, 0x01eb, 0x0101, 0x0574,
+0x04e3, 0x0096, 0x007c, 0x0409, 0x01a8, 0x05dd, 0x0537, 0x0142,
+0x0200, 0x0675, 0x069f, 0x02ea, 0x074b, 0x033e, 0x03d4, 0x07a1,
+0x0550, 0x0125, 0x01cf, 0x05ba, 0x001b, 0x046e, 0x0484, 0x00f1,
+0x03b3, 0x07c6, 0x072c, 0x0359, 0x06f8, 0x028d, 0x0267, 0x0612,
+0x00a4, 0x04d1, 0x043b, 0x004e, 0x05ef, 0x019a, 0x0170, 0x0505,
+0x0647, 0x0232, 0x02d8, 0x06ad, 0x030c, 0x0779, 0x0793, 0x03e6,
+0x0117, 0x0562, 0x0588, 0x01fd, 0x045c, 0x0029, 0x00c3, 0x04b6,
+0x07f4, 0x0381, 0x036b, 0x071e, 0x02bf, 0x06ca, 0x0620, 0x0255,
+0x03c2, 0x07b7, 0x075d, 0x0328, 0x0689, 0x02fc, 0x0216, 0x0663,
+0x0521, 0x0154, 0x01be, 0x05cb, 0x006a, 0x041f, 0x04f5, 0x0080,
+0x0271, 0x0604, 0x06ee, 0x029b, 0x073a, 0x034f, 0x03a5, 0x07d0,
+0x0492, 0x00e7, 0x000d, 0x0478, 0x01d9, 0x05ac, 0x0546, 0x0133,
+0x0668, 0x021d, 0x02f7, 0x0682, 0x0323, 0x0756, 0x07bc, 0x03c9,
+0x008b, 0x04fe, 0x0414, 0x0061, 0x05c0, 0x01b5, 0x015f, 0x052a,
+0x07db, 0x03ae, 0x0344, 0x0731, 0x0290, 0x06e5, 0x060f, 0x027a,
+0x0138, 0x054d, 0x05a7, 0x01d2, 0x0473, 0x0006, 0x00ec, 0x0499,
+0x050e, 0x017b, 0x0191, 0x05e4, 0x0045, 0x0430, 0x04da, 0x00af,
+0x03ed, 0x0798, 0x0772, 0x0307, 0x06a6, 0x02d3, 0x0239, 0x064c,
+0x04bd, 0x00c8, 0x0022, 0x0457, 0x01f6, 0x0583, 0x0569, 0x011c,
+0x025e, 0x062b, 0x06c1, 0x02b4, 0x0715, 0x0360, 0x038a, 0x07ff,
 };
 
-static const __code uint32_t golay23_decode[2048] = {
-0x00000000UL, 0x00000001UL, 0x00000002UL, 0x00000003UL, 0x00000004UL, 0x00000005UL, 0x00000006UL, 0x00000007UL, 
-0x00000008UL, 0x00000009UL, 0x0000000aUL, 0x0000000bUL, 0x0000000cUL, 0x0000000dUL, 0x0000000eUL, 0x00024020UL, 
-0x00000010UL, 0x00000011UL, 0x00000012UL, 0x00000013UL, 0x00000014UL, 0x00000015UL, 0x00000016UL, 0x00412000UL, 
-0x00000018UL, 0x00000019UL, 0x0000001aUL, 0x00180800UL, 0x0000001cUL, 0x00200300UL, 0x00048040UL, 0x00001480UL, 
-0x00000020UL, 0x00000021UL, 0x00000022UL, 0x00000023UL, 0x00000024UL, 0x00000025UL, 0x00000026UL, 0x00024008UL, 
-0x00000028UL, 0x00000029UL, 0x0000002aUL, 0x00024004UL, 0x0000002cUL, 0x00024002UL, 0x00024001UL, 0x00024000UL, 
-0x00000030UL, 0x00000031UL, 0x00000032UL, 0x00008180UL, 0x00000034UL, 0x00000c40UL, 0x00301000UL, 0x000c0200UL, 
-0x00000038UL, 0x00043000UL, 0x00400600UL, 0x00210040UL, 0x00090080UL, 0x00508000UL, 0x00002900UL, 0x00024010UL, 
-0x00000040UL, 0x00000041UL, 0x00000042UL, 0x00000043UL, 0x00000044UL, 0x00000045UL, 0x00000046UL, 0x00280080UL, 
-0x00000048UL, 0x00000049UL, 0x0000004aUL, 0x00002500UL, 0x0000004cUL, 0x00111000UL, 0x00048010UL, 0x00400a00UL, 
-0x00000050UL, 0x00000051UL, 0x00000052UL, 0x00021200UL, 0x00000054UL, 0x00000c20UL, 0x00048008UL, 0x00104100UL, 
-0x00000058UL, 0x00404080UL, 0x00048004UL, 0x00210020UL, 0x00048002UL, 0x000a2000UL, 0x00048000UL, 0x00048001UL, 
-0x00000060UL, 0x00000061UL, 0x00000062UL, 0x00540000UL, 0x00000064UL, 0x00000c10UL, 0x00010300UL, 0x0000b000UL, 
-0x00000068UL, 0x00088200UL, 0x00001880UL, 0x00210010UL, 0x00602000UL, 0x00040180UL, 0x00180400UL, 0x00024040UL, 
-0x00000070UL, 0x00000c04UL, 0x00086000UL, 0x00210008UL, 0x00000c01UL, 0x00000c00UL, 0x00420080UL, 0x00000c02UL, 
-0x00120100UL, 0x00210002UL, 0x00210001UL, 0x00210000UL, 0x00005200UL, 0x00000c08UL, 0x00048020UL, 0x00210004UL, 
-0x00000080UL, 0x00000081UL, 0x00000082UL, 0x00000083UL, 0x00000084UL, 0x00000085UL, 0x00000086UL, 0x00280040UL, 
-0x00000088UL, 0x00000089UL, 0x0000008aUL, 0x00050200UL, 0x0000008cUL, 0x0000a800UL, 0x00500100UL, 0x00001410UL, 
-0x00000090UL, 0x00000091UL, 0x00000092UL, 0x00008120UL, 0x00000094UL, 0x00160000UL, 0x00004a00UL, 0x00001408UL, 
-0x00000098UL, 0x00404040UL, 0x00222000UL, 0x00001404UL, 0x00090020UL, 0x00001402UL, 0x00001401UL, 0x00001400UL, 
-0x000000a0UL, 0x000000a1UL, 0x000000a2UL, 0x00008110UL, 0x000000a4UL, 0x00401200UL, 0x00042400UL, 0x00110800UL, 
-0x000000a8UL, 0x00300400UL, 0x00001840UL, 0x00482000UL, 0x00090010UL, 0x00040140UL, 0x00208200UL, 0x00024080UL, 
-0x000000b0UL, 0x00008102UL, 0x00008101UL, 0x00008100UL, 0x00090008UL, 0x00206000UL, 0x00420040UL, 0x00008104UL, 
-0x00090004UL, 0x00020a00UL, 0x00144000UL, 0x00008108UL, 0x00090000UL, 0x00090001UL, 0x00090002UL, 0x00001420UL, 
-0x000000c0UL, 0x000000c1UL, 0x000000c2UL, 0x00280004UL, 0x000000c4UL, 0x00280002UL, 0x00280001UL, 0x00280000UL, 
-0x000000c8UL, 0x00404010UL, 0x00001820UL, 0x00128000UL, 0x00020600UL, 0x00040120UL, 0x00016000UL, 0x00280008UL, 
-0x000000d0UL, 0x00404008UL, 0x00110400UL, 0x00042800UL, 0x00003100UL, 0x00018200UL, 0x00420020UL, 0x00280010UL, 
-0x00404001UL, 0x00404000UL, 0x00080300UL, 0x00404002UL, 0x00300800UL, 0x00404004UL, 0x00048080UL, 0x00001440UL, 
-0x000000e0UL, 0x00032000UL, 0x00001808UL, 0x00004600UL, 0x0010c000UL, 0x00040108UL, 0x00420010UL, 0x00280020UL, 
-0x00001802UL, 0x00040104UL, 0x00001800UL, 0x00001801UL, 0x00040101UL, 0x00040100UL, 0x00001804UL, 0x00040102UL, 
-0x00240200UL, 0x00181000UL, 0x00420004UL, 0x00008140UL, 0x00420002UL, 0x00000c80UL, 0x00420000UL, 0x00420001UL, 
-0x0000a400UL, 0x00404020UL, 0x00001810UL, 0x00210080UL, 0x00090040UL, 0x00040110UL, 0x00420008UL, 0x00102200UL, 
-0x00000100UL, 0x00000101UL, 0x00000102UL, 0x00000103UL, 0x00000104UL, 0x00000105UL, 0x00000106UL, 0x00041800UL, 
-0x00000108UL, 0x00000109UL, 0x0000010aUL, 0x00002440UL, 0x0000010cUL, 0x00200210UL, 0x00500080UL, 0x00098000UL, 
-0x00000110UL, 0x00000111UL, 0x00000112UL, 0x000080a0UL, 0x00000114UL, 0x00200208UL, 0x000a0400UL, 0x00104040UL, 
-0x00000118UL, 0x00200204UL, 0x00015000UL, 0x00460000UL, 0x00200201UL, 0x00200200UL, 0x00002820UL, 0x00200202UL, 
-0x00000120UL, 0x00000121UL, 0x00000122UL, 0x00008090UL, 0x00000124UL, 0x00182000UL, 0x00010240UL, 0x00600400UL, 
-0x00000128UL, 0x00410800UL, 0x002c0000UL, 0x00101200UL, 0x00009400UL, 0x000400c0UL, 0x00002810UL, 0x00024100UL, 
-0x00000130UL, 0x00008082UL, 0x00008081UL, 0x00008080UL, 0x00444000UL, 0x00031000UL, 0x00002808UL, 0x00008084UL, 
-0x00120040UL, 0x00084400UL, 0x00002804UL, 0x00008088UL, 0x00002802UL, 0x00200220UL, 0x00002800UL, 0x00002801UL, 
-0x00000140UL, 0x00000141UL, 0x00000142UL, 0x00002408UL, 0x00000144UL, 0x00428000UL, 0x00010220UL, 0x00104010UL, 
-0x00000148UL, 0x00002402UL, 0x00002401UL, 0x00002400UL, 0x00084800UL, 0x000400a0UL, 0x00221000UL, 0x00002404UL, 
-0x00000150UL, 0x000d0000UL, 0x00600800UL, 0x00104004UL, 0x00003080UL, 0x00104002UL, 0x00104001UL, 0x00104000UL, 
-0x00120020UL, 0x00009800UL, 0x00080280UL, 0x00002410UL, 0x00410400UL, 0x00200240UL, 0x00048100UL, 0x00104008UL, 
-0x00000160UL, 0x00205000UL, 0x00010204UL, 0x000a0800UL, 0x00010202UL, 0x00040088UL, 0x00010200UL, 0x00010201UL, 
-0x00120010UL, 0x00040084UL, 0x0040c000UL, 0x00002420UL, 0x00040081UL, 0x00040080UL, 0x00010208UL, 0x00040082UL, 
-0x00120008UL, 0x00402200UL, 0x00041400UL, 0x000080c0UL, 0x00288000UL, 0x00000d00UL, 0x00010210UL, 0x00104020UL, 
-0x00120000UL, 0x00120001UL, 0x00120002UL, 0x00210100UL, 0x00120004UL, 0x00040090UL, 0x00002840UL, 0x00481000UL, 
-0x00000180UL, 0x00000181UL, 0x00000182UL, 0x00008030UL, 0x00000184UL, 0x00014400UL, 0x00500008UL, 0x00022200UL, 
-0x00000188UL, 0x000a1000UL, 0x00500004UL, 0x00204800UL, 0x00500002UL, 0x00040060UL, 0x00500000UL, 0x00500001UL, 
-0x00000190UL, 0x00008022UL, 0x00008021UL, 0x00008020UL, 0x00003040UL, 0x00480800UL, 0x00250000UL, 0x00008024UL, 
-0x00040c00UL, 0x00112000UL, 0x00080240UL, 0x00008028UL, 0x0002c000UL, 0x00200280UL, 0x00500010UL, 0x00001500UL, 
-0x000001a0UL, 0x00008012UL, 0x00008011UL, 0x00008010UL, 0x00220800UL, 0x00040048UL, 0x00085000UL, 0x00008014UL, 
-0x00006200UL, 0x00040044UL, 0x00030400UL, 0x00008018UL, 0x00040041UL, 0x00040040UL, 0x00500020UL, 0x00040042UL, 
-0x00008003UL, 0x00008002UL, 0x00008001UL, 0x00008000UL, 0x00100600UL, 0x00008006UL, 0x00008005UL, 0x00008004UL, 
-0x00601000UL, 0x0000800aUL, 0x00008009UL, 0x00008008UL, 0x00090100UL, 0x00040050UL, 0x00002880UL, 0x0000800cUL, 
-0x000001c0UL, 0x00100a00UL, 0x00064000UL, 0x00411000UL, 0x00003010UL, 0x00040028UL, 0x00008c00UL, 0x00280100UL, 
-0x00218000UL, 0x00040024UL, 0x00080210UL, 0x00002480UL, 0x00040021UL, 0x00040020UL, 0x00500040UL, 0x00040022UL, 
-0x00003004UL, 0x00220400UL, 0x00080208UL, 0x00008060UL, 0x00003000UL, 0x00003001UL, 0x00003002UL, 0x00104080UL, 
-0x00080202UL, 0x00404100UL, 0x00080200UL, 0x00080201UL, 0x00003008UL, 0x00040030UL, 0x00080204UL, 0x00030800UL, 
-0x00480400UL, 0x0004000cUL, 0x00302000UL, 0x00008050UL, 0x00040009UL, 0x00040008UL, 0x00010280UL, 0x0004000aUL, 
-0x00040005UL, 0x00040004UL, 0x00001900UL, 0x00040006UL, 0x00040001UL, 0x00040000UL, 0x00040003UL, 0x00040002UL, 
-0x00014800UL, 0x00008042UL, 0x00008041UL, 0x00008040UL, 0x00003020UL, 0x00040018UL, 0x00420100UL, 0x00008044UL, 
-0x00120080UL, 0x00040014UL, 0x00080220UL, 0x00008048UL, 0x00040011UL, 0x00040010UL, 0x00204400UL, 0x00040012UL, 
-0x00000200UL, 0x00000201UL, 0x00000202UL, 0x00000203UL, 0x00000204UL, 0x00000205UL, 0x00000206UL, 0x00108400UL, 
-0x00000208UL, 0x00000209UL, 0x0000020aUL, 0x00050080UL, 0x0000020cUL, 0x00200110UL, 0x00083000UL, 0x00400840UL, 
-0x00000210UL, 0x00000211UL, 0x00000212UL, 0x00021040UL, 0x00000214UL, 0x00200108UL, 0x00004880UL, 0x000c0020UL, 
-0x00000218UL, 0x00200104UL, 0x00400420UL, 0x0000e000UL, 0x00200101UL, 0x00200100UL, 0x00130000UL, 0x00200102UL, 
-0x00000220UL, 0x00000221UL, 0x00000222UL, 0x00202800UL, 0x00000224UL, 0x00401080UL, 0x00010140UL, 0x000c0010UL, 
-0x00000228UL, 0x00088040UL, 0x00400410UL, 0x00101100UL, 0x00140800UL, 0x00012400UL, 0x00208080UL, 0x00024200UL, 
-0x00000230UL, 0x00114000UL, 0x00400408UL, 0x000c0004UL, 0x0002a000UL, 0x000c0002UL, 0x000c0001UL, 0x000c0000UL, 
-0x00400402UL, 0x00020880UL, 0x00400400UL, 0x00400401UL, 0x00005040UL, 0x00200120UL, 0x00400404UL, 0x000c0008UL, 
-0x00000240UL, 0x00000241UL, 0x00000242UL, 0x00021010UL, 0x00000244UL, 0x00046000UL, 0x00010120UL, 0x00400808UL, 
-0x00000248UL, 0x00088020UL, 0x00304000UL, 0x00400804UL, 0x00020480UL, 0x00400802UL, 0x00400801UL, 0x00400800UL, 
-0x00000250UL, 0x00021002UL, 0x00021001UL, 0x00021000UL, 0x00580000UL, 0x00018080UL, 0x00202400UL, 0x00021004UL, 
-0x00012800UL, 0x00140400UL, 0x00080180UL, 0x00021008UL, 0x00005020UL, 0x00200140UL, 0x00048200UL, 0x00400810UL, 
-0x00000260UL, 0x00088008UL, 0x00010104UL, 0x00004480UL, 0x00010102UL, 0x00320000UL, 0x00010100UL, 0x00010101UL, 
-0x00088001UL, 0x00088000UL, 0x00062000UL, 0x00088002UL, 0x00005010UL, 0x00088004UL, 0x00010108UL, 0x00400820UL, 
-0x00240080UL, 0x00402100UL, 0x00108800UL, 0x00021020UL, 0x00005008UL, 0x00000e00UL, 0x00010110UL, 0x000c0040UL, 
-0x00005004UL, 0x00088010UL, 0x00400440UL, 0x00210200UL, 0x00005000UL, 0x00005001UL, 0x00005002UL, 0x00102080UL, 
-0x00000280UL, 0x00000281UL, 0x00000282UL, 0x00050008UL, 0x00000284UL, 0x00401020UL, 0x00004810UL, 0x00022100UL, 
-0x00000288UL, 0x00050002UL, 0x00050001UL, 0x00050000UL, 0x00020440UL, 0x00184000UL, 0x00208020UL, 0x00050004UL, 
-0x00000290UL, 0x00082400UL, 0x00004804UL, 0x00700000UL, 0x00004802UL, 0x00018040UL, 0x00004800UL, 0x00004801UL, 
-0x00109000UL, 0x00020820UL, 0x00080140UL, 0x00050010UL, 0x00442000UL, 0x00200180UL, 0x00004808UL, 0x00001600UL, 
-0x000002a0UL, 0x00401004UL, 0x001a0000UL, 0x00004440UL, 0x00401001UL, 0x00401000UL, 0x00208008UL, 0x00401002UL, 
-0x00006100UL, 0x00020810UL, 0x00208004UL, 0x00050020UL, 0x00208002UL, 0x00401008UL, 0x00208000UL, 0x00208001UL, 
-0x00240040UL, 0x00020808UL, 0x00013000UL, 0x00008300UL, 0x00100500UL, 0x00401010UL, 0x00004820UL, 0x000c0080UL, 
-0x00020801UL, 0x00020800UL, 0x00400480UL, 0x00020802UL, 0x00090200UL, 0x00020804UL, 0x00208010UL, 0x00102040UL, 
-0x000002c0UL, 0x00100900UL, 0x0040a000UL, 0x00004420UL, 0x00020408UL, 0x00018010UL, 0x00141000UL, 0x00280200UL, 
-0x00020404UL, 0x00203000UL, 0x00080110UL, 0x00050040UL, 0x00020400UL, 0x00020401UL, 0x00020402UL, 0x00400880UL, 
-0x00240020UL, 0x00018004UL, 0x00080108UL, 0x00021080UL, 0x00018001UL, 0x00018000UL, 0x00004840UL, 0x00018002UL, 
-0x00080102UL, 0x00404200UL, 0x00080100UL, 0x00080101UL, 0x00020410UL, 0x00018008UL, 0x00080104UL, 0x00102020UL, 
-0x00240010UL, 0x00004402UL, 0x00004401UL, 0x00004400UL, 0x00082800UL, 0x00401040UL, 0x00010180UL, 0x00004404UL, 
-0x00510000UL, 0x00088080UL, 0x00001a00UL, 0x00004408UL, 0x00020420UL, 0x00040300UL, 0x00208040UL, 0x00102010UL, 
-0x00240000UL, 0x00240001UL, 0x00240002UL, 0x00004410UL, 0x00240004UL, 0x00018020UL, 0x00420200UL, 0x00102008UL, 
-0x00240008UL, 0x00020840UL, 0x00080120UL, 0x00102004UL, 0x00005080UL, 0x00102002UL, 0x00102001UL, 0x00102000UL, 
-0x00000300UL, 0x00000301UL, 0x00000302UL, 0x00484000UL, 0x00000304UL, 0x00200018UL, 0x00010060UL, 0x00022080UL, 
-0x00000308UL, 0x00200014UL, 0x00028800UL, 0x00101020UL, 0x00200011UL, 0x00200010UL, 0x00044400UL, 0x00200012UL, 
-0x00000310UL, 0x0020000cUL, 0x00142000UL, 0x00010c00UL, 0x00200009UL, 0x00200008UL, 0x00409000UL, 0x0020000aUL, 
-0x00200005UL, 0x00200004UL, 0x000800c0UL, 0x00200006UL, 0x00200001UL, 0x00200000UL, 0x00200003UL, 0x00200002UL, 
-0x00000320UL, 0x00060400UL, 0x00010044UL, 0x00101008UL, 0x00010042UL, 0x0000c800UL, 0x00010040UL, 0x00010041UL, 
-0x00006080UL, 0x00101002UL, 0x00101001UL, 0x00101000UL, 0x004a0000UL, 0x00200030UL, 0x00010048UL, 0x00101004UL, 
-0x00081800UL, 0x00402040UL, 0x00224000UL, 0x00008280UL, 0x00100480UL, 0x00200028UL, 0x00010050UL, 0x000c0100UL, 
-0x00058000UL, 0x00200024UL, 0x00400500UL, 0x00101010UL, 0x00200021UL, 0x00200020UL, 0x00002a00UL, 0x00200022UL, 
-0x00000340UL, 0x00100880UL, 0x00010024UL, 0x00248000UL, 0x00010022UL, 0x00081400UL, 0x00010020UL, 0x00010021UL, 
-0x00441000UL, 0x00034000UL, 0x00080090UL, 0x00002600UL, 0x0010a000UL, 0x00200050UL, 0x00010028UL, 0x00400900UL, 
-0x0000c400UL, 0x00402020UL, 0x00080088UL, 0x00021100UL, 0x00060800UL, 0x00200048UL, 0x00010030UL, 0x00104200UL, 
-0x00080082UL, 0x00200044UL, 0x00080080UL, 0x00080081UL, 0x00200041UL, 0x00200040UL, 0x00080084UL, 0x00200042UL, 
-0x00010006UL, 0x00402010UL, 0x00010004UL, 0x00010005UL, 0x00010002UL, 0x00010003UL, 0x00010000UL, 0x00010001UL, 
-0x00200c00UL, 0x00088100UL, 0x0001000cUL, 0x00101040UL, 0x0001000aUL, 0x00040280UL, 0x00010008UL, 0x00010009UL, 
-0x00402001UL, 0x00402000UL, 0x00010014UL, 0x00402002UL, 0x00010012UL, 0x00402004UL, 0x00010010UL, 0x00010011UL, 
-0x00120200UL, 0x00402008UL, 0x000800a0UL, 0x00044800UL, 0x00005100UL, 0x00200060UL, 0x00010018UL, 0x00028400UL, 
-0x00000380UL, 0x00100840UL, 0x00201400UL, 0x00022004UL, 0x000c8000UL, 0x00022002UL, 0x00022001UL, 0x00022000UL, 
-0x00006020UL, 0x00408400UL, 0x00080050UL, 0x00050100UL, 0x00011800UL, 0x00200090UL, 0x00500200UL, 0x00022008UL, 
-0x00430000UL, 0x00045000UL, 0x00080048UL, 0x00008220UL, 0x00100420UL, 0x00200088UL, 0x00004900UL, 0x00022010UL, 
-0x00080042UL, 0x00200084UL, 0x00080040UL, 0x00080041UL, 0x00200081UL, 0x00200080UL, 0x00080044UL, 0x00200082UL, 
-0x00006008UL, 0x00290000UL, 0x00440800UL, 0x00008210UL, 0x00100410UL, 0x00401100UL, 0x000100c0UL, 0x00022020UL, 
-0x00006000UL, 0x00006001UL, 0x00006002UL, 0x00101080UL, 0x00006004UL, 0x00040240UL, 0x00208100UL, 0x00080c00UL, 
-0x00100404UL, 0x00008202UL, 0x00008201UL, 0x00008200UL, 0x00100400UL, 0x00100401UL, 0x00100402UL, 0x00008204UL, 
-0x00006010UL, 0x00020900UL, 0x00080060UL, 0x00008208UL, 0x00100408UL, 0x002000a0UL, 0x00061000UL, 0x00414000UL, 
-0x00100801UL, 0x00100800UL, 0x00080018UL, 0x00100802UL, 0x00604000UL, 0x00100804UL, 0x000100a0UL, 0x00022040UL, 
-0x00080012UL, 0x00100808UL, 0x00080010UL, 0x00080011UL, 0x00020500UL, 0x00040220UL, 0x00080014UL, 0x0000d000UL, 
-0x0008000aUL, 0x00100810UL, 0x00080008UL, 0x00080009UL, 0x00003200UL, 0x00018100UL, 0x0008000cUL, 0x00440400UL, 
-0x00080002UL, 0x00080003UL, 0x00080000UL, 0x00080001UL, 0x00080006UL, 0x002000c0UL, 0x00080004UL, 0x00080005UL, 
-0x00029000UL, 0x00100820UL, 0x00010084UL, 0x00004500UL, 0x00010082UL, 0x00040208UL, 0x00010080UL, 0x00010081UL, 
-0x00006040UL, 0x00040204UL, 0x00080030UL, 0x00620000UL, 0x00040201UL, 0x00040200UL, 0x00010088UL, 0x00040202UL, 
-0x00240100UL, 0x00402080UL, 0x00080028UL, 0x00008240UL, 0x00100440UL, 0x000a4000UL, 0x00010090UL, 0x00201800UL, 
-0x00080022UL, 0x00011400UL, 0x00080020UL, 0x00080021UL, 0x00408800UL, 0x00040210UL, 0x00080024UL, 0x00102100UL, 
-0x00000400UL, 0x00000401UL, 0x00000402UL, 0x00000403UL, 0x00000404UL, 0x00000405UL, 0x00000406UL, 0x00108200UL, 
-0x00000408UL, 0x00000409UL, 0x0000040aUL, 0x00002140UL, 0x0000040cUL, 0x004c0000UL, 0x00210800UL, 0x00001090UL, 
-0x00000410UL, 0x00000411UL, 0x00000412UL, 0x00244000UL, 0x00000414UL, 0x00000860UL, 0x000a0100UL, 0x00001088UL, 
-0x00000418UL, 0x00038000UL, 0x00400220UL, 0x00001084UL, 0x00106000UL, 0x00001082UL, 0x00001081UL, 0x00001080UL, 
-0x00000420UL, 0x00000421UL, 0x00000422UL, 0x00091000UL, 0x00000424UL, 0x00000850UL, 0x00042080UL, 0x00600100UL, 
-0x00000428UL, 0x00300080UL, 0x00400210UL, 0x00048800UL, 0x00009100UL, 0x00012200UL, 0x00180040UL, 0x00024400UL, 
-0x00000430UL, 0x00000844UL, 0x00400208UL, 0x00122000UL, 0x00000841UL, 0x00000840UL, 0x0001c000UL, 0x00000842UL, 
-0x00400202UL, 0x00084100UL, 0x00400200UL, 0x00400201UL, 0x00260000UL, 0x00000848UL, 0x00400204UL, 0x000010a0UL, 
-0x00000440UL, 0x00000441UL, 0x00000442UL, 0x00002108UL, 0x00000444UL, 0x00000830UL, 0x00405000UL, 0x00070000UL, 
-0x00000448UL, 0x00002102UL, 0x00002101UL, 0x00002100UL, 0x00020280UL, 0x0020c000UL, 0x00180020UL, 0x00002104UL, 
-0x00000450UL, 0x00000824UL, 0x00110080UL, 0x00488000UL, 0x00000821UL, 0x00000820UL, 0x00202200UL, 0x00000822UL, 
-0x00281000UL, 0x00140200UL, 0x00024800UL, 0x00002110UL, 0x00410100UL, 0x00000828UL, 0x00048400UL, 0x000010c0UL, 
-0x00000460UL, 0x00000814UL, 0x00228000UL, 0x00004280UL, 0x00000811UL, 0x00000810UL, 0x00180008UL, 0x00000812UL, 
-0x00054000UL, 0x00421000UL, 0x00180004UL, 0x00002120UL, 0x00180002UL, 0x00000818UL, 0x00180000UL, 0x00180001UL, 
-0x00000805UL, 0x00000804UL, 0x00041100UL, 0x00000806UL, 0x00000801UL, 0x00000800UL, 0x00000803UL, 0x00000802UL, 
-0x0000a080UL, 0x0000080cUL, 0x00400240UL, 0x00210400UL, 0x00000809UL, 0x00000808UL, 0x00180010UL, 0x0000080aUL, 
-0x00000480UL, 0x00000481UL, 0x00000482UL, 0x00420800UL, 0x00000484UL, 0x00014100UL, 0x00042020UL, 0x00001018UL, 
-0x00000488UL, 0x00300020UL, 0x0008c000UL, 0x00001014UL, 0x00020240UL, 0x00001012UL, 0x00001011UL, 0x00001010UL, 
-0x00000490UL, 0x00082200UL, 0x00110040UL, 0x0000100cUL, 0x00608000UL, 0x0000100aUL, 0x00001009UL, 0x00001008UL, 
-0x00040900UL, 0x00001006UL, 0x00001005UL, 0x00001004UL, 0x00001003UL, 0x00001002UL, 0x00001001UL, 0x00001000UL, 
-0x000004a0UL, 0x00300008UL, 0x00042004UL, 0x00004240UL, 0x00042002UL, 0x000a8000UL, 0x00042000UL, 0x00042001UL, 
-0x00300001UL, 0x00300000UL, 0x00030100UL, 0x00300002UL, 0x00404800UL, 0x00300004UL, 0x00042008UL, 0x00001030UL, 
-0x00025000UL, 0x00450000UL, 0x00280800UL, 0x00008500UL, 0x00100300UL, 0x000008c0UL, 0x00042010UL, 0x00001028UL, 
-0x0000a040UL, 0x00300010UL, 0x00400280UL, 0x00001024UL, 0x00090400UL, 0x00001022UL, 0x00001021UL, 0x00001020UL, 
-0x000004c0UL, 0x00049000UL, 0x00110010UL, 0x00004220UL, 0x00020208UL, 0x00502000UL, 0x00008900UL, 0x00280400UL, 
-0x00020204UL, 0x00090800UL, 0x00640000UL, 0x00002180UL, 0x00020200UL, 0x00020201UL, 0x00020202UL, 0x00001050UL, 
-0x00110002UL, 0x00220100UL, 0x00110000UL, 0x00110001UL, 0x000c4000UL, 0x000008a0UL, 0x00110004UL, 0x00001048UL, 
-0x0000a020UL, 0x00404400UL, 0x00110008UL, 0x00001044UL, 0x00020210UL, 0x00001042UL, 0x00001041UL, 0x00001040UL, 
-0x00480100UL, 0x00004202UL, 0x00004201UL, 0x00004200UL, 0x00211000UL, 0x00000890UL, 0x00042040UL, 0x00004204UL, 
-0x0000a010UL, 0x00300040UL, 0x00001c00UL, 0x00004208UL, 0x00020220UL, 0x00040500UL, 0x00180080UL, 0x00418000UL, 
-0x0000a008UL, 0x00000884UL, 0x00110020UL, 0x00004210UL, 0x00000881UL, 0x00000880UL, 0x00420400UL, 0x00000882UL, 
-0x0000a000UL, 0x0000a001UL, 0x0000a002UL, 0x000e0000UL, 0x0000a004UL, 0x00000888UL, 0x00204100UL, 0x00001060UL, 
-0x00000500UL, 0x00000501UL, 0x00000502UL, 0x00002048UL, 0x00000504UL, 0x00014080UL, 0x000a0010UL, 0x00600020UL, 
-0x00000508UL, 0x00002042UL, 0x00002041UL, 0x00002040UL, 0x00009020UL, 0x00120800UL, 0x00044200UL, 0x00002044UL, 
-0x00000510UL, 0x00501000UL, 0x000a0004UL, 0x00010a00UL, 0x000a0002UL, 0x0004a000UL, 0x000a0000UL, 0x000a0001UL, 
-0x00040880UL, 0x00084020UL, 0x00308000UL, 0x00002050UL, 0x00410040UL, 0x00200600UL, 0x000a0008UL, 0x00001180UL, 
-0x00000520UL, 0x00060200UL, 0x00104800UL, 0x00600004UL, 0x00009008UL, 0x00600002UL, 0x00600001UL, 0x00600000UL, 
-0x00009004UL, 0x00084010UL, 0x00030080UL, 0x00002060UL, 0x00009000UL, 0x00009001UL, 0x00009002UL, 0x00600008UL, 
-0x00212000UL, 0x00084008UL, 0x00041040UL, 0x00008480UL, 0x00100280UL, 0x00000940UL, 0x000a0020UL, 0x00600010UL, 
-0x00084001UL, 0x00084000UL, 0x00400300UL, 0x00084002UL, 0x00009010UL, 0x00084004UL, 0x00002c00UL, 0x00150000UL, 
-0x00000540UL, 0x0000200aUL, 0x00002009UL, 0x00002008UL, 0x00340000UL, 0x00081200UL, 0x00008880UL, 0x0000200cUL, 
-0x00002003UL, 0x00002002UL, 0x00002001UL, 0x00002000UL, 0x00410010UL, 0x00002006UL, 0x00002005UL, 0x00002004UL, 
-0x0000c200UL, 0x00220080UL, 0x00041020UL, 0x00002018UL, 0x00410008UL, 0x00000920UL, 0x000a0040UL, 0x00104400UL, 
-0x00410004UL, 0x00002012UL, 0x00002011UL, 0x00002010UL, 0x00410000UL, 0x00410001UL, 0x00410002UL, 0x00002014UL, 
-0x00480080UL, 0x00118000UL, 0x00041010UL, 0x00002028UL, 0x00026000UL, 0x00000910UL, 0x00010600UL, 0x00600040UL, 
-0x00200a00UL, 0x00002022UL, 0x00002021UL, 0x00002020UL, 0x00009040UL, 0x00040480UL, 0x00180100UL, 0x00002024UL, 
-0x00041002UL, 0x00000904UL, 0x00041000UL, 0x00041001UL, 0x00000901UL, 0x00000900UL, 0x00041004UL, 0x00000902UL, 
-0x00120400UL, 0x00084040UL, 0x00041008UL, 0x00002030UL, 0x00410020UL, 0x00000908UL, 0x00204080UL, 0x00028200UL, 
-0x00000580UL, 0x00014004UL, 0x00201200UL, 0x001c0000UL, 0x00014001UL, 0x00014000UL, 0x00008840UL, 0x00014002UL, 
-0x00040810UL, 0x00408200UL, 0x00030020UL, 0x000020c0UL, 0x00282000UL, 0x00014008UL, 0x00500400UL, 0x00001110UL, 
-0x00040808UL, 0x00220040UL, 0x00406000UL, 0x00008420UL, 0x00100220UL, 0x00014010UL, 0x000a0080UL, 0x00001108UL, 
-0x00040800UL, 0x00040801UL, 0x00040802UL, 0x00001104UL, 0x00040804UL, 0x00001102UL, 0x00001101UL, 0x00001100UL, 
-0x00480040UL, 0x00003800UL, 0x00030008UL, 0x00008410UL, 0x00100210UL, 0x00014020UL, 0x00042100UL, 0x00600080UL, 
-0x00030002UL, 0x00300100UL, 0x00030000UL, 0x00030001UL, 0x00009080UL, 0x00040440UL, 0x00030004UL, 0x00080a00UL, 
-0x00100204UL, 0x00008402UL, 0x00008401UL, 0x00008400UL, 0x00100200UL, 0x00100201UL, 0x00100202UL, 0x00008404UL, 
-0x00040820UL, 0x00084080UL, 0x00030010UL, 0x00008408UL, 0x00100208UL, 0x00422000UL, 0x00204040UL, 0x00001120UL, 
-0x00480020UL, 0x00220010UL, 0x00008804UL, 0x00002088UL, 0x00008802UL, 0x00014040UL, 0x00008800UL, 0x00008801UL, 
-0x00105000UL, 0x00002082UL, 0x00002081UL, 0x00002080UL, 0x00020300UL, 0x00040420UL, 0x00008808UL, 0x00002084UL, 
-0x00220001UL, 0x00220000UL, 0x00110100UL, 0x00220002UL, 0x00003400UL, 0x00220004UL, 0x00008810UL, 0x00440200UL, 
-0x00040840UL, 0x00220008UL, 0x00080600UL, 0x00002090UL, 0x00410080UL, 0x00188000UL, 0x00204020UL, 0x00001140UL, 
-0x00480000UL, 0x00480001UL, 0x00480002UL, 0x00004300UL, 0x00480004UL, 0x00040408UL, 0x00008820UL, 0x00121000UL, 
-0x00480008UL, 0x00040404UL, 0x00030040UL, 0x000020a0UL, 0x00040401UL, 0x00040400UL, 0x00204010UL, 0x00040402UL, 
-0x00480010UL, 0x00220020UL, 0x00041080UL, 0x00008440UL, 0x00100240UL, 0x00000980UL, 0x00204008UL, 0x00092000UL, 
-0x0000a100UL, 0x00011200UL, 0x00204004UL, 0x00500800UL, 0x00204002UL, 0x00040410UL, 0x00204000UL, 0x00204001UL, 
-0x00000600UL, 0x00000601UL, 0x00000602UL, 0x00108004UL, 0x00000604UL, 0x00108002UL, 0x00108001UL, 0x00108000UL, 
-0x00000608UL, 0x00005800UL, 0x00400030UL, 0x002a0000UL, 0x000200c0UL, 0x00012020UL, 0x00044100UL, 0x00108008UL, 
-0x00000610UL, 0x00082080UL, 0x00400028UL, 0x00010900UL, 0x00051000UL, 0x00424000UL, 0x00202040UL, 0x00108010UL, 
-0x00400022UL, 0x00140040UL, 0x00400020UL, 0x00400021UL, 0x00088800UL, 0x00200500UL, 0x00400024UL, 0x00001280UL, 
-0x00000620UL, 0x00060100UL, 0x00400018UL, 0x000040c0UL, 0x00284000UL, 0x00012008UL, 0x00021800UL, 0x00108020UL, 
-0x00400012UL, 0x00012004UL, 0x00400010UL, 0x00400011UL, 0x00012001UL, 0x00012000UL, 0x00400014UL, 0x00012002UL, 
-0x0040000aUL, 0x00209000UL, 0x00400008UL, 0x00400009UL, 0x00100180UL, 0x00000a40UL, 0x0040000cUL, 0x000c0400UL, 
-0x00400002UL, 0x00400003UL, 0x00400000UL, 0x00400001UL, 0x00400006UL, 0x00012010UL, 0x00400004UL, 0x00400005UL, 
-0x00000640UL, 0x00610000UL, 0x000c0800UL, 0x000040a0UL, 0x00020088UL, 0x00081100UL, 0x00202010UL, 0x00108040UL, 
-0x00020084UL, 0x00140010UL, 0x00019000UL, 0x00002300UL, 0x00020080UL, 0x00020081UL, 0x00020082UL, 0x00400c00UL, 
-0x0000c100UL, 0x00140008UL, 0x00202004UL, 0x00021400UL, 0x00202002UL, 0x00000a20UL, 0x00202000UL, 0x00202001UL, 
-0x00140001UL, 0x00140000UL, 0x00400060UL, 0x00140002UL, 0x00020090UL, 0x00140004UL, 0x00202008UL, 0x00094000UL, 
-0x00103000UL, 0x00004082UL, 0x00004081UL, 0x00004080UL, 0x00448000UL, 0x00000a10UL, 0x00010500UL, 0x00004084UL, 
-0x00200900UL, 0x00088400UL, 0x00400050UL, 0x00004088UL, 0x000200a0UL, 0x00012040UL, 0x00180200UL, 0x00241000UL, 
-0x000b0000UL, 0x00000a04UL, 0x00400048UL, 0x00004090UL, 0x00000a01UL, 0x00000a00UL, 0x00202020UL, 0x00000a02UL, 
-0x00400042UL, 0x00140020UL, 0x00400040UL, 0x00400041UL, 0x00005400UL, 0x00000a08UL, 0x00400044UL, 0x00028100UL, 
-0x00000680UL, 0x00082010UL, 0x00201100UL, 0x00004060UL, 0x00020048UL, 0x00240800UL, 0x00490000UL, 0x00108080UL, 
-0x00020044UL, 0x00408100UL, 0x00102800UL, 0x00050400UL, 0x00020040UL, 0x00020041UL, 0x00020042UL, 0x00001210UL, 
-0x00082001UL, 0x00082000UL, 0x00068000UL, 0x00082002UL, 0x00100120UL, 0x00082004UL, 0x00004c00UL, 0x00001208UL, 
-0x00214000UL, 0x00082008UL, 0x004000a0UL, 0x00001204UL, 0x00020050UL, 0x00001202UL, 0x00001201UL, 0x00001200UL, 
-0x00018800UL, 0x00004042UL, 0x00004041UL, 0x00004040UL, 0x00100110UL, 0x00401400UL, 0x00042200UL, 0x00004044UL, 
-0x000c1000UL, 0x00300200UL, 0x00400090UL, 0x00004048UL, 0x00020060UL, 0x00012080UL, 0x00208400UL, 0x00080900UL, 
-0x00100104UL, 0x00082020UL, 0x00400088UL, 0x00004050UL, 0x00100100UL, 0x00100101UL, 0x00100102UL, 0x00230000UL, 
-0x00400082UL, 0x00020c00UL, 0x00400080UL, 0x00400081UL, 0x00100108UL, 0x0004c000UL, 0x00400084UL, 0x00001220UL, 
-0x0002000cUL, 0x00004022UL, 0x00004021UL, 0x00004020UL, 0x00020008UL, 0x00020009UL, 0x0002000aUL, 0x00004024UL, 
-0x00020004UL, 0x00020005UL, 0x00020006UL, 0x00004028UL, 0x00020000UL, 0x00020001UL, 0x00020002UL, 0x00020003UL, 
-0x00401800UL, 0x00082040UL, 0x00110200UL, 0x00004030UL, 0x00020018UL, 0x00018400UL, 0x00202080UL, 0x00440100UL, 
-0x00020014UL, 0x00140080UL, 0x00080500UL, 0x00208800UL, 0x00020010UL, 0x00020011UL, 0x00020012UL, 0x00001240UL, 
-0x00004003UL, 0x00004002UL, 0x00004001UL, 0x00004000UL, 0x00020028UL, 0x00004006UL, 0x00004005UL, 0x00004004UL, 
-0x00020024UL, 0x0000400aUL, 0x00004009UL, 0x00004008UL, 0x00020020UL, 0x00020021UL, 0x00020022UL, 0x0000400cUL, 
-0x00240400UL, 0x00004012UL, 0x00004011UL, 0x00004010UL, 0x00100140UL, 0x00000a80UL, 0x00089000UL, 0x00004014UL, 
-0x0000a200UL, 0x00011100UL, 0x004000c0UL, 0x00004018UL, 0x00020030UL, 0x00680000UL, 0x00050800UL, 0x00102400UL, 
-0x00000700UL, 0x00060020UL, 0x00201080UL, 0x00010810UL, 0x00402800UL, 0x00081040UL, 0x00044008UL, 0x00108100UL, 
-0x00190000UL, 0x00408080UL, 0x00044004UL, 0x00002240UL, 0x00044002UL, 0x00200410UL, 0x00044000UL, 0x00044001UL, 
-0x0000c040UL, 0x00010802UL, 0x00010801UL, 0x00010800UL, 0x001000a0UL, 0x00200408UL, 0x000a0200UL, 0x00010804UL, 
-0x00023000UL, 0x00200404UL, 0x00400120UL, 0x00010808UL, 0x00200401UL, 0x00200400UL, 0x00044010UL, 0x00200402UL, 
-0x00060001UL, 0x00060000UL, 0x0008a000UL, 0x00060002UL, 0x00100090UL, 0x00060004UL, 0x00010440UL, 0x00600200UL, 
-0x00200840UL, 0x00060008UL, 0x00400110UL, 0x00101400UL, 0x00009200UL, 0x00012100UL, 0x00044020UL, 0x00080880UL, 
-0x00100084UL, 0x00060010UL, 0x00400108UL, 0x00010820UL, 0x00100080UL, 0x00100081UL, 0x00100082UL, 0x00007000UL, 
-0x00400102UL, 0x00084200UL, 0x00400100UL, 0x00400101UL, 0x00100088UL, 0x00200420UL, 0x00400104UL, 0x00028040UL, 
-0x0000c010UL, 0x00081004UL, 0x00520000UL, 0x00002208UL, 0x00081001UL, 0x00081000UL, 0x00010420UL, 0x00081002UL, 
-0x00200820UL, 0x00002202UL, 0x00002201UL, 0x00002200UL, 0x00020180UL, 0x00081008UL, 0x00044040UL, 0x00002204UL, 
-0x0000c000UL, 0x0000c001UL, 0x0000c002UL, 0x00010840UL, 0x0000c004UL, 0x00081010UL, 0x00202100UL, 0x00440080UL, 
-0x0000c008UL, 0x00140100UL, 0x00080480UL, 0x00002210UL, 0x00410200UL, 0x00200440UL, 0x00101800UL, 0x00028020UL, 
-0x00200808UL, 0x00060040UL, 0x00010404UL, 0x00004180UL, 0x00010402UL, 0x00081020UL, 0x00010400UL, 0x00010401UL, 
-0x00200800UL, 0x00200801UL, 0x00200802UL, 0x00002220UL, 0x00200804UL, 0x00504000UL, 0x00010408UL, 0x00028010UL, 
-0x0000c020UL, 0x00402400UL, 0x00041200UL, 0x00380000UL, 0x001000c0UL, 0x00000b00UL, 0x00010410UL, 0x00028008UL, 
-0x00200810UL, 0x00011080UL, 0x00400140UL, 0x00028004UL, 0x000c2000UL, 0x00028002UL, 0x00028001UL, 0x00028000UL, 
-0x00201002UL, 0x00408008UL, 0x00201000UL, 0x00201001UL, 0x00100030UL, 0x00014200UL, 0x00201004UL, 0x00022400UL, 
-0x00408001UL, 0x00408000UL, 0x00201008UL, 0x00408002UL, 0x00020140UL, 0x00408004UL, 0x00044080UL, 0x00080820UL, 
-0x00100024UL, 0x00082100UL, 0x00201010UL, 0x00010880UL, 0x00100020UL, 0x00100021UL, 0x00100022UL, 0x00440040UL, 
-0x00040a00UL, 0x00408010UL, 0x00080440UL, 0x00124000UL, 0x00100028UL, 0x00200480UL, 0x0001a000UL, 0x00001300UL, 
-0x00100014UL, 0x00060080UL, 0x00201020UL, 0x00004140UL, 0x00100010UL, 0x00100011UL, 0x00100012UL, 0x00080808UL, 
-0x00006400UL, 0x00408020UL, 0x00030200UL, 0x00080804UL, 0x00100018UL, 0x00080802UL, 0x00080801UL, 0x00080800UL, 
-0x00100004UL, 0x00100005UL, 0x00100006UL, 0x00008600UL, 0x00100000UL, 0x00100001UL, 0x00100002UL, 0x00100003UL, 
-0x0010000cUL, 0x00011040UL, 0x00400180UL, 0x00242000UL, 0x00100008UL, 0x00100009UL, 0x0010000aUL, 0x00080810UL, 
-0x00052000UL, 0x00100c00UL, 0x00201040UL, 0x00004120UL, 0x00020108UL, 0x00081080UL, 0x00008a00UL, 0x00440010UL, 
-0x00020104UL, 0x00408040UL, 0x00080410UL, 0x00002280UL, 0x00020100UL, 0x00020101UL, 0x00020102UL, 0x00310000UL, 
-0x0000c080UL, 0x00220200UL, 0x00080408UL, 0x00440004UL, 0x00100060UL, 0x00440002UL, 0x00440001UL, 0x00440000UL, 
-0x00080402UL, 0x00011020UL, 0x00080400UL, 0x00080401UL, 0x00020110UL, 0x00006800UL, 0x00080404UL, 0x00440008UL, 
-0x00480200UL, 0x00004102UL, 0x00004101UL, 0x00004100UL, 0x00100050UL, 0x0020a000UL, 0x00010480UL, 0x00004104UL, 
-0x00200880UL, 0x00011010UL, 0x00148000UL, 0x00004108UL, 0x00020120UL, 0x00040600UL, 0x00403000UL, 0x00080840UL, 
-0x00100044UL, 0x00011008UL, 0x00022800UL, 0x00004110UL, 0x00100040UL, 0x00100041UL, 0x00100042UL, 0x00440020UL, 
-0x00011001UL, 0x00011000UL, 0x00080420UL, 0x00011002UL, 0x00100048UL, 0x00011004UL, 0x00204200UL, 0x00028080UL, 
+static const __code uint16_t golay23_decode[2048] = {
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0048,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0824,
+0x0000, 0x0000, 0x0000, 0x0301, 0x0000, 0x0400, 0x0090, 0x0002,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0048,
+0x0000, 0x0000, 0x0000, 0x0048, 0x0000, 0x0048, 0x0048, 0x0048,
+0x0000, 0x0000, 0x0000, 0x0010, 0x0000, 0x0001, 0x0602, 0x0180,
+0x0000, 0x0086, 0x0800, 0x0420, 0x0120, 0x0a10, 0x0005, 0x0048,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0500,
+0x0000, 0x0000, 0x0000, 0x0004, 0x0000, 0x0222, 0x0090, 0x0801,
+0x0000, 0x0000, 0x0000, 0x0042, 0x0000, 0x0001, 0x0090, 0x0208,
+0x0000, 0x0808, 0x0090, 0x0420, 0x0090, 0x0144, 0x0090, 0x0090,
+0x0000, 0x0000, 0x0000, 0x0a80, 0x0000, 0x0001, 0x0020, 0x0016,
+0x0000, 0x0110, 0x0003, 0x0420, 0x0c04, 0x0080, 0x0300, 0x0048,
+0x0000, 0x0001, 0x010c, 0x0420, 0x0001, 0x0001, 0x0840, 0x0001,
+0x0240, 0x0420, 0x0420, 0x0420, 0x000a, 0x0001, 0x0090, 0x0420,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0500,
+0x0000, 0x0000, 0x0000, 0x00a0, 0x0000, 0x0015, 0x0a00, 0x0002,
+0x0000, 0x0000, 0x0000, 0x0010, 0x0000, 0x02c0, 0x0009, 0x0002,
+0x0000, 0x0808, 0x0444, 0x0002, 0x0120, 0x0002, 0x0002, 0x0002,
+0x0000, 0x0000, 0x0000, 0x0010, 0x0000, 0x0802, 0x0084, 0x0221,
+0x0000, 0x0600, 0x0003, 0x0904, 0x0120, 0x0080, 0x0410, 0x0048,
+0x0000, 0x0010, 0x0010, 0x0010, 0x0120, 0x040c, 0x0840, 0x0010,
+0x0120, 0x0041, 0x0288, 0x0010, 0x0120, 0x0120, 0x0120, 0x0002,
+0x0000, 0x0000, 0x0000, 0x0500, 0x0000, 0x0500, 0x0500, 0x0500,
+0x0000, 0x0808, 0x0003, 0x0250, 0x0040, 0x0080, 0x002c, 0x0500,
+0x0000, 0x0808, 0x0220, 0x0085, 0x0006, 0x0030, 0x0840, 0x0500,
+0x0808, 0x0808, 0x0100, 0x0808, 0x0601, 0x0808, 0x0090, 0x0002,
+0x0000, 0x0064, 0x0003, 0x0008, 0x0218, 0x0080, 0x0840, 0x0500,
+0x0003, 0x0080, 0x0003, 0x0003, 0x0080, 0x0080, 0x0003, 0x0080,
+0x0480, 0x0302, 0x0840, 0x0010, 0x0840, 0x0001, 0x0840, 0x0840,
+0x0014, 0x0808, 0x0003, 0x0420, 0x0120, 0x0080, 0x0840, 0x0204,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0083,
+0x0000, 0x0000, 0x0000, 0x0004, 0x0000, 0x0400, 0x0a00, 0x0130,
+0x0000, 0x0000, 0x0000, 0x0010, 0x0000, 0x0400, 0x0140, 0x0208,
+0x0000, 0x0400, 0x002a, 0x08c0, 0x0400, 0x0400, 0x0005, 0x0400,
+0x0000, 0x0000, 0x0000, 0x0010, 0x0000, 0x0304, 0x0020, 0x0c00,
+0x0000, 0x0821, 0x0580, 0x0202, 0x0012, 0x0080, 0x0005, 0x0048,
+0x0000, 0x0010, 0x0010, 0x0010, 0x0888, 0x0062, 0x0005, 0x0010,
+0x0240, 0x0108, 0x0005, 0x0010, 0x0005, 0x0400, 0x0005, 0x0005,
+0x0000, 0x0000, 0x0000, 0x0004, 0x0000, 0x0850, 0x0020, 0x0208,
+0x0000, 0x0004, 0x0004, 0x0004, 0x0109, 0x0080, 0x0442, 0x0004,
+0x0000, 0x01a0, 0x0c01, 0x0208, 0x0006, 0x0208, 0x0208, 0x0208,
+0x0240, 0x0013, 0x0100, 0x0004, 0x0820, 0x0400, 0x0090, 0x0208,
+0x0000, 0x040a, 0x0020, 0x0141, 0x0020, 0x0080, 0x0020, 0x0020,
+0x0240, 0x0080, 0x0818, 0x0004, 0x0080, 0x0080, 0x0020, 0x0080,
+0x0240, 0x0804, 0x0082, 0x0010, 0x0510, 0x0001, 0x0020, 0x0208,
+0x0240, 0x0240, 0x0240, 0x0420, 0x0240, 0x0080, 0x0005, 0x0902,
+0x0000, 0x0000, 0x0000, 0x0010, 0x0000, 0x0028, 0x0a00, 0x0044,
+0x0000, 0x0142, 0x0a00, 0x0409, 0x0a00, 0x0080, 0x0a00, 0x0a00,
+0x0000, 0x0010, 0x0010, 0x0010, 0x0006, 0x0901, 0x04a0, 0x0010,
+0x0081, 0x0224, 0x0100, 0x0010, 0x0058, 0x0400, 0x0a00, 0x0002,
+0x0000, 0x0010, 0x0010, 0x0010, 0x0441, 0x0080, 0x010a, 0x0010,
+0x000c, 0x0080, 0x0060, 0x0010, 0x0080, 0x0080, 0x0a00, 0x0080,
+0x0010, 0x0010, 0x0010, 0x0010, 0x0200, 0x0010, 0x0010, 0x0010,
+0x0c02, 0x0010, 0x0010, 0x0010, 0x0120, 0x0080, 0x0005, 0x0010,
+0x0000, 0x0201, 0x00c8, 0x0822, 0x0006, 0x0080, 0x0011, 0x0500,
+0x0430, 0x0080, 0x0100, 0x0004, 0x0080, 0x0080, 0x0a00, 0x0080,
+0x0006, 0x0440, 0x0100, 0x0010, 0x0006, 0x0006, 0x0006, 0x0208,
+0x0100, 0x0808, 0x0100, 0x0100, 0x0006, 0x0080, 0x0100, 0x0061,
+0x0900, 0x0080, 0x0604, 0x0010, 0x0080, 0x0080, 0x0020, 0x0080,
+0x0080, 0x0080, 0x0003, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+0x0029, 0x0010, 0x0010, 0x0010, 0x0006, 0x0080, 0x0840, 0x0010,
+0x0240, 0x0080, 0x0100, 0x0010, 0x0080, 0x0080, 0x0408, 0x0080,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0210,
+0x0000, 0x0000, 0x0000, 0x00a0, 0x0000, 0x0400, 0x0106, 0x0801,
+0x0000, 0x0000, 0x0000, 0x0042, 0x0000, 0x0400, 0x0009, 0x0180,
+0x0000, 0x0400, 0x0800, 0x001c, 0x0400, 0x0400, 0x0260, 0x0400,
+0x0000, 0x0000, 0x0000, 0x0405, 0x0000, 0x0802, 0x0020, 0x0180,
+0x0000, 0x0110, 0x0800, 0x0202, 0x0281, 0x0024, 0x0410, 0x0048,
+0x0000, 0x0228, 0x0800, 0x0180, 0x0054, 0x0180, 0x0180, 0x0180,
+0x0800, 0x0041, 0x0800, 0x0800, 0x000a, 0x0400, 0x0800, 0x0180,
+0x0000, 0x0000, 0x0000, 0x0042, 0x0000, 0x008c, 0x0020, 0x0801,
+0x0000, 0x0110, 0x0608, 0x0801, 0x0040, 0x0801, 0x0801, 0x0801,
+0x0000, 0x0042, 0x0042, 0x0042, 0x0b00, 0x0030, 0x0404, 0x0042,
+0x0025, 0x0280, 0x0100, 0x0042, 0x000a, 0x0400, 0x0090, 0x0801,
+0x0000, 0x0110, 0x0020, 0x0008, 0x0020, 0x0640, 0x0020, 0x0020,
+0x0110, 0x0110, 0x00c4, 0x0110, 0x000a, 0x0110, 0x0020, 0x0801,
+0x0480, 0x0804, 0x0211, 0x0042, 0x000a, 0x0001, 0x0020, 0x0180,
+0x000a, 0x0110, 0x0800, 0x0420, 0x000a, 0x000a, 0x000a, 0x0204,
+0x0000, 0x0000, 0x0000, 0x00a0, 0x0000, 0x0802, 0x0009, 0x0044,
+0x0000, 0x00a0, 0x00a0, 0x00a0, 0x0040, 0x0308, 0x0410, 0x00a0,
+0x0000, 0x0104, 0x0009, 0x0e00, 0x0009, 0x0030, 0x0009, 0x0009,
+0x0212, 0x0041, 0x0100, 0x00a0, 0x0884, 0x0400, 0x0009, 0x0002,
+0x0000, 0x0802, 0x0340, 0x0008, 0x0802, 0x0802, 0x0410, 0x0802,
+0x000c, 0x0041, 0x0410, 0x00a0, 0x0410, 0x0802, 0x0410, 0x0410,
+0x0480, 0x0041, 0x0026, 0x0010, 0x0200, 0x0802, 0x0009, 0x0180,
+0x0041, 0x0041, 0x0800, 0x0041, 0x0120, 0x0041, 0x0410, 0x0204,
+0x0000, 0x0201, 0x0814, 0x0008, 0x0040, 0x0030, 0x0282, 0x0500,
+0x0040, 0x0406, 0x0100, 0x00a0, 0x0040, 0x0040, 0x0040, 0x0801,
+0x0480, 0x0030, 0x0100, 0x0042, 0x0030, 0x0030, 0x0009, 0x0030,
+0x0100, 0x0808, 0x0100, 0x0100, 0x0040, 0x0030, 0x0100, 0x0204,
+0x0480, 0x0008, 0x0008, 0x0008, 0x0105, 0x0802, 0x0020, 0x0008,
+0x0a20, 0x0110, 0x0003, 0x0008, 0x0040, 0x0080, 0x0410, 0x0204,
+0x0480, 0x0480, 0x0480, 0x0008, 0x0480, 0x0030, 0x0840, 0x0204,
+0x0480, 0x0041, 0x0100, 0x0204, 0x000a, 0x0204, 0x0204, 0x0204,
+0x0000, 0x0000, 0x0000, 0x0908, 0x0000, 0x0400, 0x0020, 0x0044,
+0x0000, 0x0400, 0x0051, 0x0202, 0x0400, 0x0400, 0x0088, 0x0400,
+0x0000, 0x0400, 0x0284, 0x0021, 0x0400, 0x0400, 0x0812, 0x0400,
+0x0400, 0x0400, 0x0100, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400,
+0x0000, 0x00c0, 0x0020, 0x0202, 0x0020, 0x0019, 0x0020, 0x0020,
+0x000c, 0x0202, 0x0202, 0x0202, 0x0940, 0x0400, 0x0020, 0x0202,
+0x0103, 0x0804, 0x0448, 0x0010, 0x0200, 0x0400, 0x0020, 0x0180,
+0x00b0, 0x0400, 0x0800, 0x0202, 0x0400, 0x0400, 0x0005, 0x0400,
+0x0000, 0x0201, 0x0020, 0x0490, 0x0020, 0x0102, 0x0020, 0x0020,
+0x0882, 0x0068, 0x0100, 0x0004, 0x0214, 0x0400, 0x0020, 0x0801,
+0x0018, 0x0804, 0x0100, 0x0042, 0x00c1, 0x0400, 0x0020, 0x0208,
+0x0100, 0x0400, 0x0100, 0x0100, 0x0400, 0x0400, 0x0100, 0x0400,
+0x0020, 0x0804, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0401, 0x0110, 0x0020, 0x0202, 0x0020, 0x0080, 0x0020, 0x0020,
+0x0804, 0x0804, 0x0020, 0x0804, 0x0020, 0x0804, 0x0020, 0x0020,
+0x0240, 0x0804, 0x0100, 0x0089, 0x000a, 0x0400, 0x0020, 0x0050,
+0x0000, 0x0201, 0x0402, 0x0044, 0x0190, 0x0044, 0x0044, 0x0044,
+0x000c, 0x0810, 0x0100, 0x00a0, 0x0023, 0x0400, 0x0a00, 0x0044,
+0x0860, 0x008a, 0x0100, 0x0010, 0x0200, 0x0400, 0x0009, 0x0044,
+0x0100, 0x0400, 0x0100, 0x0100, 0x0400, 0x0400, 0x0100, 0x0400,
+0x000c, 0x0520, 0x0881, 0x0010, 0x0200, 0x0802, 0x0020, 0x0044,
+0x000c, 0x000c, 0x000c, 0x0202, 0x000c, 0x0080, 0x0410, 0x0101,
+0x0200, 0x0010, 0x0010, 0x0010, 0x0200, 0x0200, 0x0200, 0x0010,
+0x000c, 0x0041, 0x0100, 0x0010, 0x0200, 0x0400, 0x00c2, 0x0828,
+0x0201, 0x0201, 0x0100, 0x0201, 0x0c08, 0x0201, 0x0020, 0x0044,
+0x0100, 0x0201, 0x0100, 0x0100, 0x0040, 0x0080, 0x0100, 0x001a,
+0x0100, 0x0201, 0x0100, 0x0100, 0x0006, 0x0030, 0x0100, 0x0880,
+0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0400, 0x0100, 0x0100,
+0x0052, 0x0201, 0x0020, 0x0008, 0x0020, 0x0080, 0x0020, 0x0020,
+0x000c, 0x0080, 0x0100, 0x0c40, 0x0080, 0x0080, 0x0020, 0x0080,
+0x0480, 0x0804, 0x0100, 0x0010, 0x0200, 0x0148, 0x0020, 0x0403,
+0x0100, 0x0022, 0x0100, 0x0100, 0x0811, 0x0080, 0x0100, 0x0204,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0210,
+0x0000, 0x0000, 0x0000, 0x0004, 0x0000, 0x0980, 0x0421, 0x0002,
+0x0000, 0x0000, 0x0000, 0x0488, 0x0000, 0x0001, 0x0140, 0x0002,
+0x0000, 0x0070, 0x0800, 0x0002, 0x020c, 0x0002, 0x0002, 0x0002,
+0x0000, 0x0000, 0x0000, 0x0122, 0x0000, 0x0001, 0x0084, 0x0c00,
+0x0000, 0x0600, 0x0800, 0x0091, 0x0012, 0x0024, 0x0300, 0x0048,
+0x0000, 0x0001, 0x0800, 0x0244, 0x0001, 0x0001, 0x0038, 0x0001,
+0x0800, 0x0108, 0x0800, 0x0800, 0x04c0, 0x0001, 0x0800, 0x0002,
+0x0000, 0x0000, 0x0000, 0x0004, 0x0000, 0x0001, 0x080a, 0x00e0,
+0x0000, 0x0004, 0x0004, 0x0004, 0x0040, 0x0418, 0x0300, 0x0004,
+0x0000, 0x0001, 0x0220, 0x0910, 0x0001, 0x0001, 0x0404, 0x0001,
+0x0502, 0x0280, 0x0049, 0x0004, 0x0820, 0x0001, 0x0090, 0x0002,
+0x0000, 0x0001, 0x0450, 0x0008, 0x0001, 0x0001, 0x0300, 0x0001,
+0x00a8, 0x0842, 0x0300, 0x0004, 0x0300, 0x0001, 0x0300, 0x0300,
+0x0001, 0x0001, 0x0082, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+0x0014, 0x0001, 0x0800, 0x0420, 0x0001, 0x0001, 0x0300, 0x0001,
+0x0000, 0x0000, 0x0000, 0x0841, 0x0000, 0x0028, 0x0084, 0x0002,
+0x0000, 0x0600, 0x0118, 0x0002, 0x0040, 0x0002, 0x0002, 0x0002,
+0x0000, 0x0104, 0x0220, 0x0002, 0x0c10, 0x0002, 0x0002, 0x0002,
+0x0081, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+0x0000, 0x0600, 0x0084, 0x0008, 0x0084, 0x0150, 0x0084, 0x0084,
+0x0600, 0x0600, 0x0060, 0x0600, 0x0809, 0x0600, 0x0084, 0x0002,
+0x004a, 0x08a0, 0x0501, 0x0010, 0x0200, 0x0001, 0x0084, 0x0002,
+0x0014, 0x0600, 0x0800, 0x0002, 0x0120, 0x0002, 0x0002, 0x0002,
+0x0000, 0x0092, 0x0220, 0x0008, 0x0040, 0x0a04, 0x0011, 0x0500,
+0x0040, 0x0121, 0x0c80, 0x0004, 0x0040, 0x0040, 0x0040, 0x0002,
+0x0220, 0x0440, 0x0220, 0x0220, 0x0188, 0x0001, 0x0220, 0x0002,
+0x0014, 0x0808, 0x0220, 0x0002, 0x0040, 0x0002, 0x0002, 0x0002,
+0x0900, 0x0008, 0x0008, 0x0008, 0x0422, 0x0001, 0x0084, 0x0008,
+0x0014, 0x0600, 0x0003, 0x0008, 0x0040, 0x0080, 0x0300, 0x0830,
+0x0014, 0x0001, 0x0220, 0x0008, 0x0001, 0x0001, 0x0840, 0x0001,
+0x0014, 0x0014, 0x0014, 0x01c0, 0x0014, 0x0001, 0x0408, 0x0002,
+0x0000, 0x0000, 0x0000, 0x0004, 0x0000, 0x0028, 0x0140, 0x0c00,
+0x0000, 0x0004, 0x0004, 0x0004, 0x0012, 0x0241, 0x0088, 0x0004,
+0x0000, 0x0a02, 0x0140, 0x0021, 0x0140, 0x0094, 0x0140, 0x0140,
+0x0081, 0x0108, 0x0610, 0x0004, 0x0820, 0x0400, 0x0140, 0x0002,
+0x0000, 0x00c0, 0x0209, 0x0c00, 0x0012, 0x0c00, 0x0c00, 0x0c00,
+0x0012, 0x0108, 0x0060, 0x0004, 0x0012, 0x0012, 0x0012, 0x0c00,
+0x0424, 0x0108, 0x0082, 0x0010, 0x0200, 0x0001, 0x0140, 0x0c00,
+0x0108, 0x0108, 0x0800, 0x0108, 0x0012, 0x0108, 0x0005, 0x02a0,
+0x0000, 0x0004, 0x0004, 0x0004, 0x0680, 0x0102, 0x0011, 0x0004,
+0x0004, 0x0004, 0x0004, 0x0004, 0x0820, 0x0004, 0x0004, 0x0004,
+0x0018, 0x0440, 0x0082, 0x0004, 0x0820, 0x0001, 0x0140, 0x0208,
+0x0820, 0x0004, 0x0004, 0x0004, 0x0820, 0x0820, 0x0820, 0x0004,
+0x0900, 0x0230, 0x0082, 0x0004, 0x004c, 0x0001, 0x0020, 0x0c00,
+0x0401, 0x0004, 0x0004, 0x0004, 0x0012, 0x0080, 0x0300, 0x0004,
+0x0082, 0x0001, 0x0082, 0x0082, 0x0001, 0x0001, 0x0082, 0x0001,
+0x0240, 0x0108, 0x0082, 0x0004, 0x0820, 0x0001, 0x0408, 0x0050,
+0x0000, 0x0028, 0x0402, 0x0380, 0x0028, 0x0028, 0x0011, 0x0028,
+0x0081, 0x0810, 0x0060, 0x0004, 0x0504, 0x0028, 0x0a00, 0x0002,
+0x0081, 0x0440, 0x080c, 0x0010, 0x0200, 0x0028, 0x0140, 0x0002,
+0x0081, 0x0081, 0x0081, 0x0002, 0x0081, 0x0002, 0x0002, 0x0002,
+0x0900, 0x0007, 0x0060, 0x0010, 0x0200, 0x0028, 0x0084, 0x0c00,
+0x0060, 0x0600, 0x0060, 0x0060, 0x0012, 0x0080, 0x0060, 0x0101,
+0x0200, 0x0010, 0x0010, 0x0010, 0x0200, 0x0200, 0x0200, 0x0010,
+0x0081, 0x0108, 0x0060, 0x0010, 0x0200, 0x0844, 0x0408, 0x0002,
+0x0900, 0x0440, 0x0011, 0x0004, 0x0011, 0x0028, 0x0011, 0x0011,
+0x020a, 0x0004, 0x0004, 0x0004, 0x0040, 0x0080, 0x0011, 0x0004,
+0x0440, 0x0440, 0x0220, 0x0440, 0x0006, 0x0440, 0x0011, 0x0880,
+0x0081, 0x0440, 0x0100, 0x0004, 0x0820, 0x0310, 0x0408, 0x0002,
+0x0900, 0x0900, 0x0900, 0x0008, 0x0900, 0x0080, 0x0011, 0x0242,
+0x0900, 0x0080, 0x0060, 0x0004, 0x0080, 0x0080, 0x0408, 0x0080,
+0x0900, 0x0440, 0x0082, 0x0010, 0x0200, 0x0001, 0x0408, 0x0124,
+0x0014, 0x0022, 0x0408, 0x0a01, 0x0408, 0x0080, 0x0408, 0x0408,
+0x0000, 0x0000, 0x0000, 0x0210, 0x0000, 0x0210, 0x0210, 0x0210,
+0x0000, 0x000b, 0x0800, 0x0540, 0x0040, 0x0024, 0x0088, 0x0210,
+0x0000, 0x0104, 0x0800, 0x0021, 0x00a2, 0x0848, 0x0404, 0x0210,
+0x0800, 0x0280, 0x0800, 0x0800, 0x0111, 0x0400, 0x0800, 0x0002,
+0x0000, 0x00c0, 0x0800, 0x0008, 0x0508, 0x0024, 0x0043, 0x0210,
+0x0800, 0x0024, 0x0800, 0x0800, 0x0024, 0x0024, 0x0800, 0x0024,
+0x0800, 0x0412, 0x0800, 0x0800, 0x0200, 0x0001, 0x0800, 0x0180,
+0x0800, 0x0800, 0x0800, 0x0800, 0x0800, 0x0024, 0x0800, 0x0800,
+0x0000, 0x0c20, 0x0181, 0x0008, 0x0040, 0x0102, 0x0404, 0x0210,
+0x0040, 0x0280, 0x0032, 0x0004, 0x0040, 0x0040, 0x0040, 0x0801,
+0x0018, 0x0280, 0x0404, 0x0042, 0x0404, 0x0001, 0x0404, 0x0404,
+0x0280, 0x0280, 0x0800, 0x0280, 0x0040, 0x0280, 0x0404, 0x0128,
+0x0206, 0x0008, 0x0008, 0x0008, 0x0890, 0x0001, 0x0020, 0x0008,
+0x0401, 0x0110, 0x0800, 0x0008, 0x0040, 0x0024, 0x0300, 0x0482,
+0x0160, 0x0001, 0x0800, 0x0008, 0x0001, 0x0001, 0x0404, 0x0001,
+0x0800, 0x0280, 0x0800, 0x0800, 0x000a, 0x0001, 0x0800, 0x0050,
+0x0000, 0x0104, 0x0402, 0x0008, 0x0040, 0x0481, 0x0920, 0x0210,
+0x0040, 0x0810, 0x0205, 0x00a0, 0x0040, 0x0040, 0x0040, 0x0002,
+0x0104, 0x0104, 0x00d0, 0x0104, 0x0200, 0x0104, 0x0009, 0x0002,
+0x0428, 0x0104, 0x0800, 0x0002, 0x0040, 0x0002, 0x0002, 0x0002,
+0x0031, 0x0008, 0x0008, 0x0008, 0x0200, 0x0802, 0x0084, 0x0008,
+0x0182, 0x0600, 0x0800, 0x0008, 0x0040, 0x0024, 0x0410, 0x0101,
+0x0200, 0x0104, 0x0800, 0x0008, 0x0200, 0x0200, 0x0200, 0x0460,
+0x0800, 0x0041, 0x0800, 0x0800, 0x0200, 0x0098, 0x0800, 0x0002,
+0x0040, 0x0008, 0x0008, 0x0008, 0x0040, 0x0040, 0x0040, 0x0008,
+0x0040, 0x0040, 0x0040, 0x0008, 0x0040, 0x0040, 0x0040, 0x0040,
+0x0803, 0x0104, 0x0220, 0x0008, 0x0040, 0x0030, 0x0404, 0x0880,
+0x0040, 0x0280, 0x0100, 0x0411, 0x0040, 0x0040, 0x0040, 0x0002,
+0x0008, 0x0008, 0x0008, 0x0008, 0x0040, 0x0008, 0x0008, 0x0008,
+0x0040, 0x0008, 0x0008, 0x0008, 0x0040, 0x0040, 0x0040, 0x0008,
+0x0480, 0x0008, 0x0008, 0x0008, 0x0200, 0x0001, 0x0112, 0x0008,
+0x0014, 0x0022, 0x0800, 0x0008, 0x0040, 0x0d00, 0x00a1, 0x0204,
+0x0000, 0x00c0, 0x0402, 0x0021, 0x0805, 0x0102, 0x0088, 0x0210,
+0x0320, 0x0810, 0x0088, 0x0004, 0x0088, 0x0400, 0x0088, 0x0088,
+0x0018, 0x0021, 0x0021, 0x0021, 0x0200, 0x0400, 0x0140, 0x0021,
+0x0046, 0x0400, 0x0800, 0x0021, 0x0400, 0x0400, 0x0088, 0x0400,
+0x00c0, 0x00c0, 0x0114, 0x00c0, 0x0200, 0x00c0, 0x0020, 0x0c00,
+0x0401, 0x00c0, 0x0800, 0x0202, 0x0012, 0x0024, 0x0088, 0x0101,
+0x0200, 0x00c0, 0x0800, 0x0021, 0x0200, 0x0200, 0x0200, 0x000e,
+0x0800, 0x0108, 0x0800, 0x0800, 0x0200, 0x0400, 0x0800, 0x0050,
+0x0018, 0x0102, 0x0a40, 0x0004, 0x0102, 0x0102, 0x0020, 0x0102,
+0x0401, 0x0004, 0x0004, 0x0004, 0x0040, 0x0102, 0x0088, 0x0004,
+0x0018, 0x0018, 0x0018, 0x0021, 0x0018, 0x0102, 0x0404, 0x0880,
+0x0018, 0x0280, 0x0100, 0x0004, 0x0820, 0x0400, 0x0203, 0x0050,
+0x0401, 0x00c0, 0x0020, 0x0008, 0x0020, 0x0102, 0x0020, 0x0020,
+0x0401, 0x0401, 0x0401, 0x0004, 0x0401, 0x0a08, 0x0020, 0x0050,
+0x0018, 0x0804, 0x0082, 0x0700, 0x0200, 0x0001, 0x0020, 0x0050,
+0x0401, 0x0022, 0x0800, 0x0050, 0x0184, 0x0050, 0x0050, 0x0050,
+0x0402, 0x0810, 0x0402, 0x0402, 0x0200, 0x0028, 0x0402, 0x0044,
+0x0810, 0x0810, 0x0402, 0x0810, 0x0040, 0x0810, 0x0088, 0x0101,
+0x0200, 0x0104, 0x0402, 0x0021, 0x0200, 0x0200, 0x0200, 0x0880,
+0x0081, 0x0810, 0x0100, 0x0248, 0x0200, 0x0400, 0x0034, 0x0002,
+0x0200, 0x00c0, 0x0402, 0x0008, 0x0200, 0x0200, 0x0200, 0x0101,
+0x000c, 0x0810, 0x0060, 0x0101, 0x0200, 0x0101, 0x0101, 0x0101,
+0x0200, 0x0200, 0x0200, 0x0010, 0x0200, 0x0200, 0x0200, 0x0200,
+0x0200, 0x0022, 0x0800, 0x0484, 0x0200, 0x0200, 0x0200, 0x0101,
+0x00a4, 0x0201, 0x0402, 0x0008, 0x0040, 0x0102, 0x0011, 0x0880,
+0x0040, 0x0810, 0x0100, 0x0004, 0x0040, 0x0040, 0x0040, 0x0620,
+0x0018, 0x0440, 0x0100, 0x0880, 0x0200, 0x0880, 0x0880, 0x0880,
+0x0100, 0x0022, 0x0100, 0x0100, 0x0040, 0x000d, 0x0100, 0x0880,
+0x0900, 0x0008, 0x0008, 0x0008, 0x0200, 0x0414, 0x0020, 0x0008,
+0x0401, 0x0022, 0x0290, 0x0008, 0x0040, 0x0080, 0x0806, 0x0101,
+0x0200, 0x0022, 0x0045, 0x0008, 0x0200, 0x0200, 0x0200, 0x0880,
+0x0022, 0x0022, 0x0100, 0x0022, 0x0200, 0x0022, 0x0408, 0x0050,
 };
-
@@ -0,0 +1,114 @@
+// -*- Mode: C; c-basic-offset: 8; -*-
+//
+// Copyright (c) 2014 SiK Multipoint Developers, All Rights Reserved
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+//  o Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  o Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in
+//    the documentation and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+// INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+// OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+///
+/// @file	links.c
+///
+/// Statistics for the links to the other nodes in the network
+///
+
+#include "radio.h"
+#include "links.h"
+
+__xdata struct link links[MAX_LINKS];
+struct statistics statistics[MAX_LINKS], remote_statistics[MAX_LINKS];
+__pdata uint8_t link_noise;
+
+uint8_t
+link_find(__pdata uint16_t node)
+{
+	__pdata uint8_t i;
+
+	for (i = 0; i < MAX_LINKS; i++) {
+		if (links[i].node == node) {
+			return i;
+		}
+	}
+	return LINK_NONE;
+}
+
+uint8_t
+link_heard(__pdata uint16_t node)
+{
+	__pdata uint8_t i, oldest = LINK_NONE;
+
+	for (i = 0; i < MAX_LINKS; i++) {
+		if (links[i].node == node) {
+			links[i].age = 0;
+			return i;
+		}
+		// free entries are the oldest of all
+		if (links[i].age >= LINK_STALE &&
+		    (oldest == LINK_NONE || links[i].age > links[oldest].age)) {
+			oldest = i;
+		}
+	}
+	if (oldest != LINK_NONE) {
+		memset(&links[oldest], 0, sizeof(links[oldest]));
+		memset(&statistics[oldest], 0, sizeof(statistics[oldest]));
+		memset(&remote_statistics[oldest], 0, sizeof(remote_statistics[oldest]));
+		links[oldest].node = node;
+	}
+	return oldest;
+}
+
+void
+links_age(void)
+{
+	__pdata uint8_t i;
+
+	for (i = 0; i < MAX_LINKS; i++) {
+		if (links[i].node != LINK_FREE && links[i].age < 0xFE) {
+			links[i].age++;
+		}
+	}
+}
+
+void
+links_clear_flag(__pdata uint8_t flag)
+{
+	__pdata uint8_t i;
+
+	for (i = 0; i < MAX_LINKS; i++) {
+		links[i].flags &= ~flag;
+	}
+}
+
+void
+links_reset(void)
+{
+	__pdata uint8_t i;
+
+	memset(links, 0, sizeof(links));
+	memset(statistics, 0, sizeof(statistics));
+	memset(remote_statistics, 0, sizeof(remote_statistics));
+	for (i = 0; i < MAX_LINKS; i++) {
+		links[i].node = LINK_FREE;
+		links[i].age = 0xFF;
+	}
+}
@@ -0,0 +1,96 @@
+// -*- Mode: C; c-basic-offset: 8; -*-
+//
+// Copyright (c) 2014 SiK Multipoint Developers, All Rights Reserved
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+//  o Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  o Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in
+//    the documentation and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+// INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+// OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+///
+/// @file	links.h
+///
+/// Statistics for the links to the other nodes in the network
+///
+
+#ifndef _LINKS_H_
+#define _LINKS_H_
+
+/// the link table keeps statistics for up to MAX_LINKS of the other
+/// nodes, whatever their node ids. A node that hasn't been heard for
+/// LINK_STALE link updates gives its entry up to the next new one, so
+/// in a bigger network the table holds the nodes we hear. The base
+/// hears every node all the time, so this covers a 33 node star
+#define MAX_LINKS	32
+#define LINK_NONE	0xFF	///< no entry
+#define LINK_FREE	0xFFFF	///< node of an unused entry
+#define LINK_STALE	8	///< link updates, about 4 seconds
+
+#define LINK_RATE_HEARD	0x01	///< heard since the last air rate decision
+#define LINK_REPORTED	0x02	///< has sent us how it hears us
+
+struct link {
+	uint16_t	node;		///< LINK_FREE when unused
+	uint8_t		age;		///< link updates since we heard it
+	uint8_t		fec_received;	///< packets from it since the last link update
+	uint8_t		fec_bad;	///< of those, how many were corrected or lost
+	uint8_t		fec_hold;	///< link updates to keep golay on for it
+	uint8_t		flags;		///< LINK_RATE_HEARD, LINK_REPORTED
+};
+
+extern __xdata struct link links[MAX_LINKS];
+
+/// how we hear each node in the table, and how it hears us
+extern struct statistics statistics[MAX_LINKS], remote_statistics[MAX_LINKS];
+
+/// our own background noise
+extern __pdata uint8_t link_noise;
+
+/// find the entry for a node
+///
+/// @param node			the node id
+/// @return			its entry, or LINK_NONE
+///
+extern uint8_t link_find(__pdata uint16_t node);
+
+/// find the entry for a node we have just heard, giving it the entry of
+/// the node heard least lately if it has none
+///
+/// @param node			the node id
+/// @return			its entry, or LINK_NONE if every entry is
+///				in use by a node heard lately
+///
+extern uint8_t link_heard(__pdata uint16_t node);
+
+/// age the entries. Called on each link update
+extern void links_age(void);
+
+/// clear a flag in every entry
+///
+/// @param flag			the LINK_ flag to clear
+///
+extern void links_clear_flag(__pdata uint8_t flag);
+
+/// forget every node
+extern void links_reset(void);
+
+#endif // _LINKS_H_
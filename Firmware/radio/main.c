@@ -41,6 +41,8 @@
 #include "tdm.h"
 #include "timer.h"
 #include "freq_hopping.h"
+#include "packet.h"
+#include "crc.h"
 
 ////////////////////////////////////////////////////////////////////////////////
 /// @name	Interrupt vector prototypes
@@ -85,13 +87,18 @@ static void radio_init(void);
 
 /// statistics for radio and serial errors
 __pdata struct error_counts errors;
-struct statistics statistics[MAX_NODE_RSSI_STATS], remote_statistics[MAX_NODE_RSSI_STATS];
 
 /// optional features
 bool feature_golay;
+bool feature_adaptive_fec;
 bool feature_opportunistic_resend;
 bool feature_mavlink_framing;
+bool feature_mavlink_priority;
+bool feature_slip_framing;
 bool feature_rtscts;
+bool feature_demand_slots;
+bool feature_arq;
+bool feature_compress;
 
 void
 main(void)
@@ -110,14 +117,24 @@ main(void)
 		param_default();
 
 	// setup boolean features
-	feature_mavlink_framing = param_get(PARAM_MAVLINK)?true:false;
+	feature_mavlink_framing = (param_get(PARAM_MAVLINK) == 1 || param_get(PARAM_MAVLINK) == 2);
+	feature_mavlink_priority = (param_get(PARAM_MAVLINK) == 2);
+	feature_slip_framing = (param_get(PARAM_MAVLINK) == 3);
 	feature_opportunistic_resend = param_get(PARAM_OPPRESEND)?true:false;
-	feature_golay = param_get(PARAM_ECC)?true:false;
+	feature_golay = (param_get(PARAM_ECC) == 1);
+	feature_adaptive_fec = (param_get(PARAM_ECC) == 2);
 	feature_rtscts = param_get(PARAM_RTSCTS)?true:false;
+	feature_demand_slots = param_get(PARAM_DEMANDSLOTS)?true:false;
+	feature_arq = param_get(PARAM_ARQ)?true:false;
+	feature_compress = param_get(PARAM_COMPRESS)?true:false;
+	packet_set_serial_gap(param_get(PARAM_SERIAL_GAP));
 
 	// Do hardware initialisation.
 	hardware_init();
 
+	// use the CRC0 engine if it works
+	crc_init();
+
 	// do radio initialisation
 	radio_init();
 
@@ -410,6 +427,12 @@ radio_init(void)
 	
 	// setup sync from any node
 	tdm_set_sync_any(param_get(PARAM_SYNCANY));
+
+	// setup the slowest rate adaptive air rate may use
+	tdm_set_adaptive_rate(param_get(PARAM_ADAPTIVE_RATE));
+
+	// setup how often the base sends a sync
+	tdm_set_sync_rounds(param_get(PARAM_SYNC_ROUNDS));
 		
 	// setup transmit power
 	radio_set_transmit_power(txpower);
@@ -425,6 +448,9 @@ radio_init(void)
 	// initialise frequency hopping system
 	fhop_init(param_get(PARAM_NETID));
 
+	// setup how many channels adaptive hopping may leave out
+	fhop_set_max_excluded(param_get(PARAM_ADAPTIVE_HOP));
+
 	// initialise TDM system
 	tdm_init();
 }
@@ -36,6 +36,8 @@
 #include "radio.h"
 #include "packet.h"
 #include "timer.h"
+#include "mavlink.h"
+#include "links.h"
 
 extern __xdata uint8_t pbuf[MAX_PACKET_LENGTH];
 static __pdata uint8_t seqnum;
@@ -48,6 +50,24 @@ extern bool using_mavlink_10;
 #define RADIO_SOURCE_SYSTEM '3'
 #define RADIO_SOURCE_COMPONENT 'D'
 
+// add a byte to a MAVLink X.25 checksum
+#define CRC_ACCUMULATE(_c, _sum) do { \
+		register uint8_t _tmp = (_c) ^ (uint8_t)((_sum)&0xff); \
+		_tmp ^= (_tmp<<4); \
+		(_sum) = ((_sum)>>8) ^ ((uint16_t)_tmp<<8) ^ ((uint16_t)_tmp<<3) ^ (_tmp>>4); \
+	} while (0)
+
+// add len bytes to a MAVLink X.25 checksum
+static uint16_t
+crc_add(__xdata uint8_t * __pdata buf, __pdata uint8_t len, __pdata uint16_t sum)
+{
+	while (len--) {
+		CRC_ACCUMULATE(*buf, sum);
+		buf++;
+	}
+	return sum;
+}
+
 /*
  * Calculates the MAVLink checksum on a packet in pbuf[] 
  * and append it after the data
@@ -55,8 +75,8 @@ extern bool using_mavlink_10;
 static void mavlink_crc(void)
 {
 	register uint8_t length = pbuf[1];
-        __pdata uint16_t sum = 0xFFFF;
-	__pdata uint8_t i, stoplen;
+        __pdata uint16_t sum;
+	__pdata uint8_t stoplen;
 
 	stoplen = length + 6;
 
@@ -66,14 +86,7 @@ static void mavlink_crc(void)
 		stoplen++;
 	}
 
-	i = 1;
-	while (i<stoplen) {
-		register uint8_t tmp;
-		tmp = pbuf[i] ^ (uint8_t)(sum&0xff);
-		tmp ^= (tmp<<4);
-		sum = (sum>>8) ^ (tmp<<8) ^ (tmp<<3) ^ (tmp>>4);
-		i++;
-        }
+	sum = crc_add(&pbuf[1], stoplen-1, 0xFFFF);
 
 	pbuf[length+6] = sum&0xFF;
 	pbuf[length+7] = sum>>8;
@@ -127,8 +140,10 @@ static void swap_bytes(__pdata uint8_t ofs, __pdata uint8_t len)
 /// send a MAVLink status report packet
 void MAVLink_report(void)
 {
-	
-	pbuf[0] = using_mavlink_10?254:'U';
+	// report the link to node 1 on the base, and to the base elsewhere
+	__pdata uint8_t peer = link_find(nodeId == 0 ? 1 : 0);
+
+	pbuf[0] = using_mavlink_10?MAVLINK10_STX:MAVLINK09_STX;
 	pbuf[1] = sizeof(struct mavlink_RADIO_v09);
 	pbuf[2] = seqnum++;
 	pbuf[3] = RADIO_SOURCE_SYSTEM;
@@ -140,32 +155,32 @@ void MAVLink_report(void)
 		m->rxerrors = errors.rx_errors;
 		m->fixed    = errors.corrected_packets;
 		m->txbuf    = serial_read_space();
-		m->noise    = statistics[nodeId].average_noise;
-		if(nodeId == 0) {
-			m->rssi     = statistics[1].average_rssi;
-			m->remrssi  = remote_statistics[1].average_rssi;
-			m->remnoise = remote_statistics[1].average_noise;
+		m->noise    = link_noise;
+		if (peer != LINK_NONE) {
+			m->rssi     = statistics[peer].average_rssi;
+			m->remrssi  = remote_statistics[peer].average_rssi;
+			m->remnoise = remote_statistics[peer].average_noise;
 		}
 		else {
-			m->rssi     = statistics[0].average_rssi;
-			m->remrssi  = remote_statistics[0].average_rssi;
-			m->remnoise = remote_statistics[0].average_noise;			
+			m->rssi     = 0;
+			m->remrssi  = 0;
+			m->remnoise = 0;
 		}
 	} else {
 		struct mavlink_RADIO_v09 *m = (struct mavlink_RADIO_v09 *)&pbuf[6];
 		m->rxerrors = errors.rx_errors;
 		m->fixed    = errors.corrected_packets;
 		m->txbuf    = serial_read_space();
-		m->noise    = statistics[nodeId].average_noise;
-		if(nodeId == 0) {
-			m->rssi     = statistics[1].average_rssi;
-			m->remrssi  = remote_statistics[1].average_rssi;
-			m->remnoise = remote_statistics[1].average_noise;
+		m->noise    = link_noise;
+		if (peer != LINK_NONE) {
+			m->rssi     = statistics[peer].average_rssi;
+			m->remrssi  = remote_statistics[peer].average_rssi;
+			m->remnoise = remote_statistics[peer].average_noise;
 		}
 		else {
-			m->rssi     = statistics[0].average_rssi;
-			m->remrssi  = remote_statistics[0].average_rssi;
-			m->remnoise = remote_statistics[0].average_noise;			
+			m->rssi     = 0;
+			m->remrssi  = 0;
+			m->remnoise = 0;
 		}
 		swap_bytes(6+5, 4);
 	}
@@ -178,3 +193,318 @@ void MAVLink_report(void)
 
 	serial_write_buf(pbuf, sizeof(struct mavlink_RADIO_v09)+8);
 }
+
+// the length of a MAVLink frame, from the first bytes of its header
+uint16_t
+mavlink_frame_length(register uint8_t stx, __pdata uint8_t len, __pdata uint8_t incompat_flags)
+{
+	if (stx != MAVLINK20_STX) {
+		return len + MAVLINK10_OVERHEAD;
+	}
+	if (incompat_flags & MAVLINK20_IFLAG_SIGNED) {
+		return len + MAVLINK20_OVERHEAD + MAVLINK20_SIGNATURE_LEN;
+	}
+	return len + MAVLINK20_OVERHEAD;
+}
+
+// A MAVLink frame compressed for the air, as part of a packet from
+// compress_packet(), is a tag byte with the MC_ flags below, the
+// payload length, then the seq, the sysid and compid, the MAVLink 2
+// flags, the message id, the payload, the CRC and any signature. The
+// seq is left out when it is one more than the last frame in the
+// packet, the sysid and compid when they are the same, the flags when
+// they are zero, and the CRC when the receiver can work it out from
+// the message CRC_EXTRA. Bit 0 of the tag is always clear
+#define MC_V2		0x40	// a MAVLink 2 frame
+#define MC_CRC		0x20	// CRC sent
+#define MC_SEQ		0x10	// seq sent
+#define MC_ADDR		0x08	// sysid and compid sent
+#define MC_FLAGS	0x04	// MAVLink 2 incompat and compat flags sent
+#define MC_MSGID24	0x02	// all 3 bytes of the MAVLink 2 message id sent
+
+// the CRC_EXTRA of messages we can leave the CRC off. The sender
+// checks the CRC first, so a message that isn't here, or that a
+// dialect defines differently, is just sent with its CRC
+static __code const struct {
+	uint8_t msgid, extra;
+} crc_extras[] = {
+	{   0,  50 },	// HEARTBEAT
+	{   1, 124 },	// SYS_STATUS
+	{   2, 137 },	// SYSTEM_TIME
+	{   4, 237 },	// PING
+	{  20, 214 },	// PARAM_REQUEST_READ
+	{  21, 159 },	// PARAM_REQUEST_LIST
+	{  22, 220 },	// PARAM_VALUE
+	{  23, 168 },	// PARAM_SET
+	{  24,  24 },	// GPS_RAW_INT
+	{  27, 144 },	// RAW_IMU
+	{  29, 115 },	// SCALED_PRESSURE
+	{  30,  39 },	// ATTITUDE
+	{  33, 104 },	// GLOBAL_POSITION_INT
+	{  35, 244 },	// RC_CHANNELS_RAW
+	{  36, 222 },	// SERVO_OUTPUT_RAW
+	{  42,  28 },	// MISSION_CURRENT
+	{  62, 183 },	// NAV_CONTROLLER_OUTPUT
+	{  65, 118 },	// RC_CHANNELS
+	{  66, 148 },	// REQUEST_DATA_STREAM
+	{  69, 243 },	// MANUAL_CONTROL
+	{  70, 124 },	// RC_CHANNELS_OVERRIDE
+	{  74,  20 },	// VFR_HUD
+	{  76, 152 },	// COMMAND_LONG
+	{  77, 143 },	// COMMAND_ACK
+	{ 109, 185 },	// RADIO_STATUS
+	{ 111,  34 },	// TIMESYNC
+	{ 147, 154 },	// BATTERY_STATUS
+	{ 150, 134 },	// SENSOR_OFFSETS
+	{ 152, 208 },	// MEMINFO
+	{ 163, 127 },	// AHRS
+	{ 165,  21 },	// HWSTATUS
+	{ MAVLINK_MSG_ID_RADIO, MAVLINK_RADIO_CRC_EXTRA },
+	{ 178,  47 },	// AHRS2
+	{ 241,  90 },	// VIBRATION
+	{ 242, 104 },	// HOME_POSITION
+	{ 250,  49 },	// DEBUG_VECT
+	{ 253,  83 },	// STATUSTEXT
+};
+
+#define MC_NO_EXTRA	0x100
+
+// the CRC_EXTRA of a message, or MC_NO_EXTRA if we don't know it
+static uint16_t
+crc_extra(register uint8_t msgid)
+{
+	register uint8_t i;
+
+	for (i = 0; i < sizeof(crc_extras)/sizeof(crc_extras[0]); i++) {
+		if (crc_extras[i].msgid == msgid) {
+			return crc_extras[i].extra;
+		}
+	}
+	return MC_NO_EXTRA;
+}
+
+// the CRC a frame would have, given its header and payload
+static uint16_t
+frame_crc(__xdata uint8_t * __pdata header, __pdata uint8_t hlen,
+	  __xdata uint8_t * __pdata payload, __pdata uint8_t plen,
+	  __pdata uint8_t extra)
+{
+	__pdata uint16_t sum;
+
+	sum = crc_add(header+1, hlen-1, 0xFFFF);
+	sum = crc_add(payload, plen, sum);
+	CRC_ACCUMULATE(extra, sum);
+	return sum;
+}
+
+// a rebuilt header and CRC, for the serial port
+static __xdata uint8_t mc_header[MAVLINK20_HEADER_LEN];
+static __xdata uint8_t mc_crc[2];
+
+// what the next frame's seq, sysid and compid are predicted from
+__pdata static uint8_t mc_seq, mc_sysid, mc_compid;
+static bool mc_first;
+
+void
+mavlink_frame_reset(void)
+{
+	mc_first = true;
+	mc_seq = mc_sysid = mc_compid = 0;
+}
+
+// the size of the tagged part of a compressed frame
+static uint8_t
+tag_length(register uint8_t tag)
+{
+	register uint8_t n = (tag & MC_MSGID24) ? 3 : 1;
+
+	if (tag & MC_SEQ) {
+		n++;
+	}
+	if (tag & MC_ADDR) {
+		n += 2;
+	}
+	if (tag & MC_FLAGS) {
+		n += 2;
+	}
+	if (tag & MC_CRC) {
+		n += 2;
+	}
+	return n;
+}
+
+uint8_t
+mavlink_frame_encode(__xdata uint8_t * __pdata f, __pdata uint8_t n,
+		     __xdata uint8_t * __pdata out, __pdata uint8_t room)
+{
+	__pdata uint16_t extra;
+	__pdata uint8_t o, hlen, plen, slen;
+	register uint8_t tag, c;
+
+	// work out what the receiver can't guess
+	plen = f[1];
+	tag = MAVLINK_TAG_FRAME;
+	if (f[0] == MAVLINK20_STX) {
+		tag |= MC_V2;
+		hlen = MAVLINK20_HEADER_LEN;
+		if (f[2] != 0 || f[3] != 0) {
+			tag |= MC_FLAGS;
+		}
+		if (f[8] != 0 || f[9] != 0) {
+			tag |= MC_MSGID24;
+		}
+		c = 4;		// offset of seq
+	} else {
+		hlen = MAVLINK10_HEADER_LEN;
+		c = 2;
+	}
+	if (mc_first || f[c] != (uint8_t)(mc_seq+1)) {
+		tag |= MC_SEQ;
+	}
+	if (mc_first || f[c+1] != mc_sysid || f[c+2] != mc_compid) {
+		tag |= MC_ADDR;
+	}
+
+	extra = MC_NO_EXTRA;
+	if (!(tag & MC_MSGID24)) {
+		extra = crc_extra(f[c+3]);
+	}
+	if (extra == MC_NO_EXTRA ||
+	    frame_crc(f, hlen, f+hlen, plen, extra) != (f[hlen+plen] | ((uint16_t)f[hlen+plen+1]<<8))) {
+		tag |= MC_CRC;
+	}
+
+	slen = n - (hlen + plen + 2);
+	if (2 + tag_length(tag) + plen + slen > room) {
+		return 0;
+	}
+	mc_first = false;
+	mc_seq = f[c];
+	mc_sysid = f[c+1];
+	mc_compid = f[c+2];
+
+	o = 0;
+	out[o++] = tag;
+	out[o++] = plen;
+	if (tag & MC_SEQ) {
+		out[o++] = mc_seq;
+	}
+	if (tag & MC_ADDR) {
+		out[o++] = mc_sysid;
+		out[o++] = mc_compid;
+	}
+	if (tag & MC_FLAGS) {
+		out[o++] = f[2];
+		out[o++] = f[3];
+	}
+	out[o++] = f[c+3];
+	if (tag & MC_MSGID24) {
+		out[o++] = f[8];
+		out[o++] = f[9];
+	}
+	memcpy(&out[o], f+hlen, plen);
+	o += plen;
+	if (tag & MC_CRC) {
+		out[o++] = f[hlen+plen];
+		out[o++] = f[hlen+plen+1];
+	}
+	memcpy(&out[o], f+hlen+plen+2, slen);
+	return o + slen;
+}
+
+uint8_t
+mavlink_frame_decode(__xdata uint8_t * __pdata buf, __pdata uint8_t len)
+{
+	__xdata uint8_t * __pdata payload;
+	__pdata uint16_t extra, sum;
+	__pdata uint8_t i, hlen, plen, slen;
+	register uint8_t tag, c;
+
+	// check the frame is all there before using it
+	if (len < 2) {
+		return 0;
+	}
+	tag = buf[0];
+	plen = buf[1];
+	if (2 + tag_length(tag) + (uint16_t)plen > len) {
+		return 0;
+	}
+	i = 2;
+
+	if (tag & MC_SEQ) {
+		mc_seq = buf[i++];
+	} else {
+		mc_seq++;
+	}
+	if (tag & MC_ADDR) {
+		mc_sysid = buf[i++];
+		mc_compid = buf[i++];
+	}
+
+	mc_header[1] = plen;
+	if (tag & MC_V2) {
+		hlen = MAVLINK20_HEADER_LEN;
+		mc_header[0] = MAVLINK20_STX;
+		mc_header[2] = 0;
+		mc_header[3] = 0;
+		if (tag & MC_FLAGS) {
+			mc_header[2] = buf[i++];
+			mc_header[3] = buf[i++];
+		}
+		c = 4;
+		mc_header[7] = buf[i++];
+		mc_header[8] = 0;
+		mc_header[9] = 0;
+		if (tag & MC_MSGID24) {
+			mc_header[8] = buf[i++];
+			mc_header[9] = buf[i++];
+		}
+	} else {
+		hlen = MAVLINK10_HEADER_LEN;
+		mc_header[0] = MAVLINK10_STX;
+		c = 2;
+		mc_header[5] = buf[i++];
+	}
+	mc_header[c] = mc_seq;
+	mc_header[c+1] = mc_sysid;
+	mc_header[c+2] = mc_compid;
+
+	payload = &buf[i];
+	i += plen;
+
+	if (tag & MC_CRC) {
+		mc_crc[0] = buf[i++];
+		mc_crc[1] = buf[i++];
+	} else {
+		extra = crc_extra(mc_header[c+3]);
+		if (extra == MC_NO_EXTRA) {
+			// not from a sender that agrees with us
+			return 0;
+		}
+		sum = frame_crc(mc_header, hlen, payload, plen, extra);
+		mc_crc[0] = sum & 0xFF;
+		mc_crc[1] = sum >> 8;
+	}
+
+	slen = 0;
+	if ((tag & MC_V2) && (mc_header[2] & MAVLINK20_IFLAG_SIGNED)) {
+		slen = MAVLINK20_SIGNATURE_LEN;
+		if (i + slen > len) {
+			return 0;
+		}
+	}
+
+	// a frame that doesn't fit is dropped whole, so the
+	// other end doesn't see half of it
+	if (serial_write_space() < hlen + plen + 2 + slen) {
+		if (errors.serial_tx_overflow != 0xFFFF) {
+			errors.serial_tx_overflow++;
+		}
+	} else {
+		serial_write_buf(mc_header, hlen);
+		serial_write_buf(payload, plen);
+		serial_write_buf(mc_crc, 2);
+		serial_write_buf(&buf[i], slen);
+	}
+	return i + slen;
+}
@@ -0,0 +1,100 @@
+// -*- Mode: C; c-basic-offset: 8; -*-
+//
+// Copyright (c) 2012 Andrew Tridgell, All Rights Reserved
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+//  o Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  o Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in
+//    the documentation and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+// INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+// OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+///
+/// @file	mavlink.h
+///
+/// MAVLink framing, and the compressed form MAVLink frames are sent
+/// over the air in by compress_packet()
+///
+
+#ifndef _MAVLINK_H_
+#define _MAVLINK_H_
+
+#define MAVLINK09_STX 85 // 'U'
+#define MAVLINK10_STX 254
+#define MAVLINK20_STX 253
+
+#define MAVLINK_IS_STX(_c)	((_c) == MAVLINK09_STX || (_c) == MAVLINK10_STX || (_c) == MAVLINK20_STX)
+
+// header and CRC bytes around the payload. A signed MAVLink 2 frame
+// has a signature after the CRC
+#define MAVLINK10_HEADER_LEN	6
+#define MAVLINK20_HEADER_LEN	10
+#define MAVLINK10_OVERHEAD	(MAVLINK10_HEADER_LEN+2)
+#define MAVLINK20_OVERHEAD	(MAVLINK20_HEADER_LEN+2)
+#define MAVLINK20_SIGNATURE_LEN	13
+#define MAVLINK20_IFLAG_SIGNED	0x01
+
+// how much of the header is needed to know the frame length. MAVLink 2
+// needs the incompat flags after the payload length
+#define MAVLINK_LENGTH_BYTES(_stx)	((_stx) == MAVLINK20_STX ? 3 : 2)
+
+/// the length of a MAVLink frame, from the first bytes of its header
+///
+/// @param stx			the start byte
+/// @param len			the payload length byte
+/// @param incompat_flags	the MAVLink 2 incompat flags, ignored for
+///				older frames
+///
+/// @return			the length of the whole frame
+///
+extern uint16_t mavlink_frame_length(register uint8_t stx, __pdata uint8_t len, __pdata uint8_t incompat_flags);
+
+/// the tag of a compressed frame has bit 7 set and bit 0 clear
+#define MAVLINK_TAG_FRAME	0x80
+#define MAVLINK_IS_TAG(_tag)	(((_tag) & 0x81) == MAVLINK_TAG_FRAME)
+
+/// start predicting frame headers afresh, at the start of a packet
+///
+extern void mavlink_frame_reset(void);
+
+/// compress a MAVLink 1.0 or 2 frame for sending over the air
+///
+/// @param f			the whole frame
+/// @param n			its length
+/// @param out			where to put the compressed frame
+/// @param room			how much space there is at out
+///
+/// @return			the length of the compressed frame, or 0
+///				if it would not fit
+///
+extern uint8_t mavlink_frame_encode(__xdata uint8_t * __pdata f, __pdata uint8_t n,
+				    __xdata uint8_t * __pdata out, __pdata uint8_t room);
+
+/// rebuild a compressed MAVLink frame, and write it to the serial port
+///
+/// @param buf			the compressed frame, starting with its tag
+/// @param len			bytes left in the packet
+///
+/// @return			the length of the compressed frame, or 0
+///				if it is malformed
+///
+extern uint8_t mavlink_frame_decode(__xdata uint8_t * __pdata buf, __pdata uint8_t len);
+
+#endif // _MAVLINK_H_
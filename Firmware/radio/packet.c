@@ -36,20 +36,106 @@
 #include "radio.h"
 #include "packet.h"
 #include "timer.h"
+#include "crc.h"
+#include "mavlink.h"
 
 static __bit last_sent_is_resend;
 static __bit last_sent_is_injected;
-static __bit last_recv_is_resend;
 static __bit force_resend;
 
-static __xdata uint8_t last_received[MAX_PACKET_LENGTH];
-static __xdata uint8_t last_sent[MAX_PACKET_LENGTH];
-static __pdata uint8_t last_sent_len;
-static __pdata uint8_t last_recv_len;
+// the transmit frame. Frames are built from the serial port into it
+// with room for the tdm trailer after the data, so the radio can take
+// a frame straight from it. Each frame costs MAX_PACKET_LENGTH bytes
+// of xdata, so there is only the one. It holds either a frame built
+// ahead of our transmit window (queue_count is 1), or the frame last
+// handed out, kept for resends, or an injected packet. Injected
+// packets wait for a frame built ahead to go first, and an ARQ resend
+// puts it back in the serial FIFO
+struct packet_frame {
+	uint16_t pos;		// serial position of the first byte
+	uint8_t	len;
+	uint8_t	data[MAX_PACKET_LENGTH];
+};
+
+static __xdata struct packet_frame tx_frame;
+static __pdata uint8_t queue_count;
+
+// a frame built ahead that is too big for the window it goes out in
+// is sent in two parts. The first part goes from the start of
+// tx_frame, and the rest waits at the end of it, clear of the
+// trailer, until the first part is off the air
+static __pdata uint8_t split_rest;
+
+// an injected AT or ATI5 reply waiting for tx_frame to be free. The
+// ATI5 replies are numbered by parameter
+#define INJECT_NONE	0xFF
+#define INJECT_AT	0xFE
+static __pdata uint8_t inject_pending = INJECT_NONE;
+
+// ARQ. Every frame of serial data gets a sequence number and stays
+// in the arq ring until the receiver acknowledges it. The data itself
+// is held in the serial receive FIFO, so a lost frame is rebuilt from
+// there. Frames are in serial order, so the FIFO is released up to the
+// oldest frame that has not been acknowledged
+#define ARQ_WINDOW	8	// must be a power of 2
+#define ARQ_MAX_TRIES	4
+
+struct arq_frame {
+	uint16_t pos;		// serial position of the first byte
+	uint16_t sent;		// timer2 tick it was last sent at
+	uint8_t	seq;
+	uint8_t	len;
+	uint8_t	tries;		// zero once acknowledged or given up
+	uint8_t	lost;		// an ack showed it missing
+};
+
+static __xdata struct arq_frame arq[ARQ_WINDOW];
+static __pdata uint8_t arq_head, arq_count;
+
+// data is going to every node. An acknowledgement from one node can't
+// speak for the rest, so frames are sent once, as without ARQ. They
+// still get sequence numbers, so the receivers drop duplicates
+static __bit arq_broadcast;
+static __pdata uint8_t arq_seq, current_seq;
+static __pdata uint16_t arq_timeout;
+
+#define ARQ_SLOT(n)	(&arq[(n) & (ARQ_WINDOW-1)])
+
+// what we have received from each node. Without ARQ a resend is
+// matched against the crc of the last packet from the same node, with
+// ARQ the sequence numbers are kept here to be acknowledged
+#define PACKET_MAX_PEERS	32
+
+struct packet_peer {
+	uint8_t	seq;		// latest sequence number
+	uint8_t	bits;		// bit n set if seq-1-n was received too
+	uint16_t crc;		// crc of the last packet that was not a resend
+	uint8_t	len;
+	uint8_t	state;
+};
+#define PEER_SEEN		1	// seq and bits are valid
+#define PEER_PENDING		2	// needs acknowledging
+#define PEER_RECEIVED		4	// crc and len are valid
+
+static __xdata struct packet_peer peers[PACKET_MAX_PEERS];
+static __pdata uint8_t arq_ack_next;
 
 // serial speed in 16usecs/byte
 static __pdata uint16_t serial_rate;
 
+// the gap in the serial data, in byte times, that ends a transparent
+// mode packet. 0 sends data as soon as it arrives
+static __pdata uint8_t serial_gap;
+
+// how much serial data there was when we last looked, and the
+// timer2_tick time it last grew
+static __pdata uint16_t gap_slen;
+static __pdata uint16_t gap_start_time;
+
+// set once the serial data has stopped growing for the gap, so the
+// 16 bit tick difference wrapping can't hold the data again
+static __bit gap_expired;
+
 // the length of a pending MAVLink packet, or zero if no MAVLink
 // packet is expected
 static __pdata uint8_t mav_pkt_len;
@@ -71,8 +157,28 @@ bool using_mavlink_10;
 
 #define PACKET_RESEND_THRESHOLD 32
 
-#define MAVLINK09_STX 85 // 'U'
-#define MAVLINK10_STX 254
+// SLIP framing, RFC 1055. Only the END byte matters to us, the
+// escapes are left to the hosts at each end
+#define SLIP_END	0xC0
+
+// the timer2_tick time we started waiting for the end of a SLIP frame
+static __pdata uint16_t slip_wait_start;
+static bool slip_waiting;
+
+// the length of the MAVLink frame starting ofs bytes into the serial
+// buffer, or 0 if no frame starts there or too little of its header
+// has arrived to tell
+static uint16_t
+mavlink_serial_length(__pdata uint16_t ofs, __pdata uint16_t slen)
+{
+	register uint8_t c = serial_peek_at(ofs);
+
+	if (!MAVLINK_IS_STX(c) || ofs + MAVLINK_LENGTH_BYTES(c) > slen) {
+		return 0;
+	}
+	return mavlink_frame_length(c, serial_peek_at(ofs+1),
+				    c == MAVLINK20_STX ? serial_peek_at(ofs+2) : 0);
+}
 
 // check if a buffer looks like a MAVLink heartbeat packet - this
 // is used to determine if we will inject RADIO status MAVLink
@@ -90,162 +196,291 @@ static void check_heartbeat(__xdata uint8_t * __pdata buf)
 		// looks like a MAVLink 1.0 heartbeat
 		using_mavlink_10 = true;
 		seen_mavlink = true;
+	} else if (buf[0] == MAVLINK20_STX &&
+		   buf[1] == 9 && buf[7] == 0 && buf[8] == 0 && buf[9] == 0) {
+		// looks like a MAVLink 2 heartbeat. MAVLink 2 parsers
+		// take 1.0 frames, so report in 1.0
+		using_mavlink_10 = true;
+		seen_mavlink = true;
+	}
+}
+
+// MAVLink messages that should not wait behind telemetry. Vehicle
+// control first, then parameter and mission transfers
+#define MAV_PRIORITY_CONTROL	2
+#define MAV_PRIORITY_COMMAND	1
+#define MAV_PRIORITY_TELEMETRY	0
+
+static uint8_t
+mavlink_priority(register uint8_t msgid)
+{
+	switch (msgid) {
+	case 11:	// SET_MODE
+	case 69:	// MANUAL_CONTROL
+	case 70:	// RC_CHANNELS_OVERRIDE
+	case 75:	// COMMAND_INT
+	case 76:	// COMMAND_LONG
+	case 77:	// COMMAND_ACK
+	case 82:	// SET_ATTITUDE_TARGET
+	case 84:	// SET_POSITION_TARGET_LOCAL_NED
+	case 86:	// SET_POSITION_TARGET_GLOBAL_INT
+		return MAV_PRIORITY_CONTROL;
+	case 20:	// PARAM_REQUEST_READ
+	case 21:	// PARAM_REQUEST_LIST
+	case 23:	// PARAM_SET
+	case 39:	// MISSION_ITEM
+	case 40:	// MISSION_REQUEST
+	case 41:	// MISSION_SET_CURRENT
+	case 43:	// MISSION_REQUEST_LIST
+	case 44:	// MISSION_COUNT
+	case 45:	// MISSION_CLEAR_ALL
+	case 47:	// MISSION_ACK
+	case 51:	// MISSION_REQUEST_INT
+	case 73:	// MISSION_ITEM_INT
+		return MAV_PRIORITY_COMMAND;
+	}
+	return MAV_PRIORITY_TELEMETRY;
+}
+
+// move the complete MAVLink frames waiting in the serial buffer to
+// the front in priority order, keeping the order of the frames within
+// each priority. Stops at the first thing that isn't a whole MAVLink
+// frame, as there is no telling where the frames after it start.
+// Returns true if anything was moved
+static bool
+mavlink_prioritise(void)
+{
+	__pdata uint16_t slen, sorted, ofs, n;
+	register uint8_t prio, c;
+	bool moved = false;
+
+	slen = serial_read_available();
+	sorted = 0;
+	for (prio = MAV_PRIORITY_CONTROL; prio != MAV_PRIORITY_TELEMETRY; prio--) {
+		ofs = sorted;
+		while (ofs < slen) {
+			n = mavlink_serial_length(ofs, slen);
+			if (n == 0 ||
+			    n > mav_max_xmit ||
+			    ofs + n > slen) {
+				break;
+			}
+			// only the 1.0 and 2 message ids are known. The
+			// 2 ids are 24 bits, the ones we want fit in 8
+			c = serial_peek_at(ofs);
+			if (c == MAVLINK10_STX) {
+				c = mavlink_priority(serial_peek_at(ofs+5));
+			} else if (c == MAVLINK20_STX &&
+				   serial_peek_at(ofs+8) == 0 &&
+				   serial_peek_at(ofs+9) == 0) {
+				c = mavlink_priority(serial_peek_at(ofs+7));
+			} else {
+				c = MAV_PRIORITY_TELEMETRY;
+			}
+			if (c == prio) {
+				if (ofs != sorted) {
+					serial_read_promote(sorted, ofs, n);
+					moved = true;
+				}
+				sorted += n;
+			}
+			ofs += n;
+		}
 	}
+	return moved;
 }
 
 // return a complete MAVLink frame, possibly expanding
 // to include other complete frames that fit in the max_xmit limit
 static 
-uint8_t mavlink_frame(uint8_t max_xmit, __xdata uint8_t * __pdata buf)
+uint8_t mavlink_frame(uint8_t max_xmit)
 {
 	__data uint16_t slen;
+	__pdata uint16_t n;
 
-	serial_read_buf(last_sent, mav_pkt_len);
-	last_sent_len = mav_pkt_len;
-	memcpy(buf, last_sent, last_sent_len);
+	serial_read_buf(tx_frame.data, mav_pkt_len);
+	tx_frame.len = mav_pkt_len;
 	mav_pkt_len = 0;
 
-	check_heartbeat(buf);
+	check_heartbeat(tx_frame.data);
 
 	slen = serial_read_available();
 
 	// see if we have more complete MAVLink frames in the serial
 	// buffer that we can fit in this packet
-	while (slen >= 8) {
-		register uint8_t c = serial_peek();
-		if (c != MAVLINK09_STX && c != MAVLINK10_STX) {
+	while (slen >= MAVLINK10_OVERHEAD) {
+		n = mavlink_serial_length(0, slen);
+		if (n == 0) {
 			// its not a MAVLink packet
-			return last_sent_len;			
+			return tx_frame.len;
 		}
-		c = serial_peek2();
-		if (c >= 255 - 8 || 
-		    c+8 > max_xmit - last_sent_len) {
+		if (n > max_xmit - tx_frame.len) {
 			// it won't fit
 			break;
 		}
-		if (c+8 > slen) {
+		if (n > slen) {
 			// we don't have the full MAVLink packet in
 			// the serial buffer
 			break;
 		}
 
-		c += 8;
-
 		// we can add another MAVLink frame to the packet
-		serial_read_buf(&last_sent[last_sent_len], c);
-		memcpy(&buf[last_sent_len], &last_sent[last_sent_len], c);
+		serial_read_buf(&tx_frame.data[tx_frame.len], n);
 
-		check_heartbeat(buf+last_sent_len);
+		check_heartbeat(&tx_frame.data[tx_frame.len]);
 
-		last_sent_len += c;
-		slen -= c;
+		tx_frame.len += n;
+		slen -= n;
 	}
 
-	return last_sent_len;
+	return tx_frame.len;
 }
 
+// note when more serial data arrives, so we can see the gaps in it
+static void
+gap_update(void)
+{
+	register uint16_t slen = serial_read_available();
 
-// return the next packet to be sent
-uint8_t
-packet_get_next(register uint8_t max_xmit, __xdata uint8_t * __pdata buf)
+	if (slen > gap_slen) {
+		gap_start_time = timer2_tick();
+		gap_expired = false;
+	} else if (!gap_expired &&
+		   (uint16_t)(timer2_tick() - gap_start_time) >= serial_gap * serial_rate) {
+		gap_expired = true;
+	}
+	gap_slen = slen;
+}
+
+// build a frame of whole SLIP frames from the serial port
+static uint8_t
+slip_frame(register uint8_t max_xmit)
 {
-	register uint16_t slen;
-	
-#ifdef WATCH_DOG_ENABLE
-	// Kick the Watchdog
-	PCA0CPH5 = 0;
-#endif // WATCH_DOG_ENABLE
-	
+	__pdata uint16_t slen;
+	__pdata uint32_t wait;
+	register uint8_t n, cut;
+
 	slen = serial_read_available();
-	if (force_resend ||
-		(feature_opportunistic_resend &&
-		 last_sent_is_resend == false && 
-		 last_sent_len != 0 && 
-		 slen < PACKET_RESEND_THRESHOLD))
-	{
-		if (max_xmit < last_sent_len) {
-			last_sent_len = 0;
-			return 0;
+	n = slen > max_xmit ? max_xmit : slen;
+
+	// send up to the last END that fits
+	for (cut = n; cut != 0; cut--) {
+		if (serial_peek_at(cut-1) == SLIP_END) {
+			break;
 		}
-		last_sent_is_resend = true;
-		force_resend = false;
-		memcpy(buf, last_sent, last_sent_len);
-		slen = last_sent_len;
-		last_sent_len = 0;
-		return (slen & 0xFF);
 	}
-	last_sent_is_resend = false;
 
-	if (injected_packet) {
-		// send a previously injected packet
-		slen = last_sent_len;
-		// if we can't send the full packet, wait..
-		if (max_xmit < slen) {
+	if (cut == 0) {
+		if (slen > max_xmit) {
+			// a SLIP frame bigger than the packet has to be
+			// split
+			cut = n;
+		} else if (!slip_waiting) {
+			// wait for the rest of it
+			slip_waiting = true;
+			slip_wait_start = timer2_tick();
 			return 0;
+		} else {
+			// it should have arrived within a packet's worth of
+			// serial time. At slow serial speeds that is more
+			// than timer2_tick() can count, so wait at most
+			// half its range
+			wait = (uint32_t)max_xmit * serial_rate;
+			if (wait > 0x8000) {
+				wait = 0x8000;
+			}
+			if ((uint16_t)(timer2_tick() - slip_wait_start) <= wait) {
+				return 0;
+			}
+			// send what we have
+			cut = n;
 		}
-		// send the rest
-		memcpy(buf, last_sent, last_sent_len);
-		injected_packet = false;
-		last_sent_is_injected = true;
-		return last_sent_len;
 	}
-	last_sent_is_injected = false;
+	slip_waiting = false;
+
+	serial_read_buf(tx_frame.data, cut);
+	tx_frame.len = cut;
+	return cut;
+}
+
+// build a frame from the serial port into tx_frame
+static uint8_t
+build_frame(register uint8_t max_xmit)
+{
+	register uint16_t slen;
+	__pdata uint16_t n;
 
 	// if we have received something via serial see how
 	// much of it we could fit in the transmit FIFO
+	slen = serial_read_available();
 	if (slen > max_xmit) {
 		slen = max_xmit;
 	}
 
-	last_sent_len = 0;
+	tx_frame.len = 0;
+	tx_frame.pos = serial_read_position();
 
 	if (slen == 0) {
 		// nothing available to send
 		return 0;
 	}
 
+	if (feature_slip_framing) {
+		return slip_frame(max_xmit);
+	}
+
 	if (!feature_mavlink_framing) {
+		if (serial_gap != 0 && slen < max_xmit) {
+			// hold a part filled packet until the host
+			// pauses
+			gap_update();
+			if (!gap_expired) {
+				return 0;
+			}
+		}
+
 		// simple framing
-		if (slen > 0 && serial_read_buf(buf, slen)) {
-			memcpy(last_sent, buf, slen);
-			last_sent_len = slen;
-		} else {
-			last_sent_len = 0;
+		if (slen > 0 && serial_read_buf(tx_frame.data, slen)) {
+			tx_frame.len = slen;
 		}
-		return last_sent_len;
+		return tx_frame.len;
 	}
 
 	// try to align packet boundaries with MAVLink packets
 
 	if (mav_pkt_len == 1) {
-		// we're waiting for the MAVLink length byte
-		if (slen == 1) {
+		// we're waiting for the MAVLink length byte, and the
+		// MAVLink 2 flags after it
+		if (slen < MAVLINK_LENGTH_BYTES(serial_peek())) {
 			if ((uint16_t)(timer2_tick() - mav_pkt_start_time) > mav_pkt_max_time) {
 				// we didn't get the length byte in time
-				last_sent[last_sent_len++] = serial_read();
-				memcpy(buf, last_sent, last_sent_len);				
+				tx_frame.data[tx_frame.len++] = serial_read();
 				mav_pkt_len = 0;
-				return last_sent_len;
+				return tx_frame.len;
 			}
 			// still waiting ....
 			return 0;
 		}
-		// we have more than one byte, use normal packet frame
+		// we have enough of the header, use normal packet frame
 		// detection below
 		mav_pkt_len = 0;
 	}
 
+	if (feature_mavlink_priority && mavlink_prioritise()) {
+		// a different frame is at the front now
+		mav_pkt_len = 0;
+	}
+
 
 	if (mav_pkt_len != 0) {
 		if (slen < mav_pkt_len) {
 			if ((uint16_t)(timer2_tick() - mav_pkt_start_time) > mav_pkt_max_time) {
 				// timeout waiting for the rest of
 				// it. Send what we have now.
-				serial_read_buf(last_sent, slen);
-				last_sent_len = slen;
-				memcpy(buf, last_sent, last_sent_len);
+				serial_read_buf(tx_frame.data, slen);
+				tx_frame.len = slen;
 				mav_pkt_len = 0;
-				return last_sent_len;
+				return tx_frame.len;
 			}
 			// leave it in the serial buffer till we have the
 			// whole MAVLink packet			
@@ -253,46 +488,44 @@ packet_get_next(register uint8_t max_xmit, __xdata uint8_t * __pdata buf)
 		}
 		
 		// the whole of the MAVLink packet is available
-		return mavlink_frame(max_xmit, buf);
+		return mavlink_frame(max_xmit);
 	}
 		
 	while (slen > 0) {
 		register uint8_t c = serial_peek();
-		if (c == MAVLINK09_STX || c == MAVLINK10_STX) {
-			if (slen == 1) {
+		if (MAVLINK_IS_STX(c)) {
+			if (slen < MAVLINK_LENGTH_BYTES(c)) {
 				// we got a bare MAVLink header byte
-				if (last_sent_len == 0) {
-					// wait for the next byte to
+				if (tx_frame.len == 0) {
+					// wait for the next bytes to
 					// give us the length
 					mav_pkt_len = 1;
 					mav_pkt_start_time = timer2_tick();
-					mav_pkt_max_time = serial_rate;
+					mav_pkt_max_time = (MAVLINK_LENGTH_BYTES(c) - 1) * serial_rate;
 					return 0;
 				}
 				break;
 			}
-			mav_pkt_len = serial_peek2();
-			if (mav_pkt_len >= 255-8 ||
-				mav_pkt_len+8 > mav_max_xmit) {
+			n = mavlink_serial_length(0, slen);
+			if (n > mav_max_xmit) {
 				// its too big for us to cope with
 				mav_pkt_len = 0;
-				last_sent[last_sent_len++] = serial_read();
+				tx_frame.data[tx_frame.len++] = serial_read();
 				slen--;				
 				continue;
 			}
 
-			// the length byte doesn't include
-			// the header or CRC
-			mav_pkt_len += 8;
+			// the whole frame, header, CRC and any
+			// signature
+			mav_pkt_len = n;
 			
-			if (last_sent_len != 0) {
+			if (tx_frame.len != 0) {
 				// send what we've got so far,
 				// and send the MAVLink payload
 				// in the next packet
-				memcpy(buf, last_sent, last_sent_len);
 				mav_pkt_start_time = timer2_tick();
 				mav_pkt_max_time = mav_pkt_len * serial_rate;
-				return last_sent_len;
+				return tx_frame.len;
 			} else if (mav_pkt_len > slen) {
 				// the whole MAVLink packet isn't in
 				// the serial buffer yet. 
@@ -302,16 +535,318 @@ packet_get_next(register uint8_t max_xmit, __xdata uint8_t * __pdata buf)
 			} else {
 				// the whole packet is there
 				// and ready to be read
-				return mavlink_frame(max_xmit, buf);
+				return mavlink_frame(max_xmit);
 			}
 		} else {
-			last_sent[last_sent_len++] = serial_read();
+			tx_frame.data[tx_frame.len++] = serial_read();
 			slen--;
 		}
 	}
 
-	memcpy(buf, last_sent, last_sent_len);
-	return last_sent_len;
+	return tx_frame.len;
+}
+
+// build a frame into tx_frame, and queue it if it has anything in it
+static void
+packet_build(register uint8_t max_xmit)
+{
+	if (build_frame(max_xmit) != 0) {
+		queue_count = 1;
+	}
+}
+
+// how much of the start of a frame fits in max_xmit bytes without
+// splitting a MAVLink packet or SLIP frame
+static uint8_t
+frame_split(__xdata struct packet_frame * __pdata f, register uint8_t max_xmit)
+{
+	register uint8_t n = 0;
+	register uint8_t c;
+	__pdata uint16_t len;
+
+	if (feature_slip_framing) {
+		// up to the last END that fits, if there is one
+		for (n = max_xmit; n != 0; n--) {
+			if (f->data[n-1] == SLIP_END) {
+				return n;
+			}
+		}
+		for (n = max_xmit; n < f->len; n++) {
+			if (f->data[n] == SLIP_END) {
+				// wait for a bigger window
+				return 0;
+			}
+		}
+		return max_xmit;
+	}
+	if (!feature_mavlink_framing) {
+		return max_xmit;
+	}
+	while (n < max_xmit) {
+		c = f->data[n];
+		if (MAVLINK_IS_STX(c) &&
+		    n + MAVLINK_LENGTH_BYTES(c) <= f->len) {
+			len = mavlink_frame_length(c, f->data[n+1],
+						   c == MAVLINK20_STX ? f->data[n+2] : 0);
+			if (n + len > max_xmit) {
+				break;
+			}
+			n += len;
+		} else {
+			n++;
+		}
+	}
+	return n;
+}
+
+// free the serial data of the oldest frames once they are done with
+static void
+arq_release(void)
+{
+	__xdata struct arq_frame * __pdata a;
+
+	while (arq_count != 0) {
+		a = ARQ_SLOT(arq_head);
+		if (a->tries != 0) {
+			break;
+		}
+		serial_read_release(a->pos + a->len);
+		arq_head = (arq_head + 1) & (ARQ_WINDOW-1);
+		arq_count--;
+	}
+}
+
+// rebuild the oldest lost or timed out frame that fits in the resend
+// slot. Returns false if there is nothing to resend
+static bool
+arq_resend(register uint8_t max_xmit)
+{
+	__xdata struct arq_frame * __pdata a;
+	register uint8_t i;
+
+	for (i = 0; i < arq_count; i++) {
+		a = ARQ_SLOT(arq_head + i);
+		if (a->tries == 0 || a->len > max_xmit) {
+			continue;
+		}
+		if (!a->lost && (uint16_t)(timer2_tick() - a->sent) < arq_timeout) {
+			continue;
+		}
+		if (a->tries == ARQ_MAX_TRIES) {
+			// give up on it
+			a->tries = 0;
+			continue;
+		}
+		a->tries++;
+		a->lost = false;
+		a->sent = timer2_tick();
+		if (queue_count != 0) {
+			// the resend goes first. The frame built ahead
+			// has no sequence number yet, and its bytes are
+			// still held, so read them again later
+			serial_read_rewind(tx_frame.pos);
+			queue_count = 0;
+			split_rest = 0;
+			mav_pkt_len = 0;
+			slip_waiting = false;
+		}
+		serial_read_held(a->pos, tx_frame.data, a->len);
+		tx_frame.pos = a->pos;
+		tx_frame.len = a->len;
+		current_seq = a->seq;
+		arq_release();
+		return true;
+	}
+	arq_release();
+	return false;
+}
+
+// hand out the frame in tx_frame, giving it a sequence number if ARQ
+// is enabled
+static uint8_t
+frame_out(void)
+{
+	__xdata struct arq_frame * __pdata a;
+
+	if (feature_arq) {
+		a = ARQ_SLOT(arq_head + arq_count);
+		arq_count++;
+		a->pos = tx_frame.pos;
+		a->len = tx_frame.len;
+		a->seq = arq_seq;
+		a->tries = arq_broadcast ? 0 : 1;
+		a->lost = false;
+		a->sent = timer2_tick();
+		current_seq = arq_seq++;
+	}
+	return tx_frame.len;
+}
+
+// capture a pending injected reply into tx_frame
+static void
+inject_capture(void)
+{
+	printf_start_capture(tx_frame.data, sizeof(tx_frame.data));
+	if (inject_pending == INJECT_AT) {
+		at_cmd_ready = true;
+		at_command();
+	} else {
+		param_print(inject_pending);
+	}
+	tx_frame.len = printf_end_capture();
+	inject_pending = INJECT_NONE;
+
+	if (tx_frame.len > 0) {
+		last_sent_is_resend = false;
+		injected_packet = true;
+	}
+}
+
+// return the length of the next packet to be sent
+uint8_t
+packet_get_next(register uint8_t max_xmit)
+{
+	register uint16_t slen;
+	
+#ifdef WATCH_DOG_ENABLE
+	// Kick the Watchdog
+	PCA0CPH5 = 0;
+#endif // WATCH_DOG_ENABLE
+	
+	// with ARQ only the frames that are actually lost are resent
+	slen = serial_read_available();
+	if (force_resend ||
+	    (!feature_arq &&
+		feature_opportunistic_resend &&
+		last_sent_is_resend == false && 
+		tx_frame.len != 0 && 
+		queue_count == 0 &&
+		slen < PACKET_RESEND_THRESHOLD))
+	{
+		force_resend = false;
+		if (max_xmit < tx_frame.len) {
+			tx_frame.len = 0;
+			return 0;
+		}
+		last_sent_is_resend = true;
+		slen = tx_frame.len;
+		tx_frame.len = 0;
+		return (slen & 0xFF);
+	}
+	last_sent_is_resend = false;
+
+	if (split_rest != 0) {
+		// the first part of a split frame has gone. Bring the
+		// rest down to the start of tx_frame
+		tx_frame.len = split_rest;
+		for (slen = 0; slen < split_rest; slen++) {
+			tx_frame.data[slen] = tx_frame.data[sizeof(tx_frame.data) - split_rest + slen];
+		}
+		split_rest = 0;
+	}
+
+	if (inject_pending != INJECT_NONE && queue_count == 0) {
+		inject_capture();
+	}
+
+	if (injected_packet) {
+		// send a previously injected packet
+		// if we can't send the full packet, wait..
+		if (max_xmit < tx_frame.len) {
+			return 0;
+		}
+		injected_packet = false;
+		last_sent_is_injected = true;
+		return tx_frame.len;
+	}
+	last_sent_is_injected = false;
+
+	if (feature_arq) {
+		if (arq_resend(max_xmit)) {
+			last_sent_is_resend = true;
+			return tx_frame.len;
+		}
+		if (arq_count == ARQ_WINDOW) {
+			// wait for the oldest frames to be acknowledged
+			return 0;
+		}
+	}
+
+	if (queue_count == 0) {
+		// nothing was built ahead of time. Anything built now
+		// replaces the frame kept for resends
+		packet_build(max_xmit);
+		if (queue_count == 0) {
+			return 0;
+		}
+	}
+
+	if (tx_frame.len > max_xmit) {
+		// it was built for a bigger window than we have
+		// left. Send the start of it and move the rest to the
+		// end of tx_frame, where the trailer can't reach as
+		// the frame was built with room for it
+		max_xmit = frame_split(&tx_frame, max_xmit);
+		if (max_xmit == 0) {
+			return 0;
+		}
+		split_rest = tx_frame.len - max_xmit;
+		for (slen = split_rest; slen != 0; slen--) {
+			tx_frame.data[sizeof(tx_frame.data) - split_rest + slen - 1] =
+				tx_frame.data[max_xmit + slen - 1];
+		}
+		tx_frame.len = max_xmit;
+		max_xmit = frame_out();
+		tx_frame.pos += max_xmit;
+		return max_xmit;
+	}
+
+	queue_count = 0;
+	return frame_out();
+}
+
+// the frame last returned by packet_get_next()
+__xdata uint8_t *
+packet_frame(void)
+{
+	return tx_frame.data;
+}
+
+// build a frame ahead of time if there is enough serial data to fill
+// it, and nothing else needs tx_frame
+void
+packet_queue_fill(register uint8_t max_xmit)
+{
+	if (serial_gap != 0) {
+		gap_update();
+	}
+	if (max_xmit != 0 &&
+	    queue_count == 0 &&
+	    !injected_packet &&
+	    inject_pending == INJECT_NONE &&
+	    !force_resend &&
+	    !(feature_arq && arq_count == ARQ_WINDOW) &&
+	    serial_read_available() >= max_xmit) {
+		packet_build(max_xmit);
+	}
+}
+
+// whether ARQ keeps the data of the packet on the air, so tx_frame
+// can be reused before we know if it has to be sent again
+bool
+packet_resend_held(void)
+{
+	return feature_arq && !arq_broadcast;
+}
+
+// the number of bytes waiting in the frame queue
+uint16_t
+packet_queue_bytes(void)
+{
+	if (split_rest != 0) {
+		return split_rest;
+	}
+	return queue_count ? tx_frame.len : 0;
 }
 
 // return true if the packet currently being sent
@@ -330,11 +865,122 @@ packet_is_injected(void)
 	return last_sent_is_injected;
 }
 
-// force the last packet to be resent. Used when transmit fails
+// the ARQ sequence number of the packet currently being sent
+uint8_t
+packet_seq(void)
+{
+	return current_seq;
+}
+
+// set how long to wait for an acknowledgement before resending
+void
+packet_set_arq_timeout(__pdata uint16_t ticks)
+{
+	arq_timeout = ticks;
+}
+
+// note an ARQ frame from another node, and whether we already have it
+bool
+packet_arq_is_duplicate(__pdata uint16_t src, __pdata uint8_t seq)
+{
+	__xdata struct packet_peer * __pdata p;
+	register uint8_t d;
+
+	if (src >= PACKET_MAX_PEERS) {
+		return false;
+	}
+	p = &peers[src];
+	d = seq - p->seq;
+	if (!(p->state & PEER_SEEN) || (d > 8 && d < 256-8)) {
+		// first frame, or too far from the last one to be a
+		// resend. The sender has restarted
+		p->seq = seq;
+		p->bits = 0;
+		p->state |= PEER_SEEN | PEER_PENDING;
+		return false;
+	}
+	p->state |= PEER_PENDING;
+	if (d == 0) {
+		return true;
+	}
+	if (d <= 8) {
+		// newer than anything so far
+		p->bits = (p->bits << d) | (1 << (d-1));
+		p->seq = seq;
+		return false;
+	}
+	// a resend of an older frame
+	d = (uint8_t)(p->seq - seq) - 1;
+	if (p->bits & (1 << d)) {
+		return true;
+	}
+	p->bits |= 1 << d;
+	return false;
+}
+
+// fill in an acknowledgement for the next node that is waiting for one
+void
+packet_arq_get_ack(__pdata struct packet_ack * __pdata ack)
+{
+	__xdata struct packet_peer * __pdata p;
+	register uint8_t i;
+
+	for (i = 0; i < PACKET_MAX_PEERS; i++) {
+		p = &peers[arq_ack_next];
+		if (p->state & PEER_PENDING) {
+			p->state &= ~PEER_PENDING;
+			ack->node = arq_ack_next;
+			ack->seq = p->seq;
+			ack->bits = p->bits;
+			arq_ack_next = (arq_ack_next + 1) % PACKET_MAX_PEERS;
+			return;
+		}
+		arq_ack_next = (arq_ack_next + 1) % PACKET_MAX_PEERS;
+	}
+	ack->node = PACKET_ACK_NONE;
+}
+
+// take an acknowledgement of our frames from another node
+void
+packet_arq_put_ack(__pdata struct packet_ack * __pdata ack)
+{
+	__xdata struct arq_frame * __pdata a;
+	register uint8_t i, d;
+
+	for (i = 0; i < arq_count; i++) {
+		a = ARQ_SLOT(arq_head + i);
+		if (a->tries == 0) {
+			continue;
+		}
+		d = ack->seq - a->seq;
+		if (d == 0 ||
+		    (d <= 8 && (ack->bits & (1 << (d-1))))) {
+			a->tries = 0;
+		} else if (d < 128) {
+			// later frames got there, but this one didn't
+			a->lost = true;
+		}
+	}
+	arq_release();
+}
+
+// force the last packet to be resent. Used when transmit fails.
+// Nothing is built ahead over it while it is on the air, see
+// packet_resend_held(), and with ARQ the lost frames are resent
+// anyway, unless they were broadcast
 void
 packet_force_resend(void)
 {
-	force_resend = true;
+	if ((!feature_arq || arq_broadcast) && (queue_count == 0 || split_rest != 0)) {
+		force_resend = true;
+	}
+}
+
+// set whether data goes to every node
+void
+packet_set_broadcast(bool broadcast)
+{
+	arq_broadcast = broadcast;
 }
 
 // set the maximum size of a packet
@@ -344,6 +990,13 @@ packet_set_max_xmit(uint8_t max)
 	mav_max_xmit = max;
 }
 
+// set the serial gap in byte times
+void
+packet_set_serial_gap(uint8_t bytes)
+{
+	serial_gap = bytes;
+}
+
 // set the serial speed in bytes/s
 void
 packet_set_serial_speed(uint16_t speed)
@@ -352,29 +1005,38 @@ packet_set_serial_speed(uint16_t speed)
 	serial_rate = (65536UL / speed) + 1;
 }
 
-// determine if a received packet is a duplicate
+// determine if a received packet is a duplicate. A resend is only
+// ever of the last packet its sender sent, so it is enough to keep
+// the crc of the last packet from each node. Without opportunistic
+// resend a node only resends a packet that failed to go out, so a new
+// packet just leaves nothing to match and the crc is only worked out
+// for resends
 bool 
-packet_is_duplicate(uint8_t len, __xdata uint8_t * __pdata buf, bool is_resend)
+packet_is_duplicate(__pdata uint16_t src, uint8_t len, __xdata uint8_t * __pdata buf, bool is_resend)
 {
-	if (!is_resend) {
-		memcpy(last_received, buf, len);
-		last_recv_len = len;
-		last_recv_is_resend = false;
+	__xdata struct packet_peer * __pdata p;
+	register uint16_t crc;
+
+	if (src >= PACKET_MAX_PEERS) {
 		return false;
 	}
-	if (last_recv_is_resend == false && 
-		len == last_recv_len &&
-		memcmp(last_received, buf, len) == 0) {
-		last_recv_is_resend = false;
+	p = &peers[src];
+	if (!is_resend && !feature_opportunistic_resend) {
+		p->state &= ~PEER_RECEIVED;
+		return false;
+	}
+	crc = crc16(len, buf);
+	if (is_resend &&
+	    (p->state & PEER_RECEIVED) &&
+	    len == p->len &&
+	    crc == p->crc) {
 		return true;
 	}
-#if 0
-	printf("RS(%u,%u)[", (unsigned)len, (unsigned)last_recv_len);
-	serial_write_buf(last_received, last_recv_len);
-	serial_write_buf(buf, len);
-	printf("]\r\n");
-#endif
-	last_recv_is_resend = true;
+	// a new packet, or a resend of one we missed. Either way later
+	// resends of it are duplicates
+	p->crc = crc;
+	p->len = len;
+	p->state |= PEER_RECEIVED;
 	return false;
 }
 
@@ -383,14 +1045,9 @@ void
 packet_ati5_inject(__pdata uint8_t ati5_id)
 {
 	if (ati5_id < PARAM_MAX) {
-		printf_start_capture(last_sent, sizeof(last_sent));
-		param_print(ati5_id);
-		last_sent_len = printf_end_capture();
-		
-		if(last_sent_len>0)
-		{
-			last_sent_is_resend = false;
-			injected_packet = true;
+		inject_pending = ati5_id;
+		if (queue_count == 0) {
+			inject_capture();
 		}
 	}
 	
@@ -404,15 +1061,9 @@ packet_ati5_inject(__pdata uint8_t ati5_id)
 void
 packet_at_inject(void)
 {
-	at_cmd_ready = true;
-	printf_start_capture(last_sent, sizeof(last_sent));
-	at_command();
-	last_sent_len = printf_end_capture();
-	
-	if (last_sent_len > 0)
-	{
-		last_sent_is_resend = false;
-		injected_packet = true;
+	inject_pending = INJECT_AT;
+	if (queue_count == 0) {
+		inject_capture();
 	}
 }
 
@@ -420,11 +1071,15 @@ packet_at_inject(void)
 void 
 packet_inject(__xdata uint8_t * __pdata buf, __pdata uint8_t len)
 {
-	if (len > sizeof(last_sent)) {
-		len = sizeof(last_sent);
+	if (queue_count != 0) {
+		// tx_frame holds a frame built ahead
+		return;
+	}
+	if (len > sizeof(tx_frame.data)) {
+		len = sizeof(tx_frame.data);
 	}
-	memcpy(last_sent, buf, len);
-	last_sent_len = len;
+	memcpy(tx_frame.data, buf, len);
+	tx_frame.len = len;
 	last_sent_is_resend = false;
 	injected_packet = true;
 }
@@ -27,13 +27,90 @@
 //
 
 
-/// return the next packet to be sent
+/// take the next packet to be sent from the transmit queue, building
+/// one from the serial port if none is queued. The packet is then
+/// available from packet_frame()
 ///
 /// @param max_xmit		maximum bytes that can be sent
-/// @param buf			buffer to put bytes in
 ///
 /// @return			number of bytes to send
-extern uint8_t packet_get_next(register uint8_t max_xmit, __xdata uint8_t * __pdata buf);
+extern uint8_t packet_get_next(register uint8_t max_xmit);
+
+/// the packet returned by packet_get_next(). The buffer holds
+/// MAX_PACKET_LENGTH bytes, so the tdm trailer can be added after the
+/// data before it is handed to the radio
+///
+/// @return			the packet data
+extern __xdata uint8_t * packet_frame(void);
+
+/// build a packet from the serial port ahead of time, so it is ready
+/// when our transmit window opens. Only full packets are built, so the
+/// serial data keeps collecting into large packets while we wait.
+///
+/// The queue holds a single packet, not several: it is built in the
+/// same buffer that packet_frame() returns, which also keeps the last
+/// packet for packet_force_resend(). Building one while a packet is on
+/// the air replaces that copy, so only do so if packet_resend_held()
+///
+/// @param max_xmit		size of the packet to build
+///
+extern void packet_queue_fill(register uint8_t max_xmit);
+
+/// whether the data of the last packet stays held for a resend
+/// whatever is built after it. True with ARQ, unless the data is
+/// broadcast
+///
+/// @return			true if a packet may be built while the
+///				last one is still on the air
+extern bool packet_resend_held(void);
+
+/// the number of serial bytes that have been built into queued packets
+///
+/// @return			bytes waiting in the transmit queue
+extern uint16_t packet_queue_bytes(void);
+
+/// return the ARQ sequence number of the last packet
+///
+/// @return			sequence number, only valid with ARQ
+///				for packets of serial data
+extern uint8_t packet_seq(void);
+
+/// set how long to wait for an ARQ acknowledgement before resending
+///
+/// @param ticks		timeout in 16usec ticks
+///
+extern void packet_set_arq_timeout(__pdata uint16_t ticks);
+
+/// acknowledgement of the ARQ packets received from one node, sent
+/// with every packet when ARQ is enabled
+struct packet_ack {
+	uint8_t	node;		///< node being acknowledged, or PACKET_ACK_NONE
+	uint8_t	seq;		///< latest sequence number received from it
+	uint8_t	bits;		///< bit n set if seq-1-n was received too
+};
+
+#define PACKET_ACK_NONE	0xFF
+
+/// note a received ARQ packet, and determine if it is a duplicate
+///
+/// @param src			the node that sent it
+/// @param seq			its sequence number
+///
+/// @return			true if this is a duplicate
+extern bool packet_arq_is_duplicate(__pdata uint16_t src, __pdata uint8_t seq);
+
+/// fill in the acknowledgement to send with our next packet
+///
+/// @param ack			filled in, node is PACKET_ACK_NONE if
+///				nothing needs acknowledging
+///
+extern void packet_arq_get_ack(__pdata struct packet_ack * __pdata ack);
+
+/// take an acknowledgement of our packets from another node
+///
+/// @param ack			the acknowledgement
+///
+extern void packet_arq_put_ack(__pdata struct packet_ack * __pdata ack);
 
 /// return true if the last packet was a resend
 ///
@@ -45,10 +122,16 @@ extern bool packet_is_resend(void);
 /// @return			true is injected
 extern bool packet_is_injected(void);
 
-/// determine if a received packet is a duplicate
+/// determine if a received packet is a duplicate, by comparing it
+/// with the last packet received from the same node
+///
+/// @param src			the node that sent it
+/// @param len			packet length
+/// @param buf			packet data
+/// @param is_resend		the sender marked it as a resend
 ///
 /// @return			true if this is a duplicate
-extern bool packet_is_duplicate(uint8_t len, __xdata uint8_t * __pdata buf, bool is_resend);
+extern bool packet_is_duplicate(__pdata uint16_t src, uint8_t len, __xdata uint8_t * __pdata buf, bool is_resend);
 
 /// force the last packet to be re-sent. Used when packet transmit has
 /// failed
@@ -58,22 +141,43 @@ extern void packet_force_resend(void);
 ///
 extern void packet_set_max_xmit(uint8_t max);
 
+/// set whether data goes to every node. ARQ sends broadcast data once,
+/// as an acknowledgement from one node can't speak for the others
+///
+/// @param broadcast		true if NODEDESTINATION is broadcast
+///
+extern void packet_set_broadcast(bool broadcast);
+
 /// set the serial rate in bytes/s
 ///
 /// @param  speed		serial speed bytes/s
 ///
 extern void packet_set_serial_speed(uint16_t speed);
 
+/// the longest SERIAL_GAP, which keeps the gap in 16 bits of timer2
+/// ticks down to 1200 baud
+#define PACKET_MAX_SERIAL_GAP	100
+
+/// set how long a gap in the serial data has to be before a transparent
+/// mode packet is sent without being full
+///
+/// @param  bytes		the gap in byte times, or 0 to send data as
+///				soon as it arrives
+///
+extern void packet_set_serial_gap(uint8_t bytes);
+
 /// inject a ati5 packet to be sent when possible
 /// @param ati5_id		id of the parameter to send
 ///
 extern void packet_ati5_inject(__pdata uint8_t ati5_id);
 
-/// inject a at packet to be sent when possible
+/// inject a at packet to be sent when possible. The command runs once
+/// a packet built ahead has gone
 ///
 extern void packet_at_inject(void);
 
-/// inject a packet to be sent when possible
+/// inject a packet to be sent when possible. Dropped if a packet has
+/// been built ahead
 /// @param buf			buffer to send
 /// @param len			number of bytes
 ///			
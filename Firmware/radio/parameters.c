@@ -43,6 +43,8 @@
 #include "radio.h"
 #include "tdm.h"
 #include "crc.h"
+#include "packet.h"
+#include "freq_hopping.h"
 #include <flash_layout.h>
 
 /// In-ROM parameter info table. Changed by ATS commands
@@ -70,6 +72,13 @@ __code const struct parameter_info {
 /*16*/  {"NODEDESTINATION", 65535},
 /*17*/  {"SYNCANY",  0}, // The amount of nodes in the network, this may could become auto discovery later.
 /*18*/  {"NODECOUNT",  2}, // The amount of nodes in the network, this may could become auto discovery later.
+/*19*/  {"DEMANDSLOTS",  0},
+/*20*/  {"ARQ",  0},
+/*21*/  {"COMPRESS",  0},
+/*22*/  {"SERIAL_GAP",  0},
+/*23*/  {"ADAPTIVE_RATE",  0},
+/*24*/  {"ADAPTIVE_HOP",  0},
+/*25*/  {"SYNC_ROUNDS",  1},
 };
 
 /// In-RAM parameter store.
@@ -81,6 +90,8 @@ __code const struct parameter_info {
 __code const pins_user_info_t pins_defaults = PINS_USER_INFO_DEFAULT;
 __xdata param_t	 parameter_values[PARAM_MAX];
 pins_user_info_t pin_values[PIN_MAX];
+__xdata uint8_t node_weights[MAX_SLOT_NODES];
+__xdata static struct param_timing timing[PARAM_TIMING_RATES];
 
 static bool
 param_check(__pdata enum ParamID id, __data uint32_t val)
@@ -97,10 +108,22 @@ param_check(__pdata enum ParamID id, __data uint32_t val)
 			return serial_device_valid_speed(val);
 
 		case PARAM_AIR_SPEED:
+		case PARAM_ADAPTIVE_RATE:
 			if (val > 256)
 				return false;
 			break;
 
+		case PARAM_ADAPTIVE_HOP:
+			// at least half the channels are always kept
+			if (val > MAX_FREQ_CHANNELS/2)
+				return false;
+			break;
+
+		case PARAM_SYNC_ROUNDS:
+			if (val < 1 || val > 16)
+				return false;
+			break;
+
 		// NodeDestination can be set to broadcast 65535 otherwise must be a node id.
 		case PARAM_NODEDESTINATION:
 			if(val == 0xFFFF) 
@@ -126,10 +149,29 @@ param_check(__pdata enum ParamID id, __data uint32_t val)
 				return false;
 			break;
 
-		case PARAM_ECC:
 		case PARAM_MAVLINK:
+			// 2 is MAVLink framing with priority scheduling,
+			// 3 is SLIP framing
+			if (val > 3)
+				return false;
+			break;
+
+		case PARAM_SERIAL_GAP:
+			if (val > PACKET_MAX_SERIAL_GAP)
+				return false;
+			break;
+
+		case PARAM_ECC:
+			// 2 chooses per packet
+			if (val > 2)
+				return false;
+			break;
+
 		case PARAM_OPPRESEND:
 		case PARAM_SYNCANY:
+		case PARAM_DEMANDSLOTS:
+		case PARAM_ARQ:
+		case PARAM_COMPRESS:
 			// boolean 0/1 only
 			if (val > 1)
 				return false;
@@ -173,8 +215,9 @@ param_set(__data enum ParamID param, __pdata param_t value)
 			break;
 
 		case PARAM_MAVLINK:
-			feature_mavlink_framing = value?true:false;
-			value = feature_mavlink_framing?1:0;
+			feature_mavlink_framing = (value == 1 || value == 2);
+			feature_mavlink_priority = (value == 2);
+			feature_slip_framing = (value == 3);
 			break;
 
 		case PARAM_OPPRESEND:
@@ -202,6 +245,22 @@ param_set(__data enum ParamID param, __pdata param_t value)
 		case PARAM_SYNCANY:
 			tdm_set_sync_any(value);
 			break;
+
+		case PARAM_SERIAL_GAP:
+			packet_set_serial_gap(value);
+			break;
+
+		case PARAM_ADAPTIVE_RATE:
+			tdm_set_adaptive_rate(value);
+			break;
+
+		case PARAM_ADAPTIVE_HOP:
+			fhop_set_max_excluded(value);
+			break;
+
+		case PARAM_SYNC_ROUNDS:
+			tdm_set_sync_rounds(value);
+			break;
 			
 		default:
 			break;
@@ -212,6 +271,25 @@ param_set(__data enum ParamID param, __pdata param_t value)
 	return true;
 }
 
+bool
+param_set_weight(__pdata uint8_t node, __pdata param_t weight)
+{
+	if (node >= MAX_SLOT_NODES || weight > 0xFF)
+		return false;
+
+	node_weights[node] = weight;
+	tdm_update_schedule();
+	return true;
+}
+
+uint8_t
+param_get_weight(__pdata uint8_t node)
+{
+	if (node >= MAX_SLOT_NODES)
+		return 0;
+	return node_weights[node];
+}
+
 param_t
 param_get(__data enum ParamID param)
 {
@@ -220,6 +298,55 @@ param_get(__data enum ParamID param)
 	return parameter_values[param];
 }
 
+// read the timing table from the scratchpad, clearing it if it is not
+// there or does not match its checksum
+static void
+param_timing_load(void)
+{
+	__pdata uint16_t	j, sum;
+
+	for (j = 0; j < sizeof(timing); j++) {
+		((__xdata uint8_t *)timing)[j] = flash_read_scratch(PARAM_TIMING_OFFSET+j);
+	}
+	sum = flash_read_scratch(PARAM_TIMING_OFFSET+j)<<8 | flash_read_scratch(PARAM_TIMING_OFFSET+j+1);
+	if (sum != crc16(sizeof(timing), (__xdata uint8_t *)timing)) {
+		memset(timing, 0, sizeof(timing));
+	}
+}
+
+__xdata struct param_timing *
+param_timing_find(__pdata uint8_t air_rate)
+{
+	__pdata uint8_t i;
+
+	for (i = 0; i < PARAM_TIMING_RATES; i++) {
+		if (timing[i].air_rate == air_rate) {
+			return &timing[i];
+		}
+	}
+	return NULL;
+}
+
+void
+param_timing_set(__pdata uint8_t air_rate, __pdata uint8_t ecc,
+		 __pdata uint16_t packet_latency, __pdata uint16_t ticks_per_byte)
+{
+	__xdata struct param_timing *t;
+
+	t = param_timing_find(air_rate);
+	if (t == NULL) {
+		// take a free entry
+		t = param_timing_find(0);
+		if (t == NULL) {
+			return;
+		}
+		memset(t, 0, sizeof(*t));
+		t->air_rate = air_rate;
+	}
+	t->packet_latency[ecc] = packet_latency;
+	t->ticks_per_byte[ecc] = ticks_per_byte;
+}
+
 bool
 param_load(void)
 __critical {
@@ -229,6 +356,10 @@ __critical {
 	// start with defaults
 	param_default();
 
+	// the timing table is kept whatever happens to the parameters,
+	// and just forgotten if it does not check out
+	param_timing_load();
+
 	// loop reading the parameters array
 	for (i = 1; i < sizeof(parameter_values)+1; i++) {
 		((uint8_t *)parameter_values)[i-1] = flash_read_scratch(i);
@@ -250,6 +381,18 @@ __critical {
 	sum = flash_read_scratch(i)<<8 | flash_read_scratch(i+1);
 	if (sum != crc16(sizeof(pin_values), ((__xdata uint8_t *)pin_values)))
 		return false;
+
+	i+=2;
+
+	// loop reading the node_weights array (sizeof node_weights, pin_values, parameters and checksums)
+	for (; i < sizeof(node_weights)+sizeof(pin_values)+sizeof(parameter_values)+5; i++) {
+		node_weights[i-sizeof(pin_values)-sizeof(parameter_values)-5] = flash_read_scratch(i);
+	}
+
+	// verify node_weights checksum
+	sum = flash_read_scratch(i)<<8 | flash_read_scratch(i+1);
+	if (sum != crc16(sizeof(node_weights), node_weights))
+		return false;
 	
 	// decide whether we read a supported version of the structure
 	if (param_get(PARAM_FORMAT) != PARAM_FORMAT_CURRENT) {
@@ -270,7 +413,7 @@ void
 param_save(void)
 __critical {
 	__pdata uint8_t		i;
-	__pdata uint16_t	sum;
+	__pdata uint16_t	sum, j;
 
 	// tag parameters with the current format
 	parameter_values[PARAM_FORMAT] = PARAM_FORMAT_CURRENT;
@@ -302,6 +445,27 @@ __critical {
 	// write checksum
 	flash_write_scratch(i, sum>>8);
 	flash_write_scratch(i+1, sum&0xFF);
+
+	i+=2;
+
+	// save node_weights to the scratch page (sizeof node_weights, pin_values, parameters and checksums)
+	for (; i < sizeof(node_weights)+sizeof(pin_values)+sizeof(parameter_values)+5; i++) {
+		flash_write_scratch(i, node_weights[i-sizeof(pin_values)-sizeof(parameter_values)-5]);
+	}
+
+	sum = crc16(sizeof(node_weights), node_weights);
+
+	// write checksum
+	flash_write_scratch(i, sum>>8);
+	flash_write_scratch(i+1, sum&0xFF);
+
+	// save the timing table at its own offset
+	for (j = 0; j < sizeof(timing); j++) {
+		flash_write_scratch(PARAM_TIMING_OFFSET+j, ((__xdata uint8_t *)timing)[j]);
+	}
+	sum = crc16(sizeof(timing), (__xdata uint8_t *)timing);
+	flash_write_scratch(PARAM_TIMING_OFFSET+j, sum>>8);
+	flash_write_scratch(PARAM_TIMING_OFFSET+j+1, sum&0xFF);
 }
 
 void
@@ -321,6 +485,11 @@ param_default(void)
 		pin_values[i].pin_dir = pins_defaults.pin_dir;
 		pin_values[i].pin_mirror = pins_defaults.pin_mirror;
 	}
+
+	// every node gets the same window
+	for (i = 0; i < MAX_SLOT_NODES; i++) {
+		node_weights[i] = 1;
+	}
 }
 
 void
@@ -65,11 +65,18 @@ enum ParamID {
         PARAM_NODEDESTINATION,// packet destination
         PARAM_SYNCANY,        // Let this node sync from any in the network not just the base
         PARAM_NODECOUNT,      // number of sequential nodes in the network
+        PARAM_DEMANDSLOTS,    // size transmit windows by each nodes serial backlog
+        PARAM_ARQ,            // acknowledge and retransmit lost packets
+        PARAM_COMPRESS,       // compress MAVLink headers over the air
+        PARAM_SERIAL_GAP,     // serial gap in bytes that ends a transparent mode packet
+        PARAM_ADAPTIVE_RATE,  // slowest air rate the base may fall back to, 0 for a fixed rate
+        PARAM_ADAPTIVE_HOP,   // most channels to leave out of the hopping for poor quality
+        PARAM_SYNC_ROUNDS,    // rounds between syncs from the base
         PARAM_MAX             // must be last
 };
 
 
-#define PARAM_FORMAT_CURRENT	0x1BUL	//< current parameter format ID
+#define PARAM_FORMAT_CURRENT	0x23UL	//< current parameter format ID
 
 /// Parameter type.
 ///
@@ -77,6 +84,7 @@ enum ParamID {
 ///
 typedef uint32_t	param_t;
 extern  struct pins_user_info pin_values[];
+extern __xdata uint8_t node_weights[];
 /// Set a parameter
 ///
 /// @note Parameters are not saved until param_save is called.
@@ -95,6 +103,23 @@ extern bool param_set(__data enum ParamID param, __pdata param_t value);
 ///
 extern param_t param_get(__data enum ParamID param);
 
+/// Set the weight of a node's transmit window in the round
+///
+/// @note Weights are saved with the parameters.
+///
+/// @param	node		The node ID.
+/// @param	weight		The weight, 0 gives the node the minimum window.
+/// @return			True if the node and weight are valid.
+///
+extern bool param_set_weight(__pdata uint8_t node, __pdata param_t weight);
+
+/// Get the weight of a node's transmit window
+///
+/// @param	node		The node ID.
+/// @return			The weight, or zero if the node is invalid.
+///
+extern uint8_t param_get_weight(__pdata uint8_t node);
+
 /// Look up a parameter by name
 ///
 /// @param	name		The parameter name
@@ -131,6 +156,37 @@ extern void param_default(void);
 ///
 extern void param_print(__data uint8_t id);
 
+/// TDM timing measured on this board by AT&T=TIMING, for one air rate
+/// without and with golay ECC. A zero packet_latency means that
+/// setting has not been measured
+struct param_timing {
+	uint8_t		air_rate;		///< kbps, 0 for an unused entry
+	uint16_t	packet_latency[2];	///< 16usec ticks for an empty packet
+	uint16_t	ticks_per_byte[2];	///< 16usec ticks per payload byte
+};
+
+/// one entry for each air rate radio_configure() can choose
+#define PARAM_TIMING_RATES	13
+
+/// where the timing table lives in the flash scratchpad, clear of the
+/// parameters so it survives a parameter format change
+#define PARAM_TIMING_OFFSET	0x100
+
+/// Find the measured timing for an air rate
+///
+/// @param	air_rate	The air rate, as returned by radio_air_rate()
+/// @return			The entry, or NULL if the rate has not been
+///				measured
+///
+extern __xdata struct param_timing * param_timing_find(__pdata uint8_t air_rate);
+
+/// Record the measured timing for an air rate and ECC setting
+///
+/// @note The table is not saved until param_save is called.
+///
+extern void param_timing_set(__pdata uint8_t air_rate, __pdata uint8_t ecc,
+			     __pdata uint16_t packet_latency, __pdata uint16_t ticks_per_byte);
+
 /// convenient routine to constrain parameter values
 uint32_t constrain(__pdata uint32_t v, __pdata uint32_t min, __pdata uint32_t max);
 
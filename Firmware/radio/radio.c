@@ -35,16 +35,50 @@
 #include "golay.h"
 #include "crc.h"
 
-__xdata uint8_t radio_buffer[MAX_PACKET_LENGTH];
-__pdata uint8_t receive_packet_length;
 __pdata uint8_t partial_packet_length;
 __pdata uint8_t last_rssi;
+
+// received packets waiting for radio_receive_packet(). The radio
+// interrupt fills the slot at rx_insert and moves straight on to the
+// next one, so a packet can arrive before the last one is collected.
+// The receiver only stops when every slot is full.
+//
+// The slot at rx_insert is also the transmit buffer. The receiver is
+// off while we transmit and only starts filling the slot again once
+// the packet has gone, so transmitting costs no buffer of its own
+#define RX_SLOTS 2
+struct rx_slot {
+	uint8_t length;
+	uint8_t rssi;
+	uint8_t fec;		// the FEC header byte, with feature_adaptive_fec
+	uint8_t data[MAX_PACKET_LENGTH];
+};
+__xdata static struct rx_slot rx_ring[RX_SLOTS];
+__pdata static volatile uint8_t rx_insert, rx_remove, rx_count;
+
+// RSSI of the packet last returned by radio_receive_packet()
+__pdata static uint8_t packet_rssi;
 __pdata uint8_t netid[2];
 __pdata uint16_t nodeId;
 
-static volatile __bit packet_received;
+static volatile __bit receive_stopped;
+
+// with feature_adaptive_fec the third header byte says how each packet
+// is coded, and the hardware CRC is off as it is for golay
+#define FEC_HEADER_GOLAY 1
+static __bit transmit_fec;
 static volatile __bit preamble_detected;
 
+// state of the interrupt driven transmitter. The packet being sent is
+// in the free receive slot, see above
+static volatile __bit transmit_busy;
+static volatile __bit transmit_ok;
+__pdata static volatile uint8_t transmit_length;
+__pdata static volatile uint8_t transmit_offset;
+static __xdata uint8_t * __pdata transmit_buffer;
+__pdata static uint16_t transmit_tstart;
+__pdata static uint16_t transmit_timeout;
+
 __pdata struct radio_settings settings;
 
 
@@ -52,6 +86,8 @@ __pdata struct radio_settings settings;
 //
 static void	register_write(uint8_t reg, uint8_t value) __reentrant;
 static uint8_t	register_read(uint8_t reg);
+static void	register_write_pair(uint8_t reg, uint8_t value1, uint8_t value2) __reentrant;
+static uint16_t	register_read_pair(uint8_t reg) __reentrant;
 static bool	software_reset(void);
 static void	set_frequency_registers(uint32_t frequency);
 static uint32_t scale_uint32(uint32_t value, uint32_t scale);
@@ -63,13 +99,40 @@ static void	clear_status_registers(void);
 #define EX0_SAVE_DISABLE __bit EX0_saved = EX0; EX0 = 0
 #define EX0_RESTORE EX0 = EX0_saved
 
+// burst SPI access. The radio increments the register address after
+// each byte for as long as NSS is held low (except for the FIFO, which
+// stays put), so consecutive registers can be written in one
+// transaction rather than paying the address byte and NSS toggle for
+// each of them
+#define SPI_BURST_START(_address) do { NSS1 = 0; SPIF1 = 0; SPI1DAT = (_address); } while (0)
+#define SPI_BURST_WRITE(_value) do { while (!TXBMT1); SPI1DAT = (_value); } while (0)
+#define SPI_BURST_END() do { while (!TXBMT1); while ((SPI1CFG & 0x80) == 0x80); SPIF1 = 0; NSS1 = 1; } while (0)
+
 #define RADIO_RX_INTERRUPTS (EZRADIOPRO_ENRXFFAFULL|EZRADIOPRO_ENPKVALID|EZRADIOPRO_ENCRCERROR)
 
-// FIFO thresholds to allow for packets larger than 64 bytes
+// FIFO thresholds to allow for packets larger than 64 bytes. A board
+// may set its own TX low threshold
+#define RADIO_FIFO_SIZE 64
+#ifndef TX_FIFO_THRESHOLD_LOW
 #define TX_FIFO_THRESHOLD_LOW 32
+#endif
 #define TX_FIFO_THRESHOLD_HIGH 60
 #define RX_FIFO_THRESHOLD_HIGH 50
 
+#if TX_FIFO_THRESHOLD_LOW < 8 || TX_FIFO_THRESHOLD_LOW > RADIO_FIFO_SIZE - 8
+#error TX_FIFO_THRESHOLD_LOW out of range
+#endif
+
+// bytes added to the TX FIFO each time it drains to the low
+// threshold. The almost empty interrupt fires as the level falls to
+// the threshold, so when we get it there are at most
+// TX_FIFO_THRESHOLD_LOW bytes left and the rest of the FIFO is free.
+// The old polled refill also topped up whenever ITXFFAFULL was clear,
+// but that is a latched flag cleared by every status read, not the
+// FIFO level, so it wrote into a FIFO that was already full. That is
+// what overflowed, not the size of the refill
+#define TX_FIFO_REFILL (RADIO_FIFO_SIZE - TX_FIFO_THRESHOLD_LOW)
+
 // return a received packet
 //
 // returns true on success, false on no packet available
@@ -80,22 +143,39 @@ radio_receive_packet(uint8_t *length, __xdata uint8_t * __pdata buf)
 	__xdata uint8_t gout[3];
 	__data uint16_t crc1, crc2;
 	__data uint8_t errcount = 0;
-	__data uint8_t elen;
+	__data uint8_t elen, fec;
+	__xdata struct rx_slot *slot;
 //	__data uint16_t destination;
 
-	if (!packet_received) {
+	if (rx_count == 0) {
 		return false;
 	}
 
-	if (receive_packet_length > MAX_PACKET_LENGTH) {
-		radio_receiver_on();
-		goto failed;
+	// take the oldest packet out of the ring. This relies on the
+	// in-place decode properties of the golay code, decoding in
+	// the callers buffer while the receiver carries on
+	slot = &rx_ring[rx_remove];
+	elen = slot->length;
+	packet_rssi = slot->rssi;
+	fec = feature_golay ? FEC_HEADER_GOLAY : 0;
+	if (feature_adaptive_fec) {
+		fec = slot->fec;
+	}
+	memcpy(buf, slot->data, elen);
+	rx_remove = (rx_remove + 1) % RX_SLOTS;
+	{
+		EX0_SAVE_DISABLE;
+		rx_count--;
+		if (receive_stopped) {
+			// there is room again
+			radio_receiver_on();
+		}
+		EX0_RESTORE;
 	}
 
 #if 0
 	// useful for testing high packet loss
 	if ((timer_entropy() & 0x7) != 0) {
-		radio_receiver_on();
 		goto failed;		
 	}
 #endif
@@ -105,24 +185,29 @@ radio_receive_packet(uint8_t *length, __xdata uint8_t * __pdata buf)
 //	printf("DP-%u:%u\n\n", destination, nodeId);
 
 	
-	if (!feature_golay) {
+	if (fec != FEC_HEADER_GOLAY) {
+		if (feature_adaptive_fec) {
+			// our own CRC, with the network ID in it as the
+			// hardware header doesn't check that
+			if (elen < 2) {
+				goto failed;
+			}
+			elen -= 2;
+			crc1 = buf[elen] | (((uint16_t)buf[elen+1])<<8);
+			crc2 = crc16(elen, buf) ^ (netid[0] | (((uint16_t)netid[1])<<8));
+			if (crc1 != crc2) {
+				debug("crc1=%x crc2=%x len=%u\n",
+				       (unsigned)crc1,
+				       (unsigned)crc2,
+				       (unsigned)elen);
+				goto failed;
+			}
+		}
 		// simple unencoded packets
-		*length = receive_packet_length;
-		memcpy(buf, radio_buffer, receive_packet_length);
-		radio_receiver_on();
+		*length = elen;
 		return true;
 	}
 
-	// decode it in the callers buffer. This relies on the
-	// in-place decode properties of the golay code. Decoding in
-	// this way allows us to overlap decoding with the next receive
-	memcpy(buf, radio_buffer, receive_packet_length);
-
-	// enable the receiver for the next packet. This also
-	// enables the EX0 interrupt
-	elen = receive_packet_length;
-	radio_receiver_on();	
-
 	if (elen < 12 || (elen%6) != 0) {
 		// not a valid length
 		debug("rx len invalid %u\n", (unsigned)elen);
@@ -193,22 +278,13 @@ failed:
 // write to the radios transmit FIFO
 //
 static void
-radio_write_transmit_fifo(register uint8_t n, __xdata uint8_t * __pdata buffer)
+radio_write_transmit_fifo(register uint8_t n, __xdata uint8_t * __pdata buffer) __reentrant
 {
-	NSS1 = 0;
-	SPIF1 = 0;
-	SPI1DAT = (0x80 | EZRADIOPRO_FIFO_ACCESS);
-
+	SPI_BURST_START(0x80 | EZRADIOPRO_FIFO_ACCESS);
 	while (n--) {
-		while (!TXBMT1) /* noop */;
-		SPI1DAT = *buffer++;
+		SPI_BURST_WRITE(*buffer++);
 	}
-
-	while (!TXBMT1) /* noop */;
-	while ((SPI1CFG & 0x80) == 0x80);
-
-	SPIF1 = 0;
-	NSS1 = 1;
+	SPI_BURST_END();
 }
 
 // check if a packet is being received
@@ -216,7 +292,7 @@ radio_write_transmit_fifo(register uint8_t n, __xdata uint8_t * __pdata buffer)
 bool
 radio_receive_in_progress(void)
 {
-	if (packet_received ||
+	if (rx_count != 0 ||
 	    partial_packet_length != 0) {
 		return true;
 	}
@@ -251,7 +327,7 @@ radio_preamble_detected(void)
 uint8_t
 radio_last_rssi(void)
 {
-	return last_rssi;
+	return packet_rssi;
 }
 
 // return the current signal strength, for LBT
@@ -273,7 +349,7 @@ radio_air_rate(void)
 // clear the transmit FIFO
 //
 static void
-radio_clear_transmit_fifo(void)
+radio_clear_transmit_fifo(void) __reentrant
 {
 	register uint8_t control;
 	control = register_read(EZRADIOPRO_OPERATING_AND_FUNCTION_CONTROL_2);
@@ -293,167 +369,42 @@ radio_clear_receive_fifo(void) __reentrant
 	register_write(EZRADIOPRO_OPERATING_AND_FUNCTION_CONTROL_2, control & ~EZRADIOPRO_FFCLRRX);
 }
 
-// simple transmit with no golay
-//
-// @param length		number of data bytes to send
-// @param timeout_ticks		number of 16usec RTC ticks to allow
-//				for the send
+// finish a transmit, from the radio interrupt or on timeout
 //
-// @return	    true if packet sent successfully
-//
-static bool
-radio_transmit_simple(__data uint8_t length, __xdata uint8_t * __pdata buf, __pdata uint16_t timeout_ticks)
+static void
+radio_transmit_end(bool ok) __reentrant
 {
-	__pdata uint16_t tstart;
-	bool transmit_started;
-	__data uint8_t n;
-
-	if (length > sizeof(radio_buffer)) {
-		panic("oversized packet");
-	}
-
-	radio_clear_transmit_fifo();
-
-	register_write(EZRADIOPRO_TRANSMIT_PACKET_LENGTH, length);
-
-	// put packet in the FIFO
-	n = length;
-	if (n > TX_FIFO_THRESHOLD_LOW) {
-		n = TX_FIFO_THRESHOLD_LOW;
-	}
-	radio_write_transmit_fifo(n, buf);
-	length -= n;
-	buf += n;
-
-	// no interrupts
-	register_write(EZRADIOPRO_INTERRUPT_ENABLE_1, 0);
-	register_write(EZRADIOPRO_INTERRUPT_ENABLE_2, 0);
-
-	preamble_detected = 0;
-	transmit_started = false;
-
-	// start TX
-	register_write(EZRADIOPRO_OPERATING_AND_FUNCTION_CONTROL_1, EZRADIOPRO_TXON | EZRADIOPRO_XTON);
-#ifdef DEBUG_PINS_RADIO_TX_RX
-	P2 |=  0x01;
-#endif // DEBUG_PINS_RADIO_TX_RX
-	// wait for transmit complete or timeout
-	tstart = timer2_tick();
-	while ((uint16_t)(timer2_tick() - tstart) < timeout_ticks) {
-		__data uint8_t status;
-
-#ifdef WATCH_DOG_ENABLE
-		// Reset Watchdog
-		PCA0CPH5 = 0;
-#endif //_BOARD_RFD900A
-		
-		// see if we can put some more bytes into the FIFO
-		status = register_read(EZRADIOPRO_INTERRUPT_STATUS_1);
-		if (transmit_started && length != 0 && (status & EZRADIOPRO_ITXFFAEM)) {
-			// the FIFO is below the low threshold. We
-			// should be able to put in
-			// 64-TX_FIFO_THRESHOLD_LOW more bytes, but 
-			// it seems that this gives us an occasional
-			// fifo overflow error, so put in just 4 bytes
-			// at a time
-			n = 4;
-			if (n > length) {
-				n = length;
-			}
-			radio_write_transmit_fifo(n, buf);
-			length -= n;
-			buf += n;
-			continue;
+	register_write_pair(EZRADIOPRO_INTERRUPT_ENABLE_1, 0, 0);
+	if (!ok) {
+		// leave TX mode and throw away what is left
+		register_write(EZRADIOPRO_OPERATING_AND_FUNCTION_CONTROL_1, EZRADIOPRO_XTON);
+		radio_clear_transmit_fifo();
+		if (errors.tx_errors != 0xFFFF) {
+			errors.tx_errors++;
 		}
-		if (transmit_started && length != 0 && (status & EZRADIOPRO_ITXFFAFULL) == 0) {
-			// the FIFO is below the high threshold. See
-			// comment above on how many bytes we add to
-			// the FIFO
-			n = 4;
-			if (n > length) {
-				n = length;
-			}
-			radio_write_transmit_fifo(n, buf);
-			length -= n;
-			buf += n;
-			continue;
-		}
-
-		if (status & EZRADIOPRO_IFFERR) {
-			// we ran out of bytes in the FIFO
-			radio_clear_transmit_fifo();
-			debug("FFERR %u\n", (unsigned)length);
-			if (errors.tx_errors != 0xFFFF) {
-				errors.tx_errors++;
-			}
-#ifdef DEBUG_PINS_RADIO_TX_RX
-			P2 &= ~0x01;
-#endif // DEBUG_PINS_RADIO_TX_RX
-			return false;
-		}
-
-		// the interrupt status bits only become valid once
-		// the transmitter is in full tx state
-		status = register_read(EZRADIOPRO_DEVICE_STATUS);
-		if (status & 0x02) {
-			// the chip power status is in TX mode
-			transmit_started = true;
-			continue;
-		}
-		if (transmit_started && (status & 0x02) == 0) {
-			// transmitter has finished. See if we got the
-			// whole packet out
-			if (length != 0) {
-				debug("TX short %u\n", (unsigned)length);
-				if (errors.tx_errors != 0xFFFF) {
-					errors.tx_errors++;
-				}
-#ifdef DEBUG_PINS_RADIO_TX_RX
-				P2 &= ~0x01;
-#endif // DEBUG_PINS_RADIO_TX_RX
-				return false;
-			}
-#ifdef DEBUG_PINS_RADIO_TX_RX
-			P2 &= ~0x01;
-#endif // DEBUG_PINS_RADIO_TX_RX
-			return true;			
-		}
-
 	}
+#ifdef _BOARD_RFD900A
+	PA_ENABLE = 0;		// Set PA_Enable to off the PA after TX cycle
+#endif
 #ifdef DEBUG_PINS_RADIO_TX_RX
 	P2 &= ~0x01;
 #endif // DEBUG_PINS_RADIO_TX_RX
-
-	// transmit timeout ... clear the FIFO
-	debug("TX timeout %u ts=%u tn=%u len=%u\n",
-	       timeout_ticks,
-	       tstart,
-	       timer2_tick(),
-	       (unsigned)length);
-	if (errors.tx_errors != 0xFFFF) {
-		errors.tx_errors++;
-	}
-
-	return false;
+	transmit_ok = ok;
+	transmit_busy = false;
 }
 
-
-// start transmitting a packet from the transmit FIFO
-//
-// @param length		number of data bytes to send
-// @param timeout_ticks		number of 16usec RTC ticks to allow
-//				for the send
+// golay encode a packet into transmit_buffer
 //
-// @return	    true if packet sent successfully
+// @return			the encoded length
 //
-static bool
-radio_transmit_golay(uint8_t length, __xdata uint8_t * __pdata buf, __pdata uint16_t timeout_ticks)
+static uint8_t
+radio_encode_golay(uint8_t length, __xdata uint8_t * __pdata buf)
 {
 	__pdata uint16_t crc;
 	__xdata uint8_t gin[3];
-	__data uint8_t elen, rlen;
+	__data uint8_t rlen;
 
-	if (length > (sizeof(radio_buffer)/2)-6) {
+	if (length > (MAX_PACKET_LENGTH/2)-6) {
 		debug("golay packet size %u\n", (unsigned)length);
 		panic("oversized golay packet");		
 	}
@@ -461,16 +412,13 @@ radio_transmit_golay(uint8_t length, __xdata uint8_t * __pdata buf, __pdata uint
 	// rounded length
 	rlen = ((length+2)/3)*3;
 
-	// encoded length
-	elen = (rlen+6)*2;
-
 	// start of packet is network ID and packet length
 	gin[0] = netid[0];
 	gin[1] = netid[1];
 	gin[2] = length;
 
 	// golay encode the header
-	golay_encode(3, gin, radio_buffer);
+	golay_encode(3, gin, transmit_buffer);
 
 	// next add a CRC, we round to 3 bytes for simplicity, adding 
 	// another copy of the length in the spare byte
@@ -480,45 +428,157 @@ radio_transmit_golay(uint8_t length, __xdata uint8_t * __pdata buf, __pdata uint
 	gin[2] = length;
 
 	// golay encode the CRC
-	golay_encode(3, gin, &radio_buffer[6]);
+	golay_encode(3, gin, &transmit_buffer[6]);
 
 	// encode the rest of the payload
-	golay_encode(rlen, buf, &radio_buffer[12]);
+	golay_encode(rlen, buf, &transmit_buffer[12]);
 
-	return radio_transmit_simple(elen, radio_buffer, timeout_ticks);
+	// encoded length
+	return (rlen+6)*2;
 }
 
-// start transmitting a packet from the transmit FIFO
+// start transmitting a packet. The packet is copied, so buf is free
+// for reuse as soon as this returns. The radio interrupt keeps the
+// FIFO topped up until the packet is sent
 //
 // @param length		number of data bytes to send
 // @param timeout_ticks		number of 16usec RTC ticks to allow
 //				for the send
 //
-// @return	    true if packet sent successfully
+// @return	    true if the transmitter was started
 //
 bool
-radio_transmit(uint8_t length, __xdata uint8_t * __pdata buf, uint16_t destination, __pdata uint16_t timeout_ticks)
+radio_transmit_start(uint8_t length, __xdata uint8_t * __pdata buf, uint16_t destination, __pdata uint16_t timeout_ticks)
 {
-	bool ret;
-	EX0_SAVE_DISABLE;
+	__data uint8_t n;
+
+	EX0 = 0;
+	if (transmit_busy || rx_count == RX_SLOTS) {
+		// still sending, or no free slot to send from until
+		// a received packet is collected
+		EX0 = 1;
+		return false;
+	}
+	transmit_buffer = rx_ring[rx_insert].data;
 
 #ifdef _BOARD_RFD900A
 	PA_ENABLE = 1;		// Set PA_Enable to turn on PA prior to TX cycle
 #endif
 	
-	register_write(EZRADIOPRO_TRANSMIT_HEADER_3, destination >> 8);
-	register_write(EZRADIOPRO_TRANSMIT_HEADER_2, destination & 0xFF);
-	
-	if (!feature_golay) {
-		ret = radio_transmit_simple(length, buf, timeout_ticks);
+	register_write_pair(EZRADIOPRO_TRANSMIT_HEADER_3, destination >> 8, destination & 0xFF);
+
+	if (feature_adaptive_fec) {
+		register_write(EZRADIOPRO_TRANSMIT_HEADER_1, transmit_fec ? FEC_HEADER_GOLAY : 0);
+	}
+
+	if (feature_golay || (feature_adaptive_fec && transmit_fec)) {
+		length = radio_encode_golay(length, buf);
+	} else if (feature_adaptive_fec) {
+		__pdata uint16_t crc;
+
+		if (length > MAX_PACKET_LENGTH-2) {
+			panic("oversized packet");
+		}
+		memcpy(transmit_buffer, buf, length);
+		crc = crc16(length, buf) ^ (netid[0] | (((uint16_t)netid[1])<<8));
+		transmit_buffer[length++] = crc & 0xFF;
+		transmit_buffer[length++] = crc >> 8;
 	} else {
-		ret = radio_transmit_golay(length, buf, timeout_ticks);
+		if (length > MAX_PACKET_LENGTH) {
+			panic("oversized packet");
+		}
+		memcpy(transmit_buffer, buf, length);
 	}
-#ifdef _BOARD_RFD900A
-	PA_ENABLE = 0;		// Set PA_Enable to off the PA after TX cycle
-#endif
-	EX0_RESTORE;
-	return ret;
+
+	radio_clear_transmit_fifo();
+
+	register_write(EZRADIOPRO_TRANSMIT_PACKET_LENGTH, length);
+
+	// the FIFO is empty, so we can fill all of it
+	n = length;
+	if (n > RADIO_FIFO_SIZE) {
+		n = RADIO_FIFO_SIZE;
+	}
+	radio_write_transmit_fifo(n, transmit_buffer);
+	transmit_length = length;
+	transmit_offset = n;
+
+	// the interrupt does the rest
+	clear_status_registers();
+	register_write_pair(EZRADIOPRO_INTERRUPT_ENABLE_1, EZRADIOPRO_ENTXFFAEM | EZRADIOPRO_ENPKSENT | EZRADIOPRO_ENFFERR, 0);
+
+	preamble_detected = 0;
+	transmit_ok = false;
+	transmit_busy = true;
+	transmit_timeout = timeout_ticks;
+	transmit_tstart = timer2_tick();
+
+	// start TX
+	register_write(EZRADIOPRO_OPERATING_AND_FUNCTION_CONTROL_1, EZRADIOPRO_TXON | EZRADIOPRO_XTON);
+#ifdef DEBUG_PINS_RADIO_TX_RX
+	P2 |=  0x01;
+#endif // DEBUG_PINS_RADIO_TX_RX
+
+	EX0 = 1;
+	return true;
+}
+
+// check if the packet started by radio_transmit_start() is still
+// going out, giving up on it once its time is up
+//
+bool
+radio_transmit_busy(void)
+{
+	if (!transmit_busy) {
+		return false;
+	}
+	if ((uint16_t)(timer2_tick() - transmit_tstart) < transmit_timeout) {
+		return true;
+	}
+
+	EX0 = 0;
+	if (transmit_busy) {
+		// transmit timeout ... clear the FIFO
+		debug("TX timeout %u ts=%u tn=%u len=%u\n",
+		       transmit_timeout,
+		       transmit_tstart,
+		       timer2_tick(),
+		       (unsigned)(transmit_length - transmit_offset));
+		radio_transmit_end(false);
+	}
+	EX0 = 1;
+	return false;
+}
+
+// return true if the last packet was sent successfully
+//
+bool
+radio_transmit_result(void)
+{
+	return transmit_ok;
+}
+
+// transmit a packet and wait for it to go
+//
+// @param length		number of data bytes to send
+// @param timeout_ticks		number of 16usec RTC ticks to allow
+//				for the send
+//
+// @return	    true if packet sent successfully
+//
+bool
+radio_transmit(uint8_t length, __xdata uint8_t * __pdata buf, uint16_t destination, __pdata uint16_t timeout_ticks)
+{
+	if (!radio_transmit_start(length, buf, destination, timeout_ticks)) {
+		return false;
+	}
+	while (radio_transmit_busy()) {
+#ifdef WATCH_DOG_ENABLE
+		// Reset Watchdog
+		PCA0CPH5 = 0;
+#endif // WATCH_DOG_ENABLE
+	}
+	return radio_transmit_result();
 }
 
 
@@ -529,14 +589,25 @@ radio_receiver_on(void)
 {
 	EX0 = 0;
 
-	packet_received = 0;
-	receive_packet_length = 0;
 	preamble_detected = 0;
 	partial_packet_length = 0;
 
+	if (rx_count == RX_SLOTS) {
+		// nowhere to put a packet. radio_receive_packet() turns
+		// us back on when it has taken one out of the ring
+		receive_stopped = true;
+		register_write_pair(EZRADIOPRO_INTERRUPT_ENABLE_1, 0, 0);
+		clear_status_registers();
+
+		// go into tune mode
+		register_write(EZRADIOPRO_OPERATING_AND_FUNCTION_CONTROL_1, EZRADIOPRO_PLLON);
+		EX0 = 1;
+		return true;
+	}
+	receive_stopped = false;
+
 	// enable receive interrupts
-	register_write(EZRADIOPRO_INTERRUPT_ENABLE_1, RADIO_RX_INTERRUPTS);
-	register_write(EZRADIOPRO_INTERRUPT_ENABLE_2, EZRADIOPRO_ENPREAVAL);
+	register_write_pair(EZRADIOPRO_INTERRUPT_ENABLE_1, RADIO_RX_INTERRUPTS, EZRADIOPRO_ENPREAVAL);
 
 	clear_status_registers();
 	radio_clear_transmit_fifo();
@@ -581,14 +652,12 @@ radio_initialise(void)
 	}
 
 	// enable chip ready interrupt
-	register_write(EZRADIOPRO_INTERRUPT_ENABLE_1, 0);
-	register_write(EZRADIOPRO_INTERRUPT_ENABLE_2, EZRADIOPRO_ENCHIPRDY);
+	register_write_pair(EZRADIOPRO_INTERRUPT_ENABLE_1, 0, EZRADIOPRO_ENCHIPRDY);
 
 	// wait for the chip ready bit for 10ms
 	delay_set(50);
 	while (!delay_expired()) {
-		status = register_read(EZRADIOPRO_INTERRUPT_STATUS_1);
-		status = register_read(EZRADIOPRO_INTERRUPT_STATUS_2);
+		status = register_read_pair(EZRADIOPRO_INTERRUPT_STATUS_1) & 0xFF;
 		if (status & EZRADIOPRO_ICHIPRDY) {
 			return true;
 		}
@@ -736,16 +805,40 @@ __code static const uint8_t reg_table_915[NUM_RADIO_REGISTERS][NUM_DATA_RATES] =
 	{0x03,	0x06,	0x0D,	0x1A,	0x1E,	0x26,	0x33,	0x4D,	0x66,	0x9A,	0xCD,	0xFE,	0xFE}
 };
 
+// return the supported air data rate next to rate
+//
+uint8_t
+radio_next_air_rate(__pdata uint8_t rate, bool faster)
+{
+	__pdata uint8_t i;
+
+	for (i = 0; i < NUM_DATA_RATES - 1; i++) {
+		if (air_data_rates[i] >= rate) break;
+	}
+	if (faster) {
+		if (i < NUM_DATA_RATES - 1) {
+			i++;
+		}
+	} else if (i > 0) {
+		i--;
+	}
+	return air_data_rates[i];
+}
+
 // configure radio based on the air data rate
 //
 bool
 radio_configure(__pdata uint8_t air_rate)
 {
 	__pdata uint8_t i, rate_selection, control;
+	__code const uint8_t (* __pdata reg_table)[NUM_DATA_RATES];
 
 	// disable interrupts
-	register_write(EZRADIOPRO_INTERRUPT_ENABLE_1, 0x00);
-	register_write(EZRADIOPRO_INTERRUPT_ENABLE_2, 0x00);
+	register_write_pair(EZRADIOPRO_INTERRUPT_ENABLE_1, 0x00, 0x00);
+
+	// leave receive mode, as the rate can change while the TDM
+	// loop is running
+	register_write(EZRADIOPRO_OPERATING_AND_FUNCTION_CONTROL_1, EZRADIOPRO_XTON);
 
 	clear_status_registers();
 
@@ -787,15 +880,18 @@ radio_configure(__pdata uint8_t air_rate)
 	set_frequency_registers(settings.frequency);
 	register_write(EZRADIOPRO_FREQUENCY_HOPPING_STEP_SIZE, settings.channel_spacing);
 
-	if (feature_golay) {
+	if (feature_golay || feature_adaptive_fec) {
 		// when using golay encoding we use our own crc16
 		// instead of the hardware CRC, as we need to correct
 		// bit errors before checking the CRC
 		register_write(EZRADIOPRO_DATA_ACCESS_CONTROL,
 			       EZRADIOPRO_ENPACTX | 
 			       EZRADIOPRO_ENPACRX);
-		// 2 sync bytes and 2 header bytes
-		register_write(EZRADIOPRO_HEADER_CONTROL_2, EZRADIOPRO_HDLEN_2BYTE | EZRADIOPRO_SYNCLEN_2BYTE);
+		// 2 sync bytes and 2 header bytes, plus the unchecked
+		// FEC byte when it is chosen per packet
+		register_write(EZRADIOPRO_HEADER_CONTROL_2,
+			       (feature_adaptive_fec ? EZRADIOPRO_HDLEN_3BYTE : EZRADIOPRO_HDLEN_2BYTE) |
+			       EZRADIOPRO_SYNCLEN_2BYTE);
 
 		// check 2 bytes of header and allow broadcast on 2 bytes
 		register_write(EZRADIOPRO_HEADER_CONTROL_1, 0xCC);
@@ -809,16 +905,13 @@ radio_configure(__pdata uint8_t air_rate)
 		register_write(EZRADIOPRO_HEADER_CONTROL_2, EZRADIOPRO_HDLEN_4BYTE | EZRADIOPRO_SYNCLEN_2BYTE);
 		// check 4 bytes of header and allow broadcast on 2 bytes
 		register_write(EZRADIOPRO_HEADER_CONTROL_1, 0xCF);
-		register_write(EZRADIOPRO_HEADER_ENABLE_1, 0xFF);
-		register_write(EZRADIOPRO_HEADER_ENABLE_0, 0xFF);
+		register_write_pair(EZRADIOPRO_HEADER_ENABLE_1, 0xFF, 0xFF);
 	}
 	// Headers 2/3 are always in use..
-	register_write(EZRADIOPRO_HEADER_ENABLE_3, 0xFF);
-	register_write(EZRADIOPRO_HEADER_ENABLE_2, 0xFF);
+	register_write_pair(EZRADIOPRO_HEADER_ENABLE_3, 0xFF, 0xFF);
 
 	// set FIFO limits to allow for sending larger than 64 byte packets
-	register_write(EZRADIOPRO_TX_FIFO_CONTROL_1, TX_FIFO_THRESHOLD_HIGH);
-	register_write(EZRADIOPRO_TX_FIFO_CONTROL_2, TX_FIFO_THRESHOLD_LOW);
+	register_write_pair(EZRADIOPRO_TX_FIFO_CONTROL_1, TX_FIFO_THRESHOLD_HIGH, TX_FIFO_THRESHOLD_LOW);
 	register_write(EZRADIOPRO_RX_FIFO_CONTROL, RX_FIFO_THRESHOLD_HIGH);
 
 	settings.preamble_length = 16;
@@ -864,25 +957,31 @@ radio_configure(__pdata uint8_t air_rate)
 
 	// set the registers from the tables
 	if (g_board_frequency == FREQ_433) {
-		for (i = 0; i < NUM_RADIO_REGISTERS; i++) {
-			register_write(reg_index[i],
-				       reg_table_433[i][rate_selection]);
-		}
+		reg_table = reg_table_433;
 	} else if (g_board_frequency == FREQ_470) {
-		for (i = 0; i < NUM_RADIO_REGISTERS; i++) {
-			register_write(reg_index[i],
-				       reg_table_470[i][rate_selection]);
-		}
+		reg_table = reg_table_470;
 	} else if (g_board_frequency == FREQ_868) {
-		for (i = 0; i < NUM_RADIO_REGISTERS; i++) {
-			register_write(reg_index[i],
-				       reg_table_868[i][rate_selection]);
-		}
+		reg_table = reg_table_868;
 	} else {
+		reg_table = reg_table_915;
+	}
+
+	// runs of consecutive registers go out as one burst
+	{
+		EX0_SAVE_DISABLE;
+
 		for (i = 0; i < NUM_RADIO_REGISTERS; i++) {
-			register_write(reg_index[i],
-				       reg_table_915[i][rate_selection]);
+			if (i == 0 || reg_index[i] != reg_index[i-1] + 1) {
+				if (i != 0) {
+					SPI_BURST_END();
+				}
+				SPI_BURST_START(reg_index[i] | 0x80);
+			}
+			SPI_BURST_WRITE(reg_table[i][rate_selection]);
 		}
+		SPI_BURST_END();
+
+		EX0_RESTORE;
 	}
 
 	return true;
@@ -950,6 +1049,14 @@ radio_get_transmit_power(void)
 	return settings.transmit_power;
 }
 
+// choose the coding of the packets sent with feature_adaptive_fec
+//
+void
+radio_set_transmit_fec(bool golay)
+{
+	transmit_fec = golay;
+}
+
 // setup a 16 bit network ID
 //
 void
@@ -957,13 +1064,11 @@ radio_set_network_id(uint16_t id)
 {
 	netid[0] = id&0xFF;
 	netid[1] = id>>8;
-	if (!feature_golay) {
+	if (!feature_golay && !feature_adaptive_fec) {
 		// when not using golay encoding we use the hardware
 		// headers for network ID
-		register_write(EZRADIOPRO_TRANSMIT_HEADER_1, id >> 8);
-		register_write(EZRADIOPRO_TRANSMIT_HEADER_0, id & 0xFF);
-		register_write(EZRADIOPRO_CHECK_HEADER_1, id >> 8);
-		register_write(EZRADIOPRO_CHECK_HEADER_0, id & 0xFF);
+		register_write_pair(EZRADIOPRO_TRANSMIT_HEADER_1, id >> 8, id & 0xFF);
+		register_write_pair(EZRADIOPRO_CHECK_HEADER_1, id >> 8, id & 0xFF);
 	}
 }
 
@@ -973,8 +1078,7 @@ void
 radio_set_node_id(uint16_t id)
 {
 	nodeId = id;
-	register_write(EZRADIOPRO_CHECK_HEADER_3, nodeId>>8);
-	register_write(EZRADIOPRO_CHECK_HEADER_2, nodeId&0xFF);
+	register_write_pair(EZRADIOPRO_CHECK_HEADER_3, nodeId>>8, nodeId&0xFF);
 }
 
 /// write to a radio register
@@ -1001,6 +1105,25 @@ register_write(uint8_t reg, uint8_t value) __reentrant
 	EX0_RESTORE;
 }
 
+/// write to two consecutive radio registers in one SPI transaction
+///
+/// @param reg			The first register to write
+/// @param value1		The value for reg
+/// @param value2		The value for reg+1
+///
+static void
+register_write_pair(uint8_t reg, uint8_t value1, uint8_t value2) __reentrant
+{
+	EX0_SAVE_DISABLE;
+
+	SPI_BURST_START(reg | 0x80);
+	SPI_BURST_WRITE(value1);
+	SPI_BURST_WRITE(value2);
+	SPI_BURST_END();
+
+	EX0_RESTORE;
+}
+
 
 /// read from a radio register
 ///
@@ -1029,6 +1152,38 @@ register_read(uint8_t reg) __reentrant
 	return value;
 }
 
+/// read two consecutive radio registers in one SPI transaction
+///
+/// @param reg			The first register to read
+/// @return			reg in the high byte, reg+1 in the low byte
+///
+static uint16_t
+register_read_pair(uint8_t reg) __reentrant
+{
+	register uint8_t value1, value2;
+	EX0_SAVE_DISABLE;
+
+	NSS1 = 0;				// drive NSS low
+	SPIF1 = 0;				// clear SPIF
+	SPI1DAT = reg;				// write reg address
+	while (!SPIF1);				// wait on SPIF
+	ACC = SPI1DAT;				// discard first byte
+	SPIF1 = 0;
+	SPI1DAT = 0x00;				// clock out reg
+	while (!SPIF1);
+	value1 = SPI1DAT;
+	SPIF1 = 0;
+	SPI1DAT = 0x00;				// and reg+1
+	while (!SPIF1);
+	value2 = SPI1DAT;
+	SPIF1 = 0;				// leave SPIF cleared
+	NSS1 = 1;				// drive NSS high
+
+	EX0_RESTORE;
+
+	return ((uint16_t)value1 << 8) | value2;
+}
+
 /// read some bytes from the receive FIFO into a buffer
 ///
 /// @param n			The number of bytes to read
@@ -1057,8 +1212,7 @@ read_receive_fifo(register uint8_t n, __xdata uint8_t * buf) __reentrant
 static void
 clear_status_registers(void)
 {
-	register_read(EZRADIOPRO_INTERRUPT_STATUS_1);
-	register_read(EZRADIOPRO_INTERRUPT_STATUS_2);
+	register_read_pair(EZRADIOPRO_INTERRUPT_STATUS_1);
 }
 
 /// scale a uint32_t, rounding to nearest multiple
@@ -1083,8 +1237,7 @@ software_reset(void)
 	uint8_t status;
 
 	// Clear interrupt enable and interrupt flag bits
-	register_write(EZRADIOPRO_INTERRUPT_ENABLE_1, 0);
-	register_write(EZRADIOPRO_INTERRUPT_ENABLE_2, 0);
+	register_write_pair(EZRADIOPRO_INTERRUPT_ENABLE_1, 0, 0);
 
 	clear_status_registers();
 
@@ -1100,13 +1253,11 @@ software_reset(void)
 	}
 
 	// enable chip ready interrupt
-	register_write(EZRADIOPRO_INTERRUPT_ENABLE_1, 0);
-	register_write(EZRADIOPRO_INTERRUPT_ENABLE_2, EZRADIOPRO_ENCHIPRDY);
+	register_write_pair(EZRADIOPRO_INTERRUPT_ENABLE_1, 0, EZRADIOPRO_ENCHIPRDY);
 
 	delay_set(20);
 	while (!delay_expired()) {
-		status = register_read(EZRADIOPRO_INTERRUPT_STATUS_1);
-		status = register_read(EZRADIOPRO_INTERRUPT_STATUS_2);
+		status = register_read_pair(EZRADIOPRO_INTERRUPT_STATUS_1) & 0xFF;
 		if (status & EZRADIOPRO_ICHIPRDY) {
 			return true;
 		}
@@ -1141,9 +1292,18 @@ set_frequency_registers(__pdata uint32_t frequency)
 	band |= EZRADIOPRO_SBSEL;
 	carrier = (uint16_t)frequency;
 
-	register_write(EZRADIOPRO_FREQUENCY_BAND_SELECT, band);
-	register_write(EZRADIOPRO_NOMINAL_CARRIER_FREQUENCY_1, carrier >> 8);
-	register_write(EZRADIOPRO_NOMINAL_CARRIER_FREQUENCY_0, carrier & 0xFF);
+	{
+		EX0_SAVE_DISABLE;
+
+		// band select and the two carrier registers follow each other
+		SPI_BURST_START(EZRADIOPRO_FREQUENCY_BAND_SELECT | 0x80);
+		SPI_BURST_WRITE(band);
+		SPI_BURST_WRITE(carrier >> 8);
+		SPI_BURST_WRITE(carrier & 0xFF);
+		SPI_BURST_END();
+
+		EX0_RESTORE;
+	}
 }
 
 
@@ -1201,15 +1361,45 @@ INTERRUPT(Receiver_ISR, INTERRUPT_INT0)
 #ifdef DEBUG_PINS_RADIO_TX_RX
 	P2 |=  0x02;
 #endif // DEBUG_PINS_RADIO_TX_RX
-	status2 = register_read(EZRADIOPRO_INTERRUPT_STATUS_2);
-	status  = register_read(EZRADIOPRO_INTERRUPT_STATUS_1);
+	{
+		// both status registers in one transaction
+		__data uint16_t status_pair = register_read_pair(EZRADIOPRO_INTERRUPT_STATUS_1);
+		status  = status_pair >> 8;
+		status2 = status_pair & 0xFF;
+	}
+
+	if (transmit_busy) {
+		if (status & EZRADIOPRO_IFFERR) {
+			// the FIFO under or overflowed
+			debug("FFERR %u\n", (unsigned)(transmit_length - transmit_offset));
+			if (errors.tx_fifo_errors != 0xFFFF) {
+				errors.tx_fifo_errors++;
+			}
+			radio_transmit_end(false);
+		} else if (status & EZRADIOPRO_IPKSENT) {
+			// see if we got the whole packet out
+			radio_transmit_end(transmit_offset == transmit_length);
+		} else if ((status & EZRADIOPRO_ITXFFAEM) && transmit_offset != transmit_length) {
+			// the FIFO is below the low threshold
+			__data uint8_t n = transmit_length - transmit_offset;
+			if (n > TX_FIFO_REFILL) {
+				n = TX_FIFO_REFILL;
+			}
+			radio_write_transmit_fifo(n, &transmit_buffer[transmit_offset]);
+			transmit_offset += n;
+		}
+#ifdef DEBUG_PINS_RADIO_TX_RX
+		P2 &= ~0x02;
+#endif // DEBUG_PINS_RADIO_TX_RX
+		return;
+	}
 
 	if (status & EZRADIOPRO_IRXFFAFULL) {
 		if (RX_FIFO_THRESHOLD_HIGH + (uint16_t)partial_packet_length > MAX_PACKET_LENGTH) {
 			debug("rx pplen=%u\n", (unsigned)partial_packet_length);
 			goto rxfail;
 		}
-		read_receive_fifo(RX_FIFO_THRESHOLD_HIGH, &radio_buffer[partial_packet_length]);
+		read_receive_fifo(RX_FIFO_THRESHOLD_HIGH, &rx_ring[rx_insert].data[partial_packet_length]);
 		partial_packet_length += RX_FIFO_THRESHOLD_HIGH;
 		last_rssi = register_read(EZRADIOPRO_RECEIVED_SIGNAL_STRENGTH_INDICATOR);
 	}
@@ -1233,19 +1423,20 @@ INTERRUPT(Receiver_ISR, INTERRUPT_INT0)
 			goto rxfail;
 		}
 		if (partial_packet_length < len) {
-			read_receive_fifo(len-partial_packet_length, &radio_buffer[partial_packet_length]);
+			read_receive_fifo(len-partial_packet_length, &rx_ring[rx_insert].data[partial_packet_length]);
 		}
-		receive_packet_length = len;
 
 		// we have a full packet
-		packet_received = true;
-
-		// disable interrupts until the tdm code has grabbed the packet
-		register_write(EZRADIOPRO_INTERRUPT_ENABLE_1, 0);
-		register_write(EZRADIOPRO_INTERRUPT_ENABLE_2, 0);
+		rx_ring[rx_insert].length = len;
+		rx_ring[rx_insert].rssi = last_rssi;
+		if (feature_adaptive_fec) {
+			rx_ring[rx_insert].fec = register_read(EZRADIOPRO_RECEIVED_HEADER_1);
+		}
+		rx_insert = (rx_insert + 1) % RX_SLOTS;
+		rx_count++;
 
-		// go into tune mode
-		register_write(EZRADIOPRO_OPERATING_AND_FUNCTION_CONTROL_1, EZRADIOPRO_PLLON);
+		// listen for the next one, unless the ring is now full
+		radio_receiver_on();
 	}
 #ifdef DEBUG_PINS_RADIO_TX_RX
 	P2 &= ~0x02;
@@ -71,9 +71,15 @@ extern __pdata uint8_t pdata_canary;
 
 /// optional features
 extern bool feature_golay;
+extern bool feature_adaptive_fec;
 extern bool feature_opportunistic_resend;
 extern bool feature_mavlink_framing;
+extern bool feature_mavlink_priority;
+extern bool feature_slip_framing;
 extern bool feature_rtscts;
+extern bool feature_demand_slots;
+extern bool feature_arq;
+extern bool feature_compress;
 
 /// System clock frequency
 ///
@@ -126,14 +132,14 @@ extern __pdata uint8_t			g_board_bl_version;	///< bootloader version
 
 extern __pdata uint16_t nodeId; // Network Node Id
 
-/// staticstics maintained by the radio code
+/// staticstics maintained by the radio code, for each link (see links.h)
 struct statistics {
 	uint8_t average_rssi;
 	uint8_t average_noise;
+	uint8_t errors;		///< recent receive errors of the sender, for adaptive air rate
+	uint8_t fec_errors;	///< share of this node's packets corrected or lost, in 1/256
 //	uint16_t receive_count;
 };
-#define MAX_NODE_RSSI_STATS 8
-extern struct statistics statistics[MAX_NODE_RSSI_STATS], remote_statistics[MAX_NODE_RSSI_STATS];
 
 struct error_counts {
 	uint16_t rx_errors;		///< count of packet receive errors
@@ -142,6 +148,7 @@ struct error_counts {
 	uint16_t serial_rx_overflow;    ///< count of serial receive overflows
 	uint16_t corrected_errors;      ///< count of words corrected by golay code
 	uint16_t corrected_packets;     ///< count of packets corrected by golay code
+	uint16_t tx_fifo_errors;	///< count of radio TX FIFO under/overflows
 };
 __pdata extern struct error_counts errors;
 
@@ -159,10 +166,10 @@ extern bool radio_receive_packet(uint8_t *length, __xdata uint8_t * __pdata buf)
 ///
 extern bool radio_preamble_detected(void);
 
-/// begin transmission of a packet
+/// transmit a packet, waiting until it has been sent
 ///
-/// @param length		Packet length to be transmitted; assumes
-///				the data is already present in the FIFO.
+/// @param length		Packet length to be transmitted
+/// @param buf			The packet data
 /// @param destination The node the packet is transmitted to
 /// @param timeout_ticks	The number of ticks to wait before assiming
 ///				that transmission has failed.
@@ -171,6 +178,35 @@ extern bool radio_preamble_detected(void);
 ///
 extern bool radio_transmit(uint8_t length, __xdata uint8_t * __pdata buf, uint16_t destination, __pdata uint16_t timeout_ticks);
 
+/// begin transmission of a packet, returning while it is sent.
+///
+/// The packet is copied, so buf may be reused straight away. The radio
+/// interrupt refills the FIFO; nothing else may use the radio until
+/// radio_transmit_busy() returns false.
+///
+/// @param length		Packet length to be transmitted
+/// @param buf			The packet data
+/// @param destination The node the packet is transmitted to
+/// @param timeout_ticks	The number of ticks to wait before assiming
+///				that transmission has failed.
+///
+/// @return			false if a transmit is already in progress, or every
+///				receive slot holds a packet not yet collected
+///
+extern bool radio_transmit_start(uint8_t length, __xdata uint8_t * __pdata buf, uint16_t destination, __pdata uint16_t timeout_ticks);
+
+/// test whether the packet from radio_transmit_start() is still being sent
+///
+/// @return			True until the packet is sent, fails or times out
+///
+extern bool radio_transmit_busy(void);
+
+/// the outcome of the last transmit
+///
+/// @return			True if the whole packet was sent
+///
+extern bool radio_transmit_result(void);
+
 /// switch the radio to receive mode
 ///
 /// @return			Always true.
@@ -256,6 +292,16 @@ extern uint8_t radio_current_rssi(void);
 ///
 extern uint8_t radio_air_rate(void);
 
+/// return the neighbouring air data rate radio_configure() supports
+///
+/// @param rate			A supported air data rate
+/// @param faster		True for the next faster rate, false for the
+///				next slower one
+/// @return			The neighbouring rate, or rate itself if it is
+///				already the fastest or slowest
+///
+extern uint8_t radio_next_air_rate(__pdata uint8_t rate, bool faster);
+
 /// set the radio transmit power (in dBm)
 ///
 /// @param power		The desired transmit power in dBm
@@ -263,6 +309,15 @@ extern uint8_t radio_air_rate(void);
 ///
 extern void radio_set_transmit_power(uint8_t power);
 
+/// choose how the following packets are sent when feature_adaptive_fec
+/// is set. Each packet carries the choice in its header, so the
+/// receivers decode it whichever was used
+///
+/// @param golay		True to golay encode them, false to send
+///				them as they are with a CRC
+///
+extern void radio_set_transmit_fec(bool golay);
+
 /// get the currend transmit power (in dBm)
 ///
 /// @return			The actual transmit power in dBm
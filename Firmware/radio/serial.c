@@ -53,6 +53,11 @@ __pdata const uint16_t  tx_mask = sizeof(tx_buf) - 1;
 
 // FIFO insert/remove pointers
 static volatile __pdata uint16_t				rx_insert, rx_remove;
+
+// bytes before rx_hold have been read, but may still be needed to
+// retransmit a packet. With ARQ enabled the receive FIFO fills up to
+// rx_hold rather than rx_remove. Without ARQ rx_hold follows rx_remove
+static volatile __pdata uint16_t				rx_hold;
 static volatile __pdata uint16_t				tx_insert, tx_remove;
 
 
@@ -82,6 +87,10 @@ static volatile bool			tx_idle;
 #define BUF_PEEK(_which)	_which##_buf[_which##_remove]
 #define BUF_PEEK2(_which)	_which##_buf[(_which##_remove+1) & _which##_mask]
 
+#define RX_NOT_FULL()		(((rx_insert + 1) & rx_mask) != rx_hold)
+#define RX_FREE()		((rx_hold - rx_insert - 1) & rx_mask)
+#define RX_RELEASE()		do { if (!feature_arq) rx_hold = rx_remove; } while(0)
+
 static void			_serial_write(register uint8_t c);
 static void			serial_restart(void);
 static void serial_device_set_speed(register uint8_t speed);
@@ -123,7 +132,7 @@ serial_interrupt(void) __interrupt(INTERRUPT_UART0)
 			at_plus_detector(c);
 
 			// and queue it for general reception
-			if (BUF_NOT_FULL(rx)) {
+			if (RX_NOT_FULL()) {
 				BUF_INSERT(rx, c);
 			} else {
 				if (errors.serial_rx_overflow != 0xFFFF) {
@@ -131,7 +140,7 @@ serial_interrupt(void) __interrupt(INTERRUPT_UART0)
 				}
 			}
 #ifdef SERIAL_CTS
-			if (feature_rtscts && (BUF_FREE(rx) < SERIAL_CTS_THRESHOLD_LOW)) {
+			if (feature_rtscts && (RX_FREE() < SERIAL_CTS_THRESHOLD_LOW)) {
 				SERIAL_CTS = true;
 			}
 #endif
@@ -182,6 +191,7 @@ serial_init(register uint8_t speed)
 
 	// reset buffer state, discard all data
 	rx_insert = 0;
+	rx_hold = rx_remove;
 	tx_remove = 0;
 	tx_insert = 0;
 	tx_remove = 0;
@@ -318,12 +328,13 @@ serial_read(void)
 
 	if (BUF_NOT_EMPTY(rx)) {
 		BUF_REMOVE(rx, c);
+		RX_RELEASE();
 	} else {
 		c = '\0';
 	}
 
 #ifdef SERIAL_CTS
-	if (feature_rtscts && (BUF_FREE(rx) > SERIAL_CTS_THRESHOLD_HIGH)) {
+	if (feature_rtscts && (RX_FREE() > SERIAL_CTS_THRESHOLD_HIGH)) {
 		SERIAL_CTS = false;
 	}
 #endif
@@ -357,6 +368,43 @@ serial_peek2(void)
 	return c;
 }
 
+// peek at the byte offset bytes into the receive FIFO. Only the
+// serial interrupt adds bytes, and only after the ones already there,
+// so this is safe with interrupts enabled
+uint8_t
+serial_peek_at(__pdata uint16_t offset)
+{
+	return rx_buf[(rx_remove + offset) & rx_mask];
+}
+
+// reverse the bytes between offsets from and to in the receive FIFO
+static void
+rx_reverse(__pdata uint16_t from, __pdata uint16_t to)
+{
+	register uint8_t c;
+
+	from += rx_remove;
+	to += rx_remove - 1;
+	while (from < to) {
+		c = rx_buf[from & rx_mask];
+		rx_buf[from & rx_mask] = rx_buf[to & rx_mask];
+		rx_buf[to & rx_mask] = c;
+		from++;
+		to--;
+	}
+}
+
+// move count bytes at offset from forward to offset to, shifting the
+// bytes in between back. The bytes have not been read yet, so the
+// serial interrupt never touches them
+void
+serial_read_promote(__pdata uint16_t to, __pdata uint16_t from, __pdata uint8_t count)
+{
+	rx_reverse(to, from);
+	rx_reverse(from, from + count);
+	rx_reverse(to, from + count);
+}
+
 // read count bytes from the serial buffer. This implementation
 // tries to be as efficient as possible, while disabling interrupts
 // for as short a time as possible
@@ -380,18 +428,20 @@ serial_read_buf(__xdata uint8_t * __data buf, __pdata uint8_t count)
 	// update the remove marker with interrupts disabled
 	__critical {
 		rx_remove = (rx_remove + n1) & rx_mask;
+		RX_RELEASE();
 	}
 	// any more bytes to do?
 	if (count > 0) {
 		memcpy(buf, &rx_buf[0], count);
 		__critical {
 			rx_remove = count;
+			RX_RELEASE();
 		}		
 	}
 
 #ifdef SERIAL_CTS
 	__critical {
-		if (feature_rtscts && (BUF_FREE(rx) > SERIAL_CTS_THRESHOLD_HIGH)) {
+		if (feature_rtscts && (RX_FREE() > SERIAL_CTS_THRESHOLD_HIGH)) {
 			SERIAL_CTS = false;
 		}
 	}
@@ -413,11 +463,55 @@ serial_read_available(void)
 uint8_t
 serial_read_space(void)
 {
-	uint16_t space = sizeof(rx_buf) - serial_read_available();
+	register uint16_t space;
+	ES0_SAVE_DISABLE;
+	space = RX_FREE() + 1;
+	ES0_RESTORE;
 	space = (100 * (space/8)) / (sizeof(rx_buf)/8);
 	return space;
 }
 
+// the position of the next byte serial_read() would return
+uint16_t
+serial_read_position(void)
+{
+	return rx_remove;
+}
+
+// copy bytes that have been read but are still held for ARQ
+void
+serial_read_held(__pdata uint16_t pos, __xdata uint8_t * __data buf, __pdata uint8_t count)
+{
+	pos &= rx_mask;
+	while (count--) {
+		*buf++ = rx_buf[pos];
+		pos = (pos + 1) & rx_mask;
+	}
+}
+
+// let the FIFO reuse the held bytes before pos
+void
+serial_read_release(__pdata uint16_t pos)
+{
+	__critical {
+		rx_hold = pos & rx_mask;
+#ifdef SERIAL_CTS
+		if (feature_rtscts && (RX_FREE() > SERIAL_CTS_THRESHOLD_HIGH)) {
+			SERIAL_CTS = false;
+		}
+#endif
+	}
+}
+
+// read the held bytes from pos on again
+void
+serial_read_rewind(__pdata uint16_t pos)
+{
+	__critical {
+		rx_remove = pos & rx_mask;
+	}
+}
+
 void
 putchar(char c) __reentrant
 {
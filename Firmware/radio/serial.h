@@ -102,6 +102,24 @@ extern uint8_t	serial_peek(void);
 ///
 extern uint8_t	serial_peek2(void);
 
+/// peek at a byte further into the serial port receive FIFO
+/// caller must ensure serial available is > offset
+///
+/// @param	offset		How many bytes after the next byte.
+/// @return			The byte at that offset in the receive FIFO.
+///
+extern uint8_t	serial_peek_at(__pdata uint16_t offset);
+
+/// Move bytes in the receive FIFO ahead of the bytes before them,
+/// keeping the order of the rest. The caller must ensure serial
+/// available is >= from + count
+///
+/// @param	to		Offset to move the bytes to.
+/// @param	from		Offset of the first byte to move.
+/// @param	count		The number of bytes to move.
+///
+extern void	serial_read_promote(__pdata uint16_t to, __pdata uint16_t from, __pdata uint8_t count);
+
 /// Read bytes from the serial port.
 ///
 /// @param	buf		Buffer for read data.
@@ -124,4 +142,35 @@ extern uint16_t	serial_read_available(void);
 ///
 extern void serial_check_rts(void);
 
+/// The position in the receive FIFO of the next byte to be read.
+/// With ARQ enabled, bytes that have been read stay in the FIFO until
+/// they are released, so a packet can be rebuilt from its position
+///
+/// @return			FIFO position, only meaningful to the
+///				serial_read_held(), serial_read_release()
+///				and serial_read_rewind() calls
+///
+extern uint16_t serial_read_position(void);
+
+/// Copy bytes that have been read but not released yet.
+///
+/// @param	pos		Position of the first byte, from serial_read_position()
+/// @param	buf		Buffer for the data.
+/// @param	count		The number of bytes to copy.
+///
+extern void serial_read_held(__pdata uint16_t pos, __xdata uint8_t * __data buf, __pdata uint8_t count);
+
+/// Release the bytes before a position for reuse by the receive FIFO.
+///
+/// @param	pos		Position of the first byte still needed
+///
+extern void serial_read_release(__pdata uint16_t pos);
+
+/// Go back to reading from a position, so the bytes from it on are read
+/// again. They must not have been released yet.
+///
+/// @param	pos		Position of the next byte to read
+///
+extern void serial_read_rewind(__pdata uint16_t pos);
+
 #endif // _SERIAL_H_
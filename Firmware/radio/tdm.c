@@ -35,6 +35,7 @@
 ///
 
 #include <stdarg.h>
+#include <stddef.h>
 #include "radio.h"
 #include "tdm.h"
 #include "timer.h"
@@ -42,6 +43,8 @@
 #include "golay.h"
 #include "freq_hopping.h"
 #include "crc.h"
+#include "compress.h"
+#include "links.h"
 
 /// the state of the tdm system
 enum tdm_state { TDM_TRANSMIT, TDM_RECEIVE, TDM_SYNC };
@@ -61,6 +64,24 @@ __pdata static uint16_t tdm_state_remaining;
 __pdata static uint16_t tx_window_width;
 __pdata static uint16_t tx_sync_width;
 
+/// the nominal width of the current tdm state, this is tx_sync_width
+/// or the width of the transmit window of the node owning the slot
+__pdata static uint16_t state_width;
+
+/// the round schedule. Every node shares out the round by the node
+/// weights, and with demand assigned slots the base also weights it
+/// by the serial backlog the nodes report in their trailers and
+/// broadcasts the result in the sync packet.
+/// Widths are held in units of (1<<SLOT_WIDTH_SHIFT) ticks, zero
+/// meaning the node gets the default tx_window_width
+#define SLOT_WIDTH_SHIFT	5
+#define BACKLOG_SHIFT		2
+__xdata static uint8_t slot_width[MAX_SLOT_NODES];
+__xdata static uint8_t slot_backlog[MAX_SLOT_NODES];
+
+/// the smallest window a node can be given, enough for a stats packet
+__pdata static uint16_t min_window_width;
+
 /// the maximum data packet size we can fit
 __pdata static uint8_t max_data_packet_length;
 
@@ -97,12 +118,101 @@ static __bit received_sync;
 __pdata static uint8_t sync_count; // the amount of successfull times synced 
 static __bit sync_any;
 
+/// the round number. The base counts the rounds and sends the count
+/// in the sync, and the channel of every window follows from it and
+/// the slot. A node that hears a packet from another node in its own
+/// window can work out a round that hops the same way, so it can join
+/// from anything it hears. It may transmit once it has heard packets
+/// where it expected them in SYNC_CONFIRM windows, and has had a sync
+/// for the slot allocation and the channels left out
+#define SYNC_CONFIRM	4
+__pdata static uint16_t tdm_round;
+static __bit window_confirmed;
+static __bit base_synced;
+
+/// adaptive air rate. The base picks the rate from how well it and the
+/// nodes hear each other, and announces a change in the sync packet
+/// RATE_SWITCH_ROUNDS rounds ahead, so every node switches at the same
+/// round boundary. min_air_rate is 0 when the rate is fixed
+#define RATE_SWITCH_ROUNDS	4
+#define RATE_PERIOD		8	// link updates between decisions
+#define RATE_DOWN_MARGIN	24	// RSSI units (about 0.5dB) above the noise
+#define RATE_UP_MARGIN		40
+#define RATE_DOWN_ERRORS	8	// recent_errors that make the link too poor
+#define RATE_UP_HOLD		8	// decisions to stay put after slowing for errors
+__pdata static uint8_t min_air_rate, max_air_rate;
+__pdata static uint8_t rate_switch_to, rate_switch_rounds;
+__pdata static uint8_t rate_period, rate_up_hold;
+static __bit rate_heard_any;
+
+/// the sync packet carries the slot allocation, then a list of items,
+/// each a tag byte and the bytes that go with it
+#define SYNC_ITEM_RATE		1	// air rate to switch to, rounds to go
+#define SYNC_ITEM_CHANNELS	2	// what fhop_get_exclusions() gives
+#define SYNC_ITEM_CLOCK		3	// the base's timer2 tick, low byte first
+
+/// the base may send the sync every sync_rounds rounds. The rounds in
+/// between have no sync window, and the countdowns in the sync items
+/// go down a sync at a time. So that the windows stay lined up without
+/// it, the syncs carry the base's timer2 tick. A node compares the
+/// ticks it counted with the ticks the base counted, taking the sync
+/// that got to it soonest in each DRIFT_PERIOD, and corrects its own
+/// timing by the drift it finds, in units of 1/2^20 (about 1ppm)
+#define DRIFT_PERIOD	0x40000UL	// ticks, about 4 seconds
+#define DRIFT_MAX	200
+__pdata static uint8_t sync_rounds = 1;
+__pdata static int16_t clock_drift;
+__xdata static uint32_t clock_ticks;	// timer2 extended to 32 bits
+__xdata static uint32_t base_clock;	// the base's, from the syncs
+__xdata static uint32_t last_clock_sync, last_drift_fix, period_start;
+__xdata static int32_t min_offset, prev_min_offset;
+__xdata static uint32_t min_offset_at, prev_min_offset_at;
+__xdata static int32_t drift_remainder;
+static __bit base_clock_valid, min_offset_valid, prev_min_offset_valid;
+
+/// adaptive hopping. Statistics packets end with the worst channel of
+/// the sender and its score, and the receive errors are charged to the
+/// channel they happened on
+#define HOP_REPORT_LEN		2
+
+/// a stats packet starts with our noise and recent errors, then the
+/// hop report if adaptive hopping is on, then an entry for each link
+/// that fits: the node id, low byte first, the RSSI we hear it with and
+/// its fec errors.
+/// A node sends as many packets as it takes to cover its link table
+/// once per link update, so that is the same however many nodes there are
+#define STATS_HEADER_LEN	2
+#define STATS_ENTRY_LEN		4
+__pdata static uint16_t channel_error_count;
+
+/// our receive errors, halving every link update. Sent to the other
+/// nodes in our statistics packets
+__pdata static uint8_t recent_errors;
+__pdata static uint16_t last_error_count;
+
+/// adaptive FEC. We count the packets from each node that we had to
+/// correct or lost, and send the share back to it in our statistics.
+/// A node golay encodes what it sends to a node that reports a poor
+/// link, and keeps on for FEC_HOLD link updates once the link is good
+#define FEC_ON_SCORE	16	// share in 1/256, about 1 packet in 16
+#define FEC_OFF_SCORE	2
+#define FEC_HOLD	20	// link updates, 10 seconds
+__pdata static uint16_t fec_error_count;
+static __bit fec_broadcast;	// a broadcast needs golay for someone
+static __bit packet_fec;	// the packet being sent is golay encoded
+
 /// the latency in 16usec timer2 ticks for sending a zero length packet
 __pdata static uint16_t packet_latency;
 
 /// the time in 16usec ticks for sending one byte
 __pdata static uint16_t ticks_per_byte;
 
+/// the same for packets that are not golay encoded, when
+/// feature_adaptive_fec chooses per packet. The round is sized with the
+/// golay costs above so that either fits
+__pdata static uint16_t plain_packet_latency, plain_ticks_per_byte;
+__pdata static uint8_t plain_max_data_packet_length;
+
 /// number of 16usec ticks to wait for a preamble to turn into a packet
 /// This is set when we get a preamble interrupt, and causes us to delay
 /// sending for a maximum packet latency. This is used to make it more likely
@@ -144,8 +254,8 @@ __pdata uint8_t test_display;
 
 // Statisics packet recive count
 __pdata uint16_t statistics_receive_count;
-// set to 0 when we should send statistics packets
-__pdata uint16_t statistics_transmit_stats;
+// next link to send in a stats packet, set to 0 when we should send them
+__pdata uint8_t statistics_transmit_stats;
 // handle ati5 command, as this is a long and doesn't fit into the buffer
 __pdata uint8_t ati5_id;
 
@@ -158,9 +268,19 @@ struct tdm_trailer {
 	uint16_t bonus:1;
 	uint16_t resend:1;
 	uint16_t nodeid;
+	uint8_t backlog;	// only sent when demand slots or ARQ are enabled
+	uint8_t seq;		// the rest is only sent with ARQ
+	struct packet_ack ack;
 };
 __pdata struct tdm_trailer trailer;
 
+/// the number of trailer bytes sent over the air
+__pdata static uint8_t trailer_len;
+
+/// set while a packet we started is on the air
+static __bit transmit_in_progress;
+static __bit transmit_has_data;
+
 /// buffer to hold a remote AT command before sending
 static __bit            send_at_command;
 static __pdata uint16_t send_at_command_to;
@@ -176,28 +296,32 @@ tdm_show_rssi(void)
 	// Using printfl helps a bit but still overloads the cpu when AT&T=RSSI is used.
 	// This causes pauses and eventualy the nodes drift out of sync
 	__pdata uint8_t i;
-	for(i=0; i<(nodeCount-1) && i<MAX_NODE_RSSI_STATS; i++)
+	for(i=0; i<MAX_LINKS; i++)
 	{
-		if (i != nodeId) {
-			printfl("[%u] L/R RSSI: %u/%u  L/R noise: %u/%u\n",
-				   (unsigned)i,
+		if (links[i].node != LINK_FREE) {
+			printfl("[%u] L/R RSSI: %u/%u  L/R noise: %u/%u  L/R fec: %u/%u\n",
+				   (unsigned)links[i].node,
 				   (unsigned)statistics[i].average_rssi,
 				   (unsigned)remote_statistics[i].average_rssi,
-				   (unsigned)statistics[nodeId].average_noise,
-				   (unsigned)remote_statistics[i].average_noise);
+				   (unsigned)link_noise,
+				   (unsigned)remote_statistics[i].average_noise,
+				   (unsigned)statistics[i].fec_errors,
+				   (unsigned)remote_statistics[i].fec_errors);
 		}
 	}
-	printfl("[%u] pkts: %u txe=%u rxe=%u stx=%u srx=%u ecc=%u/%u temp=%d dco=%u\n",
+	printfl("[%u] pkts: %u txe=%u/%u rxe=%u stx=%u srx=%u ecc=%u/%u temp=%d dco=%u drift=%d\n",
 		   (unsigned)nodeId,
 		   (unsigned)statistics_receive_count,
 		   (unsigned)errors.tx_errors,
+		   (unsigned)errors.tx_fifo_errors,
 		   (unsigned)errors.rx_errors,
 		   (unsigned)errors.serial_tx_overflow,
 		   (unsigned)errors.serial_rx_overflow,
 		   (unsigned)errors.corrected_errors,
 		   (unsigned)errors.corrected_packets,
 		   (int)radio_temperature(),
-		   (unsigned)duty_cycle_offset);
+		   (unsigned)duty_cycle_offset,
+		   (int)clock_drift);
 	statistics_receive_count = 0;
 }
 
@@ -218,14 +342,327 @@ display_test_output(void)
 /// @return			flight time in 16usec ticks
 static uint16_t flight_time_estimate(__pdata uint8_t packet_len)
 {
+	if (!packet_fec) {
+		return plain_packet_latency + (packet_len * plain_ticks_per_byte);
+	}
 	return packet_latency + (packet_len * ticks_per_byte);
 }
 
+/// serial backlog in the units sent in the trailer
+///
+static uint8_t
+tdm_backlog(void)
+{
+	__pdata uint16_t backlog = (serial_read_available() + packet_queue_bytes()) >> BACKLOG_SHIFT;
+	if (backlog > 0xFF) {
+		return 0xFF;
+	}
+	return backlog;
+}
+
+/// the transmit window width of a node
+///
+/// @param slot			the slot in the round, 0xFFFF if not synced
+///
+/// @return			window width in 16usec ticks
+static uint16_t
+tdm_window_width(__pdata uint16_t slot)
+{
+	if (slot < nodeCount-1 && slot < MAX_SLOT_NODES && slot_width[slot] != 0) {
+		return ((uint16_t)slot_width[slot]) << SLOT_WIDTH_SHIFT;
+	}
+	return tx_window_width;
+}
+
+/// the most data our own transmit window can carry in one packet,
+/// used to size the packets built ahead of the window
+///
+/// @return			payload bytes
+static uint8_t
+tdm_window_payload(void)
+{
+	__pdata uint16_t width = tdm_window_width(nodeId);
+	__pdata uint16_t overhead = silence_period + 2*packet_latency + (trailer_len+1)*ticks_per_byte;
+
+	if (feature_compress) {
+		// compression can add a byte
+		overhead += ticks_per_byte;
+	}
+
+	if (width <= overhead) {
+		return 0;
+	}
+	width = (width - overhead) / ticks_per_byte;
+	if (width > max_data_packet_length) {
+		return max_data_packet_length;
+	}
+	return width;
+}
+
+/// share of the round a node should get
+///
+/// @param node			the node id
+/// @param by_backlog		weight the share by the reported backlog
+///
+/// @return			the share of the node
+static uint16_t
+tdm_share(__pdata uint8_t node, __pdata uint8_t by_backlog)
+{
+	if (by_backlog) {
+		return slot_backlog[node] * (uint16_t)node_weights[node];
+	}
+	return node_weights[node];
+}
+
+/// build the round schedule from the node weights, and the reported
+/// backlog if by_backlog is set. The round is kept the same length as
+/// with fixed windows and everything above the minimum window is shared
+/// out between the nodes
+///
+static void
+tdm_build_schedule(__pdata uint8_t by_backlog)
+{
+	__pdata uint8_t i, n;
+	__pdata uint32_t total, width;
+	__pdata uint16_t share;
+	__pdata uint8_t uniform = true;
+
+	if (nodeCount-1 > MAX_SLOT_NODES) {
+		memset(slot_width, 0, sizeof(slot_width));
+		return;
+	}
+	n = nodeCount-1;
+
+	if (by_backlog) {
+		slot_backlog[nodeId] = tdm_backlog();
+		total = 0;
+		for (i=0; i<n; i++) {
+			total += tdm_share(i, true);
+		}
+		if (total == 0) {
+			// nobody has anything to send
+			by_backlog = false;
+		}
+	}
+	if (!by_backlog) {
+		total = 0;
+		for (i=0; i<n; i++) {
+			total += node_weights[i];
+			if (node_weights[i] != node_weights[0]) {
+				uniform = false;
+			}
+		}
+		if (uniform) {
+			// everyone gets the same tx_window_width
+			memset(slot_width, 0, sizeof(slot_width));
+			return;
+		}
+	}
+
+	for (i=0; i<n; i++) {
+		// the fraction of the round in 1/256ths of a window
+		share = (((uint32_t)tdm_share(i, by_backlog) * n) << 8) / total;
+		width = min_window_width + (((uint32_t)(tx_window_width - min_window_width) * share) >> 8);
+
+		// round up, and make sure it fits in the 13 bits of the trailer window
+		width = (width + (1<<SLOT_WIDTH_SHIFT) - 1) >> SLOT_WIDTH_SHIFT;
+		if (width > (0x1FFF >> SLOT_WIDTH_SHIFT)) {
+			width = 0x1FFF >> SLOT_WIDTH_SHIFT;
+		}
+		slot_width[i] = width;
+
+		// forget about nodes that stop reporting
+		slot_backlog[i] >>= 1;
+	}
+}
+
+// rebuild the round schedule after the node weights have changed
+//
+void
+tdm_update_schedule(void)
+{
+	tdm_build_schedule(false);
+}
+
+#define REGULATORY_MAX_WINDOW (((1000000UL/16)*4)/10)
+#define LBT_MIN_TIME_USEC 5000
+
+/// work out the TDM timing for the current air rate
+///
+static void
+tdm_set_timing(void)
+{
+	__pdata uint16_t i;
+	__pdata uint8_t air_rate = radio_air_rate();
+	__pdata uint32_t window_width;
+	__xdata struct param_timing *measured;
+
+	// calculate how many 16usec ticks it takes to send each byte
+	ticks_per_byte = (8+(8000000UL/(air_rate*1000UL)))/16;
+
+	// Check for rounding errors, and round up if needed..
+	if(10000UL*ticks_per_byte < (8+(8000000UL/(air_rate*1000UL)))*625) {
+		ticks_per_byte += 1;
+	}
+	
+	// calculate the minimum packet latency in 16 usec units
+	// we initially assume a preamble length of 40 bits, then
+	// adjust later based on actual preamble length. This is done
+	// so that if one radio has antenna diversity and the other
+	// doesn't, then they will both using the same TDM round timings
+	packet_latency = (8+(10/2)) * ticks_per_byte + 13;
+
+	plain_packet_latency = packet_latency;
+	plain_ticks_per_byte = ticks_per_byte;
+	plain_max_data_packet_length = MAX_PACKET_LENGTH - trailer_len;
+	if (feature_adaptive_fec) {
+		// room for the CRC the hardware no longer adds
+		plain_max_data_packet_length -= 2;
+	}
+
+	if (feature_golay || feature_adaptive_fec) {
+		max_data_packet_length = (MAX_PACKET_LENGTH/2) - (6+trailer_len);
+
+		// golay encoding doubles the cost per byte
+		ticks_per_byte *= 2;
+
+		// and adds 4 bytes
+		packet_latency += 4*ticks_per_byte;
+	} else {
+		max_data_packet_length = MAX_PACKET_LENGTH - trailer_len;
+	}
+
+	// set the silence period to between changing channels
+	silence_period = 2*packet_latency;
+
+	// set the transmit window to allow for 2 full sized packets
+	window_width = 2*((max_data_packet_length*(uint32_t)ticks_per_byte)+packet_latency) + silence_period + packet_latency;
+
+	// if LBT is enabled, we need at least 3*5ms of window width
+	if (lbt_rssi != 0) {
+		// min listen time is 5ms
+		lbt_min_time = LBT_MIN_TIME_USEC/16;
+		window_width = constrain(window_width, 3*lbt_min_time, window_width);
+	}
+
+	// make sure it fits in the 13 bits of the trailer window
+	if (window_width > 0x1FFF) {
+		window_width = 0x1FFF;
+	}
+	
+	// the window width cannot be more than 0.4 seconds to meet US regulations
+	if (window_width >= REGULATORY_MAX_WINDOW) {
+		window_width = REGULATORY_MAX_WINDOW;
+	}
+	
+	tx_window_width = window_width;
+	
+	// Window size of 4 statistic packets
+	window_width = 4*(((trailer_len)*(uint32_t)ticks_per_byte)+packet_latency) + silence_period + packet_latency;
+
+	// the base sends a byte per node in the sync packet
+	if (feature_demand_slots && nodeCount-1 <= MAX_SLOT_NODES) {
+		window_width += (nodeCount-1)*(uint32_t)ticks_per_byte;
+	}
+	// and the air rate change it has announced
+	if (min_air_rate != 0) {
+		window_width += 3*(uint32_t)ticks_per_byte;
+	}
+	// and the channels left out of the hopping
+	if (fhop_adaptive()) {
+		window_width += (1+FHOP_EXCLUSIONS_MAX)*(uint32_t)ticks_per_byte;
+	}
+	// and its clock, when the syncs are rounds apart
+	if (sync_rounds > 1) {
+		window_width += 3*(uint32_t)ticks_per_byte;
+	}
+	tx_sync_width = window_width;
+
+	// a window has to be able to carry a stats packet
+	min_window_width = silence_period + 3*packet_latency +
+		(trailer_len + 1 + STATS_HEADER_LEN + STATS_ENTRY_LEN +
+		 (fhop_adaptive() ? HOP_REPORT_LEN : 0)) * ticks_per_byte;
+	if (min_window_width > tx_window_width) {
+		min_window_width = tx_window_width;
+	}
+	state_width = tx_window_width;
+	memset(slot_backlog, 0, sizeof(slot_backlog));
+	tdm_build_schedule(false);
+	
+	// now adjust the packet_latency for the actual preamble
+	// length, so we get the right flight time estimates, while
+	// not changing the round timings. Timing measured on this
+	// board by tdm_calibrate_timing() already covers the preamble,
+	// and replaces the formula for the same estimates. The round
+	// itself has to stay on the formula, as every node must agree
+	// on it
+	measured = param_timing_find(air_rate);
+	i = (feature_golay || feature_adaptive_fec);
+	if (measured != NULL && measured->packet_latency[i] != 0) {
+		packet_latency = measured->packet_latency[i];
+		ticks_per_byte = measured->ticks_per_byte[i];
+	} else {
+		packet_latency += ((settings.preamble_length-10)/2) * ticks_per_byte;
+	}
+	if (measured != NULL && measured->packet_latency[0] != 0) {
+		plain_packet_latency = measured->packet_latency[0];
+		plain_ticks_per_byte = measured->ticks_per_byte[0];
+	} else {
+		plain_packet_latency += ((settings.preamble_length-10)/2) * plain_ticks_per_byte;
+	}
+
+	// tell the packet subsystem our max packet size, which it
+	// needs to know for MAVLink packet boundary detection. That is
+	// the size of a packet that isn't golay encoded, when we can
+	// choose
+	if (feature_golay) {
+		i = (tx_window_width - packet_latency) / ticks_per_byte;
+		if (i > max_data_packet_length) {
+			i = max_data_packet_length;
+		}
+	} else {
+		i = (tx_window_width - plain_packet_latency) / plain_ticks_per_byte;
+		if (i > plain_max_data_packet_length) {
+			i = plain_max_data_packet_length;
+		}
+	}
+	packet_set_max_xmit(i);
+
+	// wait a round and a window for an ARQ acknowledgement
+	window_width = tx_window_width*(uint32_t)nodeCount + tx_sync_width;
+	if (window_width > 0x8000) {
+		window_width = 0x8000;
+	}
+	packet_set_arq_timeout(window_width);
+}
+
+/// change the air rate, and the TDM timing that goes with it
+///
+static void
+tdm_switch_air_rate(__pdata uint8_t rate)
+{
+	// radio_configure() starts at minimum power
+	__pdata uint8_t txpower = radio_get_transmit_power();
+
+	radio_configure(rate);
+	radio_set_transmit_power(txpower);
+	radio_receiver_on();
+	tdm_set_timing();
+
+	// judge the new rate on what we hear at it
+	rate_switch_rounds = 0;
+	rate_period = 0;
+	links_clear_flag(LINK_RATE_HEARD);
+	rate_heard_any = false;
+}
+
 /// update the TDM state machine
 ///
 static void
 tdm_state_update(__pdata uint16_t tdelta)
 {
+	__pdata uint16_t slot;
+
 	// update the amount of time we are waiting for a preamble
 	// to turn into a real packet
 	if (tdelta > transmit_wait) {
@@ -240,6 +677,32 @@ tdm_state_update(__pdata uint16_t tdelta)
 		// Tickle Watchdog
 		PCA0CPH5 = 0;
 #endif // WATCH_DOG_ENABLE
+		// the slot we are moving into
+		slot = (nodeTransmitSeq < 0x8000) ? nodeTransmitSeq % nodeCount : 0xFFFF;
+
+		// a round without a sync goes straight on to the first
+		// window of the next. A node that joined from the data
+		// can only tell the round from the channels, so until it
+		// has had a sync it listens for one every round
+		if (slot == nodeCount-1 && (uint16_t)(tdm_round+1) % sync_rounds != 0 &&
+		    (nodeId == BASE_NODEID || base_synced)) {
+			tdm_round = (tdm_round + 1) & 0x7FFF;
+			nodeTransmitSeq = 0;
+			slot = 0;
+#if USE_TICK_YIELD
+			// the base's window can't be ours, as after a sync
+			if (nodeId != BASE_NODEID) {
+				lastTransmitWindow = nodeId | 0x8000;
+			}
+#endif // USE_TICK_YIELD
+		}
+
+		// count the windows that went as we expected
+		if (window_confirmed && sync_count < 0xFF) {
+			sync_count++;
+		}
+		window_confirmed = false;
+
 		if ((nodeTransmitSeq < 0x8000 || nodeId == BASE_NODEID) && (nodeTransmitSeq++ % nodeCount) == nodeId) {
 			tdm_state = TDM_TRANSMIT;
 			nodeTransmitSeq %= nodeCount;
@@ -265,13 +728,25 @@ tdm_state_update(__pdata uint16_t tdelta)
 		// work out the time remaining in this state
 		tdelta -= tdm_state_remaining;
 
-		if (tdm_state == TDM_SYNC)
+		if (tdm_state == TDM_SYNC) {
+			tdm_round = (tdm_round + 1) & 0x7FFF;
+			// a rate change the base announced happens as the
+			// round starts
+			if (rate_switch_rounds != 0 && --rate_switch_rounds == 0) {
+				tdm_switch_air_rate(rate_switch_to);
+			}
+			// and so does a change to the channels we hop over
+			fhop_round_start();
 			tdm_state_remaining = tx_sync_width;
-		else {
-			tdm_state_remaining = tx_window_width;
+			if (feature_demand_slots && nodeId == BASE_NODEID) {
+				tdm_build_schedule(true);
+			}
+		} else {
+			tdm_state_remaining = tdm_window_width(slot);
 			// change frequency when finishing transmitting or reciving
-			fhop_window_change();
+			fhop_set_window(tdm_round, slot, nodeCount-1);
 		}
+		state_width = tdm_state_remaining;
 		
 		radio_receiver_on();
 
@@ -283,7 +758,7 @@ tdm_state_update(__pdata uint16_t tdelta)
 
 		if (tdm_state == TDM_TRANSMIT && (duty_cycle - duty_cycle_offset) != 100) {
 			// update duty cycle averages
-			average_duty_cycle = (0.95*average_duty_cycle) + (0.05*(100.0*transmitted_ticks)/(2*(silence_period+tx_window_width)));
+			average_duty_cycle = (0.95*average_duty_cycle) + (0.05*(100.0*transmitted_ticks)/(2*(silence_period+state_width)));
 			transmitted_ticks = 0;
 			duty_cycle_wait = (average_duty_cycle >= (duty_cycle - duty_cycle_offset));
 		}
@@ -428,6 +903,267 @@ static void temperature_update(void)
 }
 
 
+/// fold the receive errors since the last link update into
+/// recent_errors. Golay corrected packets count too, as a sign of a
+/// marginal link
+///
+static void
+tdm_count_errors(void)
+{
+	__pdata uint16_t count = errors.rx_errors + errors.corrected_packets;
+	__pdata uint16_t n = (uint16_t)(count - last_error_count) + recent_errors/2;
+
+	last_error_count = count;
+	recent_errors = (n > 0xFF) ? 0xFF : n;
+}
+
+/// count a packet received from a node for adaptive FEC, along with
+/// the corrections and failures since the last one. The packets in a
+/// window come from one node, so most of those are from the same node
+///
+static void
+tdm_fec_count(__pdata uint8_t peer)
+{
+	__pdata uint16_t count = errors.rx_errors + errors.corrected_packets;
+	__pdata uint16_t bad = count - fec_error_count;
+
+	fec_error_count = count;
+	if (peer == LINK_NONE) {
+		return;
+	}
+	if (links[peer].fec_received != 0xFF) {
+		links[peer].fec_received++;
+	}
+	bad += links[peer].fec_bad;
+	links[peer].fec_bad = (bad > 0xFF) ? 0xFF : bad;
+}
+
+/// work out the share of bad packets we report to each node, and from
+/// what they report decide which nodes we golay encode packets for.
+/// Called on each link update
+///
+static void
+tdm_fec_update(void)
+{
+	__pdata uint8_t i;
+	__pdata uint16_t total;
+
+	// nodes that don't fit in the link table never tell us how
+	// they are doing
+	fec_broadcast = (nodeCount-2 > MAX_LINKS);
+
+	for (i = 0; i < MAX_LINKS; i++) {
+		if (links[i].node == LINK_FREE) {
+			continue;
+		}
+		total = links[i].fec_received + links[i].fec_bad;
+		if (total != 0) {
+			statistics[i].fec_errors = ((255U*links[i].fec_bad)/total + statistics[i].fec_errors)/2;
+		}
+		links[i].fec_received = 0;
+		links[i].fec_bad = 0;
+
+		if ((links[i].flags & LINK_REPORTED) == 0 ||
+		    remote_statistics[i].fec_errors >= FEC_ON_SCORE) {
+			// no word from it yet, or a poor link
+			links[i].fec_hold = FEC_HOLD;
+		} else if (links[i].fec_hold != 0 && remote_statistics[i].fec_errors <= FEC_OFF_SCORE) {
+			links[i].fec_hold--;
+		}
+		// a node we haven't heard lately is not there to need it
+		if (links[i].fec_hold != 0 && links[i].age < LINK_STALE) {
+			fec_broadcast = true;
+		}
+	}
+}
+
+/// whether to golay encode a packet for a destination
+///
+static bool
+tdm_fec_wanted(__pdata uint16_t destination)
+{
+	__pdata uint8_t peer;
+
+	if (destination == 0xFFFF) {
+		return fec_broadcast;
+	}
+	peer = link_find(destination);
+	return peer == LINK_NONE || links[peer].fec_hold != 0;
+}
+
+/// how far a signal is above the noise
+///
+static uint8_t
+tdm_link_margin(__pdata uint8_t rssi, __pdata uint8_t noise)
+{
+	return (rssi > noise) ? rssi - noise : 0;
+}
+
+/// pick the air rate for the network from the worst link between the
+/// base and the nodes it heard lately, in either direction, and the
+/// errors everyone reports. Called by the base on each link update
+///
+static void
+tdm_rate_update(void)
+{
+	__pdata uint8_t i, margin, worst = 0xFF, errs = recent_errors, rate;
+
+	if (++rate_period < RATE_PERIOD || rate_switch_rounds != 0) {
+		return;
+	}
+	rate_period = 0;
+	if (rate_up_hold != 0) {
+		rate_up_hold--;
+	}
+
+	for (i = 0; i < MAX_LINKS; i++) {
+		if ((links[i].flags & LINK_RATE_HEARD) == 0) {
+			continue;
+		}
+		margin = tdm_link_margin(statistics[i].average_rssi, link_noise);
+		if (margin < worst) {
+			worst = margin;
+		}
+		// the node may not have sent its statistics yet
+		if (links[i].flags & LINK_REPORTED) {
+			margin = tdm_link_margin(remote_statistics[i].average_rssi, remote_statistics[i].average_noise);
+			if (margin < worst) {
+				worst = margin;
+			}
+		}
+		if (remote_statistics[i].errors > errs) {
+			errs = remote_statistics[i].errors;
+		}
+	}
+
+	rate = radio_air_rate();
+	if (!rate_heard_any || worst < RATE_DOWN_MARGIN || errs >= RATE_DOWN_ERRORS) {
+		// slow down. When we hear nobody at all this brings us
+		// to where nodes searching the rates will find us
+		rate = radio_next_air_rate(rate, false);
+		if (rate < min_air_rate) {
+			rate = radio_air_rate();
+		}
+		if (errs >= RATE_DOWN_ERRORS) {
+			rate_up_hold = RATE_UP_HOLD;
+		}
+	} else if (worst != 0xFF && worst >= RATE_UP_MARGIN && errs == 0 && rate_up_hold == 0 &&
+		   nodeCount-2 <= MAX_LINKS) {
+		// nodes that don't fit in the link table can't be
+		// judged, so only speed up when every node fits
+		rate = radio_next_air_rate(rate, true);
+		if (rate > max_air_rate) {
+			rate = radio_air_rate();
+		}
+	}
+	links_clear_flag(LINK_RATE_HEARD);
+	rate_heard_any = false;
+
+	if (rate != radio_air_rate()) {
+		debug("air rate %u -> %u\n", (unsigned)radio_air_rate(), (unsigned)rate);
+		rate_switch_to = rate;
+		rate_switch_rounds = RATE_SWITCH_ROUNDS;
+	}
+}
+
+/// charge the receive errors since we last looked to the channel we
+/// are on. Called before we change channel
+///
+static void
+tdm_channel_errors(void)
+{
+	__pdata uint16_t count = errors.rx_errors;
+
+	if (count != channel_error_count) {
+		fhop_channel_errors(radio_get_channel(), count - channel_error_count);
+		channel_error_count = count;
+	}
+}
+
+/// extend timer2 to 32 bits. It needs calling at least once a second
+///
+static uint32_t
+tdm_clock(__pdata uint16_t tnow)
+{
+	clock_ticks += (uint16_t)(tnow - (uint16_t)clock_ticks);
+	return clock_ticks;
+}
+
+/// take the base's tick from a sync that got to us at tnow, and once
+/// a DRIFT_PERIOD work out how fast our clock runs against the base's
+///
+static void
+tdm_clock_sample(__pdata uint16_t tnow, __pdata uint16_t tick)
+{
+	__pdata uint32_t now = tdm_clock(tnow);
+	__pdata uint32_t ticks = (uint16_t)(tick - (uint16_t)base_clock);
+	__pdata int32_t offset, drift;
+
+	if (!base_clock_valid) {
+		base_clock = tick;
+		base_clock_valid = true;
+		min_offset_valid = false;
+		prev_min_offset_valid = false;
+		period_start = now;
+	} else {
+		// the base's tick may have wrapped more than once since
+		// the last sync, which our own clock tells us
+		ticks += (now - last_clock_sync - ticks + 0x8000) & 0xFFFF0000UL;
+		base_clock += ticks;
+	}
+	last_clock_sync = now;
+
+	// a sync can only be late getting to us, so the smallest offset
+	// is the truest
+	offset = now - base_clock;
+	if (!min_offset_valid || offset < min_offset) {
+		min_offset = offset;
+		min_offset_at = now;
+		min_offset_valid = true;
+	}
+	if (now - period_start < DRIFT_PERIOD) {
+		return;
+	}
+	if (prev_min_offset_valid && min_offset_at - prev_min_offset_at >= DRIFT_PERIOD/2) {
+		// the ticks we gained on the base, per 2^20
+		drift = ((min_offset - prev_min_offset) << 8) /
+			(int32_t)((min_offset_at - prev_min_offset_at) >> 12);
+		if (drift > DRIFT_MAX) {
+			drift = DRIFT_MAX;
+		} else if (drift < -DRIFT_MAX) {
+			drift = -DRIFT_MAX;
+		}
+		clock_drift += ((int16_t)drift - clock_drift) / 2;
+	}
+	prev_min_offset = min_offset;
+	prev_min_offset_at = min_offset_at;
+	prev_min_offset_valid = true;
+	min_offset_valid = false;
+	period_start = now;
+}
+
+/// stretch or shrink the current window by the ticks our clock has
+/// gained or lost on the base's since the last call
+///
+static void
+tdm_drift_fix(__pdata uint16_t tnow)
+{
+	__pdata uint32_t now = tdm_clock(tnow);
+	__pdata int16_t fix;
+
+	drift_remainder += (int32_t)(now - last_drift_fix) * clock_drift;
+	last_drift_fix = now;
+	fix = drift_remainder / 0x100000L;
+	drift_remainder -= (int32_t)fix * 0x100000L;
+
+	// a fast clock would end the window early
+	if (fix >= 0 || tdm_state_remaining > (uint16_t)-fix) {
+		tdm_state_remaining += fix;
+	} else {
+		tdm_state_remaining = 0;
+	}
+}
+
 /// blink the radio LED if we have not received any packets
 ///
 static uint8_t unlock_count, temperature_count;
@@ -449,12 +1185,14 @@ link_update(void)
 		LED_RADIO = LED_ON;
 	} else {
 		sync_count = 0;
+		base_synced = false;
 		LED_RADIO = blink_state;
 		blink_state = !blink_state;
 		nodeTransmitSeq = 0xFFFF;
+		rate_switch_rounds = 0;
+		base_clock_valid = false;
 		
-		memset(remote_statistics, 0, sizeof(remote_statistics));
-		memset(statistics, 0, sizeof(statistics));
+		links_reset();
 		
 		// reset statistics when unlocked
 		statistics_receive_count = 0;
@@ -464,7 +1202,28 @@ link_update(void)
 #endif // TDM_SYNC_LOGIC
 	}
 	
+	links_age();
+	tdm_count_errors();
+	if (feature_adaptive_fec) {
+		tdm_fec_update();
+	}
+	if (min_air_rate != 0 && nodeId == BASE_NODEID) {
+		tdm_rate_update();
+	}
+	if (fhop_adaptive()) {
+		fhop_quality_update(nodeId == BASE_NODEID);
+	}
+
 	if (unlock_count % 5 == 4) {
+		if (min_air_rate != 0 && nodeId != BASE_NODEID && unlock_count >= 6) {
+			// the base may have changed rate without us. Step
+			// through the rates it can use until we find it
+			__pdata uint8_t rate = radio_next_air_rate(radio_air_rate(), true);
+			if (rate == radio_air_rate() || rate > max_air_rate) {
+				rate = min_air_rate;
+			}
+			tdm_switch_air_rate(rate);
+		}
 		if(sync_any) {
 			fhop_window_change(); // Try our luck on another channel
 		}
@@ -548,6 +1307,36 @@ handle_at_command(__pdata uint8_t len)
 // a stack carary to detect a stack overflow
 __at(0xFF) uint8_t __idata _canary;
 
+/// finish off a packet from tdm_serial_loop() once it is off the air,
+/// or when it could not be started
+///
+/// @param sent			whether the packet was sent
+///
+static void
+tdm_transmit_done(bool sent)
+{
+	transmit_in_progress = false;
+	if (!sent && transmit_has_data) {
+		packet_force_resend();
+	}
+
+	if (lbt_rssi != 0) {
+		// reset the LBT listen time
+		lbt_listen_time = 0;
+		lbt_rand = 0;
+	}
+
+	// set right receive channel
+	radio_set_channel(fhop_receive_channel());
+
+	// re-enable the receiver
+	radio_receiver_on();
+
+	if (transmit_has_data && trailer.window != 0) {
+		LED_ACTIVITY = LED_OFF;
+	}
+}
+
 /// main loop for time division multiplexing transparent serial
 ///
 void
@@ -559,9 +1348,11 @@ tdm_serial_loop(void)
 	_canary = 42;
 
 	for (;;) {
-		__pdata uint8_t	len;
+		__pdata uint8_t	len, peer;
 		__pdata uint16_t tnow, tdelta;
 		__pdata uint8_t max_xmit;
+		__pdata uint16_t room;
+		__xdata uint8_t * __pdata tbuf;
 
 		if (_canary != 42) {
 			panic("stack blown\n");
@@ -589,6 +1380,20 @@ tdm_serial_loop(void)
 			MAVLink_report();
 		}
 
+		// the radio is ours again once our packet is off the air.
+		// Meanwhile build the next packet, unless it would take
+		// the place of the one on the air before we know whether
+		// that has to be resent
+		if (transmit_in_progress) {
+			if (radio_transmit_busy()) {
+				if (!transmit_has_data || packet_resend_held()) {
+					packet_queue_fill(tdm_window_payload());
+				}
+				continue;
+			}
+			tdm_transmit_done(radio_transmit_result());
+		}
+
 		// get the time before we check for a packet coming in
 		tnow = timer2_tick();
 
@@ -598,7 +1403,7 @@ tdm_serial_loop(void)
 			// any more
 			transmit_wait = 0;
 
-			if (len < sizeof(trailer)) {
+			if (len < trailer_len) {
 				// not a valid packet. We always send
 				// trailer at the end of every packet
 				
@@ -618,57 +1423,137 @@ tdm_serial_loop(void)
 #endif // USE_TICK_YIELD
 			
 			// extract control bytes from end of packet
-			memcpy(&trailer, pbuf +len-sizeof(trailer), sizeof(trailer));
-			len -= sizeof(trailer);
+			memcpy(&trailer, pbuf +len-trailer_len, trailer_len);
+			len -= trailer_len;
+
+			peer = link_heard((trailer.nodeid & 0x8000) ? BASE_NODEID : trailer.nodeid);
+			if (feature_adaptive_fec && peer != LINK_NONE) {
+				tdm_fec_count(peer);
+			}
+
+			if (feature_arq && trailer.ack.node == nodeId) {
+				packet_arq_put_ack(&trailer.ack);
+			}
 
 			// Sync the timing sequence with the incoming packet
-			// trailer.nodeid in a sync byte is the next channel to receive/transmit on
+			// trailer.nodeid in a sync byte is the round number
 			if(trailer.nodeid & 0x8000){
-				if(sync_count < 0xFF && nodeTransmitSeq == 0){
-					sync_count += 1;
+				__pdata uint8_t pos = 0, used;
+
+				if(tdm_state == TDM_SYNC || nodeTransmitSeq == 0){
+					window_confirmed = true;
 				}
 				nodeTransmitSeq = 0;
-				set_transmit_channel(trailer.nodeid & 0x7FFF);
+				tdm_round = trailer.nodeid & 0x7FFF;
 				received_sync = true;
+				base_synced = true;
+				fhop_set_locked(true);
+				// the base sends the slot allocation for this round with the sync
+				if (feature_demand_slots && nodeCount-1 <= MAX_SLOT_NODES && len >= nodeCount-1) {
+					pos = nodeCount-1;
+					memcpy(slot_width, pbuf, pos);
+				}
+				// followed by the items. The last sync of a
+				// window may have no room for them, so a
+				// countdown carries on without them
+				while (pos < len) {
+					if (pbuf[pos] == SYNC_ITEM_RATE && min_air_rate != 0 && len >= pos+3) {
+						rate_switch_to = pbuf[pos+1];
+						rate_switch_rounds = pbuf[pos+2];
+						pos += 3;
+					} else if (pbuf[pos] == SYNC_ITEM_CHANNELS && fhop_adaptive() &&
+						   (used = fhop_set_exclusions(pbuf+pos+1, len-pos-1)) != 0) {
+						pos += 1+used;
+					} else if (pbuf[pos] == SYNC_ITEM_CLOCK && len >= pos+3) {
+						tdm_clock_sample(tnow, pbuf[pos+1] | ((uint16_t)pbuf[pos+2] << 8));
+						pos += 3;
+					} else {
+						break;
+					}
+				}
 				continue;
 			}
-			// We dont want to sync off nodes sending bonus data
-			else if (sync_any && !trailer.bonus) {
-				if(sync_count < 0xFF && nodeTransmitSeq == trailer.nodeid + 1){
-					sync_count += 1;
+			// We dont want to sync off nodes sending bonus data.
+			// Until we are sure of the schedule a packet from
+			// any node in its own window gives us its slot, and
+			// the channel it came on gives us the round
+			else if ((sync_any || sync_count < SYNC_CONFIRM) && !trailer.bonus && trailer.window != 0 &&
+				 trailer.nodeid < nodeCount-1 && nodeId != BASE_NODEID) {
+				if (nodeTransmitSeq == trailer.nodeid + 1) {
+					window_confirmed = true;
+					received_sync = true;
+				} else {
+					__pdata uint16_t round = fhop_find_round(radio_get_channel(), trailer.nodeid, nodeCount-1);
+					if (round != 0xFFFF) {
+						tdm_round = round;
+						nodeTransmitSeq = trailer.nodeid + 1;
+						received_sync = true;
+						fhop_set_locked(true);
+					}
 				}
-				nodeTransmitSeq = trailer.nodeid + 1;
+			}
+			// between syncs any node heard in its own window
+			// keeps us locked
+			else if (!trailer.bonus && trailer.window != 0 && trailer.nodeid < nodeCount-1 &&
+				 nodeTransmitSeq < 0x8000 && nodeTransmitSeq % nodeCount == trailer.nodeid + 1) {
 				received_sync = true;
 			}
 			
+			// the base needs the backlog of every node to allocate slots
+			if (feature_demand_slots && trailer.nodeid < MAX_SLOT_NODES) {
+				slot_backlog[trailer.nodeid] = trailer.backlog;
+			}
+
 			// update filtered RSSI value and packet stats
-			if(trailer.nodeid < MAX_NODE_RSSI_STATS) {
-				statistics[trailer.nodeid].average_rssi = (radio_last_rssi() + 7*(uint16_t)statistics[trailer.nodeid].average_rssi)/8;
+			if (peer != LINK_NONE) {
+				links[peer].flags |= LINK_RATE_HEARD;
+				statistics[peer].average_rssi = (radio_last_rssi() + 7*(uint16_t)statistics[peer].average_rssi)/8;
 			}
 			statistics_receive_count++;
+			rate_heard_any = true;
 			
 			if (trailer.window == 0 && len != 0) {
-				// its a control packet
-				if (len == (sizeof(struct statistics)+sizeof(statistics_transmit_stats)) && trailer.nodeid < MAX_NODE_RSSI_STATS) {
-					len -= sizeof(statistics_transmit_stats);
-					// Get the last two bytes from the packet and compare them against our nodeId
-					if(((uint16_t*)(pbuf+len))[0] == nodeId)
-					{
-						memcpy(remote_statistics +trailer.nodeid, pbuf, len);
+				// its a control packet. The base takes the
+				// worst channel of the sender from after its
+				// header, and we take how the sender hears us
+				// from the entry with our node id
+				__pdata uint8_t hdr = STATS_HEADER_LEN + (fhop_adaptive() ? HOP_REPORT_LEN : 0);
+				if (len >= hdr && (len - hdr) % STATS_ENTRY_LEN == 0) {
+					if (fhop_adaptive() && nodeId == BASE_NODEID) {
+						fhop_channel_report(pbuf+STATS_HEADER_LEN);
+					}
+					if (peer != LINK_NONE) {
+						remote_statistics[peer].average_noise = pbuf[0];
+						remote_statistics[peer].errors = pbuf[1];
+						for (; hdr < len; hdr += STATS_ENTRY_LEN) {
+							if ((pbuf[hdr] | ((uint16_t)pbuf[hdr+1] << 8)) == nodeId) {
+								remote_statistics[peer].average_rssi = pbuf[hdr+2];
+								remote_statistics[peer].fec_errors = pbuf[hdr+3];
+								links[peer].flags |= LINK_REPORTED;
+								break;
+							}
+						}
 					}
 				}
 
 				// don't count control packets in the stats
 				statistics_receive_count--;
 			} else if (trailer.window != 0) {
-				tdm_state_remaining = trailer.window;
+				// the owner of another window, heard on the
+				// channel we share with it, can't tell us where
+				// ours ends. Without a sync every round nothing
+				// else would put us back in step
+				if (trailer.bonus || trailer.nodeid >= nodeCount-1 || nodeTransmitSeq >= 0x8000 ||
+				    nodeTransmitSeq % nodeCount == trailer.nodeid + 1) {
+					tdm_state_remaining = trailer.window;
 				
 #if USE_TICK_YIELD
-				// if the other end has sent a zero length packet and we are
-				// in their transmit window then they are yielding some ticks to us.
-				tdm_yield_update(YIELD_SET, len==0);
+					// if the other end has sent a zero length packet and we are
+					// in their transmit window then they are yielding some ticks to us.
+					tdm_yield_update(YIELD_SET, len==0);
 #endif // USE_TICK_YIELD
-				last_t = tnow;
+					last_t = tnow;
+				}
 
 				if (trailer.command == 1) {
 					// Skip Interupt packets (sent at the start of talking control of someone elses slot)
@@ -677,11 +1562,17 @@ tdm_serial_loop(void)
 						handle_at_command(len);
 					}
 				} else if (len != 0 && 
-					   !packet_is_duplicate(len, pbuf, trailer.resend) &&
+					   !(feature_arq ?
+					     packet_arq_is_duplicate(trailer.nodeid, trailer.seq) :
+					     packet_is_duplicate(trailer.nodeid, len, pbuf, trailer.resend)) &&
 					   !at_mode_active) {
 					// its user data - send it out the serial port
 					LED_ACTIVITY = LED_ON;
-					serial_write_buf(pbuf, len);
+					if (feature_compress) {
+						decompress_packet(pbuf, len);
+					} else {
+						serial_write_buf(pbuf, len);
+					}
 					LED_ACTIVITY = LED_OFF;
 				}
 			}
@@ -693,31 +1584,40 @@ tdm_serial_loop(void)
 		// packet could have cost us a lot of time.
 		tnow = timer2_tick();
 		tdelta = tnow - last_t;
+		if (fhop_adaptive()) {
+			tdm_channel_errors();
+		}
 		tdm_state_update(tdelta);
 		last_t = tnow;
 
+		// get packets ready for when our window opens
+		if (tdm_state != TDM_TRANSMIT) {
+			packet_queue_fill(tdm_window_payload());
+		}
+
 		// wait for the silence period to expire, to allow radio's to switch channel
-		if( (tdm_state_remaining > tx_window_width-silence_period) ||
-		    (tdm_state == TDM_SYNC && tdm_state_remaining > tx_sync_width-silence_period))
-		{
+		if (tdm_state_remaining > state_width-silence_period) {
 			continue;
 		}
 		
 		// update link status approximately every 0.5s
-		if (tnow - last_link_update > 32768) {
+		if ((uint16_t)(tnow - last_link_update) > 32768) {
 			link_update();
+			tdm_drift_fix(tnow);
 			last_link_update = tnow;
 		}
 
 		if (lbt_rssi != 0) {
-			// implement listen before talk
-			if (radio_current_rssi() < lbt_rssi) {
-				lbt_listen_time += tdelta;
-			} else {
+			// implement listen before talk. A node backing off
+			// for a yielded window listens once its back off is
+			// over, so the back off still sets who goes first
+			if (radio_current_rssi() >= lbt_rssi) {
 				lbt_listen_time = 0;
 				if (lbt_rand == 0) {
 					lbt_rand = ((uint16_t)rand()) % lbt_min_time;
 				}
+			} else if (transmit_wait == 0) {
+				lbt_listen_time += tdelta;
 			}
 			if (lbt_listen_time < lbt_min_time + lbt_rand) {
 				// we need to listen some more
@@ -782,15 +1682,18 @@ tdm_serial_loop(void)
 		PCA0CPH5 = 0;
 #endif // WATCH_DOG_ENABLE
 		
-		// Dont send anything until we have received 20 good sync bytes
-		if (nodeId != BASE_NODEID && sync_count < 20) {
+		// Dont send anything until we are sure of the schedule
+		if (nodeId != BASE_NODEID && (sync_count < SYNC_CONFIRM || !base_synced)) {
 			continue;
 		}
 
 		// sample the background noise when it is out turn to
 		// transmit, but we are not transmitting,
 		// averaged over around 4 samples
-		statistics[nodeId].average_noise = (radio_current_rssi() + 3*(uint16_t)statistics[nodeId].average_noise)/4;
+		link_noise = (radio_current_rssi() + 3*(uint16_t)link_noise)/4;
+		if (fhop_adaptive()) {
+			fhop_channel_noise(radio_get_channel(), radio_current_rssi());
+		}
 
 		if (duty_cycle_wait) {
 			// we're waiting for our duty cycle to drop
@@ -804,22 +1707,42 @@ tdm_serial_loop(void)
 			continue;
 		}
 		
+		// choose the coding of this packet, which sets what it
+		// costs. The sync holds the network together, so it is
+		// always golay encoded
+		packet_fec = feature_golay;
+		if (feature_adaptive_fec) {
+			packet_fec = (tdm_state == TDM_SYNC || tdm_fec_wanted(paramNodeDestination));
+		}
+		radio_set_transmit_fec(packet_fec);
+
 		// leave 1 packet_latency at the end of the transmit and another at the end of the sequence
 		if((signed) tdm_state_remaining - 2*(signed)packet_latency < 0) {
-			max_xmit = 0;
+			room = 0;
+		}
+		else if (packet_fec) {
+			room = (tdm_state_remaining - 2*packet_latency) / ticks_per_byte;
 		}
 		else {
-			max_xmit = (tdm_state_remaining - 2*packet_latency) / ticks_per_byte;
+			room = (tdm_state_remaining - 2*packet_latency) / plain_ticks_per_byte;
 		}
-		if (max_xmit < sizeof(trailer)+1) {
+		if (room < trailer_len+1) {
 			// can't fit the trailer in with a byte to spare
 			
 			continue;
 		}
-		max_xmit -= sizeof(trailer)+1;
-		if (max_xmit > max_data_packet_length) {
-			max_xmit = max_data_packet_length;
+		room -= trailer_len+1;
+		max_xmit = packet_fec ? max_data_packet_length : plain_max_data_packet_length;
+		if (room < max_xmit) {
+			max_xmit = room;
 		}
+		if (feature_compress && max_xmit != 0) {
+			// leave room for the byte compression can add
+			max_xmit--;
+		}
+
+		// everything but queued packets is built in pbuf
+		tbuf = pbuf;
 
 #if USE_TICK_YIELD
 		// Check to see if we need to send a dummy packet to inform everyone in the network we want to send data.
@@ -827,7 +1750,7 @@ tdm_serial_loop(void)
 		if(serial_read_available() > 0 && transmit_yield && tdm_state == TDM_RECEIVE)
 		{
 			// if more than 1/4 of the slot is passed it wouldn't be worth transmitting in this slot
-			if(tdm_state_remaining < tx_window_width/4) {
+			if(tdm_state_remaining < state_width/4) {
 				continue;
 			}
 			
@@ -851,13 +1774,54 @@ tdm_serial_loop(void)
 				send_at_command = false;
 			} else {
 				// get a packet from the serial port
-				len = packet_get_next(max_xmit, pbuf);
+				len = packet_get_next(max_xmit);
+				if (len != 0) {
+					tbuf = packet_frame();
+				}
 				trailer.command = packet_is_injected();
 				
 				// If it's a AT return packet, set the return address
 				if(trailer.command) {
 					nodeDestination = send_at_command_to;
+					// the next inject reuses the packet's buffer
+					memcpy(pbuf, tbuf, len);
+					tbuf = pbuf;
 					packet_ati5_inject(ati5_id++);
+				} else if (len != 0 && feature_compress) {
+					len = compress_packet(tbuf, len, pbuf);
+					tbuf = pbuf;
+				}
+			}
+		}
+		else if (nodeId == BASE_NODEID) {
+			len = 0;
+			if (feature_demand_slots && nodeCount-1 <= MAX_SLOT_NODES) {
+				// the sync carries the slot allocation for the next round
+				if (max_xmit >= nodeCount-1) {
+					len = nodeCount-1;
+					memcpy(pbuf, slot_width, len);
+				}
+			}
+			// and the items, which the nodes can only find after
+			// the slot allocation
+			if (len != 0 || !feature_demand_slots || nodeCount-1 > MAX_SLOT_NODES) {
+				// the countdown to an air rate change
+				if (rate_switch_rounds != 0 && max_xmit >= len+3) {
+					pbuf[len++] = SYNC_ITEM_RATE;
+					pbuf[len++] = rate_switch_to;
+					pbuf[len++] = rate_switch_rounds;
+				}
+				// the channels left out of the hopping
+				if (fhop_adaptive() && max_xmit >= len+1+FHOP_EXCLUSIONS_MAX) {
+					pbuf[len++] = SYNC_ITEM_CHANNELS;
+					len += fhop_get_exclusions(pbuf+len);
+				}
+				// our clock, for the nodes to find their drift
+				if (sync_rounds > 1 && max_xmit >= len+3) {
+					__pdata uint16_t tick = timer2_tick();
+					pbuf[len++] = SYNC_ITEM_CLOCK;
+					pbuf[len++] = tick & 0xFF;
+					pbuf[len++] = tick >> 8;
 				}
 			}
 		}
@@ -865,36 +1829,41 @@ tdm_serial_loop(void)
 			len = 0;
 		}
 
-		if (len > max_data_packet_length) {
+		if (len > (packet_fec ? max_data_packet_length : plain_max_data_packet_length)) {
 			panic("oversized tdm packet");
 		}
 
 		trailer.bonus = (tdm_state == TDM_RECEIVE);
 		trailer.resend = packet_is_resend();
+		trailer.seq = packet_seq();
 			
 		// Are we in transmit phase and have space for a stats packet
-		if (tdm_state == TDM_TRANSMIT && len == 0 && max_xmit >= (sizeof(statistics)+sizeof(statistics_transmit_stats))
+		if (tdm_state == TDM_TRANSMIT && len == 0 &&
+		    max_xmit >= STATS_HEADER_LEN + STATS_ENTRY_LEN + (fhop_adaptive() ? HOP_REPORT_LEN : 0)
 		// Do we need to send a stats packet
-			&& statistics_transmit_stats < (nodeCount-1) && nodeId < MAX_NODE_RSSI_STATS 
+			&& statistics_transmit_stats < MAX_LINKS
 		// Yeild at the start of our time period to allow better data throughput
-			&& tdm_state_remaining < (tx_window_width-packet_latency*2)) {
+			&& tdm_state_remaining < (state_width-packet_latency*2)) {
 			
-			// Catch for Node 0
-			if(statistics_transmit_stats == nodeId) {
-				statistics_transmit_stats++;
+			tbuf = pbuf;
+			pbuf[0] = link_noise;
+			pbuf[1] = recent_errors;
+			len = STATS_HEADER_LEN;
+			if (fhop_adaptive()) {
+				fhop_worst_channel(pbuf+len);
+				len += HOP_REPORT_LEN;
 			}
 			
-			len = sizeof(struct statistics);
-			statistics[statistics_transmit_stats].average_noise = statistics[nodeId].average_noise;
-			memcpy(pbuf, statistics+statistics_transmit_stats, len);
-			memcpy(pbuf+len, &statistics_transmit_stats, sizeof(statistics_transmit_stats));
-			len += sizeof(statistics_transmit_stats);
-			
-			statistics_transmit_stats++;
-			
-			// Catch for last node
-			if(statistics_transmit_stats == nodeId) {
-				statistics_transmit_stats++;
+			// as many links as fit, carrying on from the last packet
+			while (statistics_transmit_stats < MAX_LINKS &&
+			       len + STATS_ENTRY_LEN <= max_xmit) {
+				__pdata uint8_t i = statistics_transmit_stats++;
+				if (links[i].node != LINK_FREE) {
+					pbuf[len++] = links[i].node & 0xFF;
+					pbuf[len++] = links[i].node >> 8;
+					pbuf[len++] = statistics[i].average_rssi;
+					pbuf[len++] = statistics[i].fec_errors;
+				}
 			}
 
 			// mark a stats packet with a zero window
@@ -909,22 +1878,26 @@ tdm_serial_loop(void)
 			// calculate the control word as the number of
 			// 16usec ticks that will be left in this
 			// tdm state after this packet is transmitted
-			trailer.window = (uint16_t)(tdm_state_remaining - flight_time_estimate(len+sizeof(trailer)));
+			trailer.window = (uint16_t)(tdm_state_remaining - flight_time_estimate(len+trailer_len));
 		}
 
-		// if in sync mode and we are the base, add the channel and sync bit
+		// if in sync mode and we are the base, add the round and sync bit
 		if (tdm_state == TDM_SYNC && nodeId == BASE_NODEID) {
-			trailer.nodeid = get_transmit_channel() | 0x8000;
+			trailer.nodeid = tdm_round | 0x8000;
 		} else {
 			trailer.nodeid = nodeId;
 		}
+		trailer.backlog = tdm_backlog();
+		if (feature_arq) {
+			packet_arq_get_ack(&trailer.ack);
+		}
 
-		memcpy(pbuf+len, &trailer, sizeof(trailer));
+		memcpy(tbuf+len, &trailer, trailer_len);
 
 		// If the command byte is set the nodeDestination has already been set
 		if(!trailer.command)
 		{
-			if (len != 0 && trailer.window != 0) {
+			if (len != 0 && trailer.window != 0 && tdm_state != TDM_SYNC) {
 				// show the user that we're sending real data
 				LED_ACTIVITY = LED_ON;
 				nodeDestination = paramNodeDestination;
@@ -953,9 +1926,10 @@ tdm_serial_loop(void)
 		}
 #endif // USE_TICK_YIELD
 		
-		// after sending a packet leave a bit of time before
-		// sending the next one. The receivers don't cope well
-		// with back to back packets
+		// the receivers queue packets in their receive ring, so
+		// in our own window we can send back to back. In someone
+		// else's window leave a bit of time before sending the
+		// next one
 #if USE_TICK_YIELD
 		if (transmit_yield && tdm_state == TDM_RECEIVE) {
 			transmit_yield = false;
@@ -964,18 +1938,22 @@ tdm_serial_loop(void)
 			P2 |= 0x08;
 #endif // DEBUG_PINS_TX_RX_STATE
 		}
-		else
+		else if (tdm_state == TDM_RECEIVE)
 		{
 			transmit_wait = packet_latency;
 		}
+		else
+		{
+			transmit_wait = 0;
+		}
 #else
-		transmit_wait = packet_latency;
+		transmit_wait = (tdm_state == TDM_RECEIVE) ? packet_latency : 0;
 #endif // USE_TICK_YIELD
 
 		// if we're implementing a duty cycle, add the
 		// transmit time to the number of ticks we've been transmitting
 		if ((duty_cycle - duty_cycle_offset) != 100) {
-			transmitted_ticks += flight_time_estimate(len+sizeof(trailer));
+			transmitted_ticks += flight_time_estimate(len+trailer_len);
 		}
 
 #ifdef WATCH_DOG_ENABLE
@@ -983,25 +1961,14 @@ tdm_serial_loop(void)
 		PCA0CPH5 = 0;
 #endif // WATCH_DOG_ENABLE
 		
-		// start transmitting the packet
-		if (!radio_transmit(len + sizeof(trailer), pbuf, nodeDestination, tdm_state_remaining) && len != 0) {
-			packet_force_resend();
-		}
-		
-		if (lbt_rssi != 0) {
-			// reset the LBT listen time
-			lbt_listen_time = 0;
-			lbt_rand = 0;
-		}
-
-		// set right receive channel
-		radio_set_channel(fhop_receive_channel());
-
-		// re-enable the receiver
-		radio_receiver_on();
-
-		if (len != 0 && trailer.window != 0) {
-			LED_ACTIVITY = LED_OFF;
+		// start transmitting the packet. The loop carries on
+		// while it is sent, and tdm_transmit_done() finishes it.
+		// The radio sends from a free receive slot, so packets
+		// that came in since we looked can leave it none
+		transmit_has_data = (len != 0);
+		transmit_in_progress = true;
+		if (!radio_transmit_start(len + trailer_len, tbuf, nodeDestination, tdm_state_remaining)) {
+			tdm_transmit_done(false);
 		}
 	}
 }
@@ -1026,6 +1993,7 @@ void
 tdm_set_node_destination(__pdata uint16_t destination)
 {
 	paramNodeDestination = destination;
+	packet_set_broadcast(destination == 0xFFFF);
 }
 
 void
@@ -1034,84 +2002,171 @@ tdm_set_sync_any(__pdata uint8_t any)
 	sync_any = any;
 }
 
-#if 0
-/// build the timing table
-static void 
-tdm_build_timing_table(void)
+void
+tdm_set_adaptive_rate(__pdata uint8_t min_rate)
 {
-	__pdata uint8_t j;
-	__pdata uint16_t rate;
+	min_air_rate = min_rate;
+}
+
+void
+tdm_set_sync_rounds(__pdata uint8_t rounds)
+{
+	sync_rounds = rounds ? rounds : 1;
+}
+
+// how many packets of each size tdm_calibrate_timing() sends
+#define TIMING_SAMPLES 8
+
+/// measure the packet latency and cost per byte at each air rate,
+/// without and with golay ECC, and record them with param_timing_set().
+/// Packets are kept short enough that the slowest rate stays within a
+/// 16 bit tick count. Any serial input stops the measurement
+void
+tdm_calibrate_timing(void)
+{
+	__pdata uint16_t rate, latency, t0, t1;
+	__pdata uint32_t per_byte_sum;
+	__pdata uint8_t i, j, ecc, size;
+	__pdata uint8_t txpower = radio_get_transmit_power();
+	__pdata uint8_t air_rate = radio_air_rate();
 	bool golay_saved = feature_golay;
-	feature_golay = false;
-	nodeDestination = 0xffff;
 
-	for (rate=2; rate<256; rate=(rate*3)/2) {
-		__pdata uint32_t latency_sum=0, per_byte_sum=0;
-		uint8_t size = MAX_PACKET_LENGTH;
+	for (i=0; i<MAX_PACKET_LENGTH; i++) {
+		pbuf[i] = i;
+	}
+	for (rate=2; rate<=250; rate=radio_air_rate()+1) {
 		radio_configure(rate);
-		for (j=0; j<50; j++) {
-			__pdata uint16_t time_0, time_max, t1, t2;
-			radio_set_channel(1);
-			radio_receiver_on();
-			if (serial_read_available() > 0) {
-				feature_golay = golay_saved;
-				return;
-			}
-			t1 = timer2_tick();
-			if (!radio_transmit(0, pbuf, nodeDestination, 0xFFFF)) {
-				break;
-			}
-			t2 = timer2_tick();
-			radio_receiver_on();
+		for (ecc=0; ecc<2; ecc++) {
+			feature_golay = ecc;
+			radio_set_transmit_fec(ecc);
+			size = ecc ? 96 : 200;
+			latency = 0;
+			per_byte_sum = 0;
+			for (j=0; j<TIMING_SAMPLES; j++) {
+				if (serial_read_available() > 0) {
+					goto done;
+				}
 
-			time_0 = t2-t1;
+				// an empty packet gives the latency
+				radio_set_channel(1);
+				t0 = timer2_tick();
+				if (!radio_transmit(0, pbuf, 0xFFFF, 0xFFFF)) {
+					break;
+				}
+				t0 = timer2_tick() - t0;
 
-			radio_set_channel(2);
-			t1 = timer2_tick();
-			if (!radio_transmit(size, pbuf, nodeDestination, 0xFFFF)) {
-				if (size == 0) {
+				radio_set_channel(2);
+				t1 = timer2_tick();
+				if (!radio_transmit(size, pbuf, 0xFFFF, 0xFFFF)) {
 					break;
 				}
-				size /= 4;
-				j--;
+				t1 = timer2_tick() - t1;
+
+				// take the worst latency, so estimates
+				// made from it are never short
+				if (t0 > latency) {
+					latency = t0;
+				}
+				if (t1 > t0) {
+					per_byte_sum += t1 - t0;
+				}
+			}
+			if (j != TIMING_SAMPLES) {
+				printf("%u kbps ecc %u: transmit failed\n",
+				       (unsigned)radio_air_rate(), (unsigned)ecc);
 				continue;
 			}
 
-			t2 = timer2_tick();
-			radio_receiver_on();
-
-			time_max = t2-t1;
-			latency_sum += time_0;
-			per_byte_sum += ((size/2) + (time_max - time_0))/size;
-		}
-		if (j > 0) {
-			printf("{ %u, %u, %u },\n",
-			       (unsigned)(radio_air_rate()),
-			       (unsigned)(latency_sum/j),
-			       (unsigned)(per_byte_sum/j));
+			// round the cost per byte up, for the same reason
+			t1 = (per_byte_sum + (uint32_t)size*TIMING_SAMPLES - 1) / ((uint32_t)size*TIMING_SAMPLES);
+			param_timing_set(radio_air_rate(), ecc, latency, t1);
+			printf("%u kbps ecc %u: latency %u ticks, %u ticks/byte\n",
+			       (unsigned)radio_air_rate(), (unsigned)ecc,
+			       (unsigned)latency, (unsigned)t1);
 		}
 	}
+done:
 	feature_golay = golay_saved;
+	radio_configure(air_rate);
+	radio_set_transmit_power(txpower);
+	radio_receiver_on();
 }
 
+/// send maximum length packets at every air rate, counting TX FIFO
+/// under and overflows. Any serial input stops the test
+void
+tdm_fifo_test(void)
+{
+	__pdata uint16_t rate, fifo_errors, failed;
+	__pdata uint8_t i;
+	__pdata uint8_t txpower = radio_get_transmit_power();
+	__pdata uint8_t air_rate = radio_air_rate();
+	bool golay_saved = feature_golay;
 
-// test hardware CRC code
-static void 
-crc_test(void)
+	feature_golay = false;
+	radio_set_transmit_fec(false);
+	for (i=0; i<MAX_PACKET_LENGTH; i++) {
+		pbuf[i] = i;
+	}
+	for (rate=2; rate<=250; rate=radio_air_rate()+1) {
+		radio_configure(rate);
+		radio_set_channel(1);
+		fifo_errors = errors.tx_fifo_errors;
+		failed = 0;
+		for (i=0; i<100; i++) {
+			if (serial_read_available() > 0) {
+				goto done;
+			}
+			if (!radio_transmit(MAX_PACKET_LENGTH, pbuf, 0xFFFF, 0xFFFF)) {
+				failed++;
+			}
+		}
+		printf("%u kbps: %u failed, %u FIFO errors\n",
+		       (unsigned)radio_air_rate(),
+		       (unsigned)failed,
+		       (unsigned)(errors.tx_fifo_errors - fifo_errors));
+	}
+done:
+	feature_golay = golay_saved;
+	radio_configure(air_rate);
+	radio_set_transmit_power(txpower);
+	radio_receiver_on();
+}
+
+/// time the table and CRC0 engine CRC code, printing the CRC of a
+/// known buffer and of a full size packet, which must agree
+void
+tdm_crc_test(void)
 {
 	__xdata uint8_t d[4] = { 0x01, 0x00, 0xbb, 0xcc };
-	__pdata uint16_t crc;
+	__pdata uint16_t crc, crc_packet;
 	uint16_t t1, t2;
-	crc = crc16(4, &d[0]);
-	printf("CRC: %x %x\n", crc, 0xb166);	
-	t1 = timer2_tick();
-	crc16(MAX_PACKET_LENGTH/2, pbuf);
-	t2 = timer2_tick();
-	printf("crc %u bytes took %u 16usec ticks\n",
-	       (unsigned)MAX_PACKET_LENGTH/2,
-	       t2-t1);
+	bool hardware = crc_hardware;
+	uint8_t i;
+
+	for (i=0; i<MAX_PACKET_LENGTH; i++) {
+		pbuf[i] = i;
+	}
+	for (i=0; i<2; i++) {
+		crc_hardware = (i == 1);
+		if (crc_hardware && !hardware) {
+			printf("no CRC0 engine\n");
+			break;
+		}
+		crc = crc16(4, &d[0]);
+		t1 = timer2_tick();
+		crc_packet = crc16(MAX_PACKET_LENGTH, pbuf);
+		t2 = timer2_tick();
+		printf("%s CRC: %x %x, packet %x, %u bytes took %u 16usec ticks\n",
+		       crc_hardware ? "CRC0" : "table",
+		       crc, 0x88fd, crc_packet,
+		       (unsigned)MAX_PACKET_LENGTH,
+		       t2-t1);
+	}
+	crc_hardware = hardware;
 }
 
+#if 0
 // test golay encoding
 static void 
 golay_test(void)
@@ -1150,92 +2205,32 @@ golay_test(void)
 void
 tdm_init(void)
 {
-	__pdata uint16_t i;
-	__pdata uint8_t air_rate = radio_air_rate();
-	__pdata uint32_t window_width;
-
-#define REGULATORY_MAX_WINDOW (((1000000UL/16)*4)/10)
-#define LBT_MIN_TIME_USEC 5000
-
-	// tdm_build_timing_table();
-
-	// calculate how many 16usec ticks it takes to send each byte
-	ticks_per_byte = (8+(8000000UL/(air_rate*1000UL)))/16;
-
-	// Check for rounding errors, and round up if needed..
-	if(10000UL*ticks_per_byte < (8+(8000000UL/(air_rate*1000UL)))*625) {
-		ticks_per_byte += 1;
-	}
-	
-	// calculate the minimum packet latency in 16 usec units
-	// we initially assume a preamble length of 40 bits, then
-	// adjust later based on actual preamble length. This is done
-	// so that if one radio has antenna diversity and the other
-	// doesn't, then they will both using the same TDM round timings
-	packet_latency = (8+(10/2)) * ticks_per_byte + 13;
-
-	if (feature_golay) {
-		max_data_packet_length = (MAX_PACKET_LENGTH/2) - (6+sizeof(trailer));
-
-		// golay encoding doubles the cost per byte
-		ticks_per_byte *= 2;
-
-		// and adds 4 bytes
-		packet_latency += 4*ticks_per_byte;
+	// the backlog is only sent when demand slots are enabled, and
+	// the sequence number and acknowledgement with ARQ
+	if (feature_arq) {
+		trailer_len = offsetof(struct tdm_trailer, ack) + sizeof(trailer.ack);
+	} else if (feature_demand_slots) {
+		trailer_len = offsetof(struct tdm_trailer, backlog) + sizeof(trailer.backlog);
 	} else {
-		max_data_packet_length = MAX_PACKET_LENGTH - sizeof(trailer);
+		trailer_len = offsetof(struct tdm_trailer, backlog);
 	}
 
-	// set the silence period to between changing channels
-	silence_period = 2*packet_latency;
-
-	// set the transmit window to allow for 2 full sized packets
-	window_width = 2*((max_data_packet_length*(uint32_t)ticks_per_byte)+packet_latency) + silence_period + packet_latency;
-
-	// if LBT is enabled, we need at least 3*5ms of window width
-	if (lbt_rssi != 0) {
-		// min listen time is 5ms
-		lbt_min_time = LBT_MIN_TIME_USEC/16;
-		window_width = constrain(window_width, 3*lbt_min_time, window_width);
-	}
+	// the configured rate is the fastest adaptive air rate may use
+	max_air_rate = radio_air_rate();
+	rate_switch_rounds = 0;
 
-	// make sure it fits in the 13 bits of the trailer window
-	if (window_width > 0x1FFF) {
-		window_width = 0x1FFF;
-	}
-	
-	// the window width cannot be more than 0.4 seconds to meet US regulations
-	if (window_width >= REGULATORY_MAX_WINDOW) {
-		window_width = REGULATORY_MAX_WINDOW;
-	}
-	
-	tx_window_width = window_width;
-	
-	// Window size of 4 statistic packets
-	window_width = 4*(((sizeof(trailer))*(uint32_t)ticks_per_byte)+packet_latency) + silence_period + packet_latency;
-	tx_sync_width = window_width;
-	
-	// now adjust the packet_latency for the actual preamble
-	// length, so we get the right flight time estimates, while
-	// not changing the round timings
-	packet_latency += ((settings.preamble_length-10)/2) * ticks_per_byte;
+	tdm_set_timing();
 
-	// tell the packet subsystem our max packet size, which it
-	// needs to know for MAVLink packet boundary detection
-	i = (tx_window_width - packet_latency) / ticks_per_byte;
-	if (i > max_data_packet_length) {
-		i = max_data_packet_length;
-	}
-	packet_set_max_xmit(i);
+	// fhop_init() seeded rand() with the network ID, which leaves
+	// every node with the same random numbers. Nodes that take a
+	// yielded window at the same moment need different back offs
+	srand(nodeId + 1);
 
 	// Clear Values..
 	trailer.nodeid  = 0xFFFF;
 	nodeTransmitSeq = 0xFFFF;
-	memset(remote_statistics, 0, sizeof(remote_statistics));
-	memset(statistics, 0, sizeof(statistics));
+	links_reset();
 	
-	// crc_test();
-
 	// tdm_test_timing();
 	
 	// golay_test();
@@ -51,6 +51,9 @@
 #define BASE_NODEID 0
 #define USE_TICK_YIELD 1
 
+// the most nodes that can be given their own window width
+#define MAX_SLOT_NODES 32
+
 #ifdef TDM_SYNC_LOGIC
 SBIT (TDM_SYNC_PIN, SFR_P2, 6);
 #endif // TDM_SYNC_LOGIC
@@ -73,6 +76,26 @@ extern void tdm_set_node_destination(__pdata uint16_t destination);
 /// setup if the node can sync from any
 extern void tdm_set_sync_any(__pdata uint8_t any);
 
+/// setup the slowest air rate the base may switch the network down to,
+/// 0 to stay at the configured rate
+extern void tdm_set_adaptive_rate(__pdata uint8_t min_rate);
+
+/// setup how many rounds go by between syncs from the base
+extern void tdm_set_sync_rounds(__pdata uint8_t rounds);
+
+/// rebuild the round schedule from the node weights
+extern void tdm_update_schedule(void);
+
+/// measure packet timing at every air rate and record it in the
+/// parameter timing table, for tdm_init() to use after a save and reboot
+extern void tdm_calibrate_timing(void);
+
+/// send full size packets at every air rate and report the TX FIFO errors
+extern void tdm_fifo_test(void);
+
+/// time crc16() with the tables and the CRC0 engine, which must agree
+extern void tdm_crc_test(void);
+
 /// report tdm timings
 extern void tdm_report_timing(void);
 